@@ -260,6 +260,13 @@ struct _specialization_cache {
     PyObject *getitem;
     uint32_t getitem_version;
     PyObject *init;
+    PyObject *call;
+    // The Python __setattr__ function, and the last property with a setter
+    // that a STORE_ATTR specialized for. Only one property is cached per
+    // type, so users must also check that its prop_name is the attribute
+    // being stored:
+    PyObject *setattr;
+    PyObject *property;
 };
 
 /* The *real* layout of a type object when allocated on the heap */
@@ -21,6 +21,19 @@ PyObject *_PyNumber_InPlacePowerNoMod(PyObject *lhs, PyObject *rhs);
 
 extern int _PyObject_HasLen(PyObject *o);
 
+// One of the _Py*_FormatAdvancedWriter() functions.
+typedef int (*_PyFormatAdvancedWriterFunc)(_PyUnicodeWriter *writer,
+                                           PyObject *obj,
+                                           PyObject *format_spec,
+                                           Py_ssize_t start,
+                                           Py_ssize_t end);
+
+// Format obj with the str format_spec, as the __format__ method that uses
+// format would.
+extern PyObject* _PyObject_FormatAdvanced(PyObject *obj,
+                                          PyObject *format_spec,
+                                          _PyFormatAdvancedWriterFunc format);
+
 /* === Sequence protocol ================================================ */
 
 #define PY_ITERSEARCH_COUNT    1
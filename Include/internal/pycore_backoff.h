@@ -88,6 +88,30 @@ advance_backoff_counter(_Py_BackoffCounter counter)
     return result;
 }
 
+/* Reset a counter that has just triggered, keeping its current backoff.
+ * Used once a trace has been created, so that any backoff learned from
+ * failures or invalidations is remembered for the next warmup. */
+static inline _Py_BackoffCounter
+rearm_backoff_counter(_Py_BackoffCounter counter)
+{
+    assert(!is_unreachable_backoff_counter(counter));
+    int backoff = counter.value_and_backoff & 15;
+    return make_backoff_counter((1 << backoff) - 1, backoff);
+}
+
+/* A warmup counter that triggers after value + 1 executions, with the
+ * backoff set to the number of bits in value. */
+static inline _Py_BackoffCounter
+make_warmup_backoff_counter(uint16_t value)
+{
+    assert(value <= 0xFFF);
+    uint16_t backoff = 0;
+    while (backoff < MAX_BACKOFF && (1 << backoff) <= value) {
+        backoff++;
+    }
+    return make_backoff_counter(value, backoff);
+}
+
 static inline bool
 backoff_counter_triggers(_Py_BackoffCounter counter)
 {
@@ -95,15 +119,23 @@ backoff_counter_triggers(_Py_BackoffCounter counter)
     return counter.value_and_backoff < UNREACHABLE_BACKOFF;
 }
 
+/* Initial counters for the Tier 2 optimizer, per interpreter.
+ * They default to the values below, and can be lowered with the
+ * PYTHON_JIT_JUMP_BACKWARD_WARMUP and PYTHON_JIT_SIDE_EXIT_WARMUP
+ * environment variables. */
+typedef struct {
+    _Py_BackoffCounter jump_backward;
+    _Py_BackoffCounter side_exit;
+} _PyWarmupCounters;
+
 /* Initial JUMP_BACKWARD counter.
  * This determines when we create a trace for a loop. */
 #define JUMP_BACKWARD_INITIAL_VALUE 4095
 #define JUMP_BACKWARD_INITIAL_BACKOFF 12
 static inline _Py_BackoffCounter
-initial_jump_backoff_counter(void)
+initial_jump_backoff_counter(const _PyWarmupCounters *warmup)
 {
-    return make_backoff_counter(JUMP_BACKWARD_INITIAL_VALUE,
-                                JUMP_BACKWARD_INITIAL_BACKOFF);
+    return warmup->jump_backward;
 }
 
 /* Initial exit temperature.
@@ -114,10 +146,18 @@ initial_jump_backoff_counter(void)
 #define SIDE_EXIT_INITIAL_BACKOFF 12
 
 static inline _Py_BackoffCounter
-initial_temperature_backoff_counter(void)
+initial_temperature_backoff_counter(const _PyWarmupCounters *warmup)
+{
+    return warmup->side_exit;
+}
+
+static inline void
+init_warmup_counters(_PyWarmupCounters *warmup)
 {
-    return make_backoff_counter(SIDE_EXIT_INITIAL_VALUE,
-                                SIDE_EXIT_INITIAL_BACKOFF);
+    warmup->jump_backward = make_backoff_counter(JUMP_BACKWARD_INITIAL_VALUE,
+                                                 JUMP_BACKWARD_INITIAL_BACKOFF);
+    warmup->side_exit = make_backoff_counter(SIDE_EXIT_INITIAL_VALUE,
+                                             SIDE_EXIT_INITIAL_BACKOFF);
 }
 
 /* Unreachable backoff counter. */
@@ -105,6 +105,16 @@ typedef struct {
     uint16_t index;
 } _PyAttrCache;
 
+/* Two-entry cache used by LOAD_ATTR_INSTANCE_VALUE_POLY. The first version
+ * overlays _PyAttrCache, so a site that deoptimizes still has the version of
+ * the type it was last specialized for when it is specialized again. */
+typedef struct {
+    _Py_BackoffCounter counter;
+    uint16_t type_version[2];
+    uint16_t type_version2[2];
+    uint16_t index;
+} _PyAttrPolyCache;
+
 typedef struct {
     _Py_BackoffCounter counter;
     uint16_t type_version[2];
@@ -116,7 +126,7 @@ typedef struct {
 } _PyLoadMethodCache;
 
 
-// MUST be the max(_PyAttrCache, _PyLoadMethodCache)
+// MUST be the max(_PyAttrCache, _PyAttrPolyCache, _PyLoadMethodCache)
 #define INLINE_CACHE_ENTRIES_LOAD_ATTR CACHE_ENTRIES(_PyLoadMethodCache)
 
 #define INLINE_CACHE_ENTRIES_STORE_ATTR CACHE_ENTRIES(_PyAttrCache)
@@ -160,6 +170,13 @@ typedef struct {
 
 #define INLINE_CACHE_ENTRIES_CONTAINS_OP CACHE_ENTRIES(_PyContainsOpCache)
 
+typedef struct {
+    _Py_BackoffCounter counter;
+} _PyFormatCache;
+
+#define INLINE_CACHE_ENTRIES_FORMAT_SIMPLE CACHE_ENTRIES(_PyFormatCache)
+#define INLINE_CACHE_ENTRIES_FORMAT_WITH_SPEC CACHE_ENTRIES(_PyFormatCache)
+
 /* "Locals plus" for a code object is the set of locals + cell vars +
  * free vars.  This relates to variable names as well as offsets into
  * the "fast locals" storage array of execution frames.  The compiler
@@ -314,7 +331,12 @@ extern void _Py_Specialize_UnpackSequence(_PyStackRef seq, _Py_CODEUNIT *instr,
 extern void _Py_Specialize_ForIter(_PyStackRef iter, _Py_CODEUNIT *instr, int oparg);
 extern void _Py_Specialize_Send(_PyStackRef receiver, _Py_CODEUNIT *instr);
 extern void _Py_Specialize_ToBool(_PyStackRef value, _Py_CODEUNIT *instr);
-extern void _Py_Specialize_ContainsOp(_PyStackRef value, _Py_CODEUNIT *instr);
+extern void _Py_Specialize_ContainsOp(_PyStackRef lhs, _PyStackRef rhs,
+                                      _Py_CODEUNIT *instr);
+extern void _Py_Specialize_FormatSimple(_PyStackRef value,
+                                        _Py_CODEUNIT *instr);
+extern void _Py_Specialize_FormatWithSpec(_PyStackRef value,
+                                          _Py_CODEUNIT *instr);
 
 // Utility functions for reading/writing 32/64-bit values in the inline caches.
 // Great care should be taken to ensure that these functions remain correct and
@@ -486,6 +508,11 @@ typedef struct {
     int oparg;
     binaryopguardfunc guard;
     binaryopactionfunc action;
+    /* Exact types the guard implies for its operands, and the exact type of
+     * the result, for the tier two optimizer. NULL if not known. */
+    PyTypeObject *lhs_type;
+    PyTypeObject *rhs_type;
+    PyTypeObject *res_type;
 } _PyBinaryOpSpecializationDescr;
 
 /* Comparison bit masks. */
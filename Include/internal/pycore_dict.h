@@ -44,6 +44,12 @@ extern int _PyDict_Next(
 
 extern int _PyDict_HasOnlyStringKeys(PyObject *mp);
 
+// Advance a dict_itemiterator without building the (key, value) tuple.
+// Returns 1 and sets *key and *value to new references, 0 if the iterator
+// is exhausted, or -1 with an exception set.
+// Export for the JIT (used by FOR_ITER_DICT_ITEMS).
+PyAPI_FUNC(int) _PyDictIter_NextItem(PyObject *iter, PyObject **key, PyObject **value);
+
 // Export for '_ctypes' shared extension
 PyAPI_FUNC(Py_ssize_t) _PyDict_SizeOf(PyDictObject *);
 
@@ -0,0 +1,21 @@
+#ifndef Py_INTERNAL_ENUM_H
+#define Py_INTERNAL_ENUM_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef Py_BUILD_CORE
+#  error "this header requires Py_BUILD_CORE define"
+#endif
+
+// Advance an enumerate object without building the (index, item) tuple.
+// Returns 1 and sets *index and *item to new references, 0 if the
+// underlying iterator is exhausted, or -1 with an exception set (which may
+// be StopIteration if the underlying iterator raised it).
+// Export for the JIT (used by FOR_ITER_ENUMERATE).
+PyAPI_FUNC(int) _PyEnum_NextItem(PyObject *en, PyObject **index, PyObject **item);
+
+#ifdef __cplusplus
+}
+#endif
+#endif   /* !Py_INTERNAL_ENUM_H */
@@ -141,6 +141,7 @@ static inline void _PyObject_GC_SET_SHARED(PyObject *op) {
 #define _PyGC_DEBUG_COLLECTABLE       (1<<1) /* print collectable objects */
 #define _PyGC_DEBUG_UNCOLLECTABLE     (1<<2) /* print uncollectable objects */
 #define _PyGC_DEBUG_SAVEALL           (1<<5) /* save all garbage in gc.garbage */
+#define _PyGC_DEBUG_TYPE_STATS        (1<<6) /* count objects per type */
 #define _PyGC_DEBUG_LEAK              _PyGC_DEBUG_COLLECTABLE | \
                                       _PyGC_DEBUG_UNCOLLECTABLE | \
                                       _PyGC_DEBUG_SAVEALL
@@ -333,6 +334,9 @@ extern void _PyGC_CollectNoFail(PyThreadState *tstate);
 
 /* Freeze objects tracked by the GC and ignore them in future collections. */
 extern void _PyGC_Freeze(PyInterpreterState *interp);
+/* Make frozen objects and the objects they refer to immortal and untrack
+   them.  Returns -1 with an exception set on failure. */
+extern int _PyGC_Immortalize(PyInterpreterState *interp);
 /* Unfreezes objects placing them in the oldest generation */
 extern void _PyGC_Unfreeze(PyInterpreterState *interp);
 /* Number of frozen objects */
@@ -341,6 +345,20 @@ extern Py_ssize_t _PyGC_GetFreezeCount(PyInterpreterState *interp);
 extern PyObject *_PyGC_GetObjects(PyInterpreterState *interp, int generation);
 extern PyObject *_PyGC_GetReferrers(PyInterpreterState *interp, PyObject *objs);
 
+// Per-collection statistics reported to gc.callbacks, shared by both
+// collectors
+extern void _PyGC_StatsStart(struct gc_collection_stats *stats);
+extern void _PyGC_StatsPhaseDone(struct gc_collection_stats *stats,
+                                 const char *name);
+extern void _PyGC_StatsDone(struct gc_collection_stats *stats);
+extern void _PyGC_StatsCountType(struct gc_collection_stats *stats,
+                                 struct _Py_hashtable_t **table,
+                                 PyObject *op);
+extern void _PyGC_StatsNameTypes(struct gc_collection_stats *stats);
+extern PyObject* _PyGC_StatsAsDict(struct gc_collection_stats *stats,
+                                   int generation, int done);
+extern void _PyGC_StatsClear(struct gc_collection_stats *stats);
+
 // Functions to clear types free lists
 extern void _PyGC_ClearAllFreeLists(PyInterpreterState *interp);
 extern void _Py_ScheduleGC(PyThreadState *tstate);
@@ -355,6 +373,9 @@ extern int _PyGC_VisitStackRef(union _PyStackRef *ref, visitproc visit, void *ar
 #ifdef Py_GIL_DISABLED
 extern void _PyGC_VisitObjectsWorldStopped(PyInterpreterState *interp,
                                            gcvisitobjects_t callback, void *arg);
+
+// Forget the parallel marking threads, which don't exist in a forked child.
+extern void _PyGC_AfterFork_Child(_PyRuntimeState *runtime);
 #endif
 
 #ifdef __cplusplus
@@ -491,6 +491,7 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(identity_hint)
         STRUCT_FOR_ID(ignore)
         STRUCT_FOR_ID(imag)
+        STRUCT_FOR_ID(immortalize)
         STRUCT_FOR_ID(importlib)
         STRUCT_FOR_ID(in_fd)
         STRUCT_FOR_ID(incoming)
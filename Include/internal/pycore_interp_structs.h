@@ -8,6 +8,7 @@ extern "C" {
 #endif
 
 #include "pycore_ast_state.h"     // struct ast_state
+#include "pycore_backoff.h"       // _PyWarmupCounters
 #include "pycore_llist.h"         // struct llist_node
 #include "pycore_opcode_utils.h"  // NUM_COMMON_CONSTANTS
 #include "pycore_pymath.h"        // _PY_SHORT_FLOAT_REPR
@@ -175,11 +176,33 @@ struct gc_generation {
                   generations */
 };
 
+#define _PyGC_MAX_PHASES 8
+
 struct gc_collection_stats {
     /* number of collected objects */
     Py_ssize_t collected;
     /* total number of uncollectable objects (put into gc.garbage) */
     Py_ssize_t uncollectable;
+    /* number of objects examined by the collection */
+    Py_ssize_t visited;
+    /* wall time of the whole collection */
+    PyTime_t duration;
+    /* wall time of each phase, in the order the phases first ran */
+    PyTime_t phase_start;
+    int nphases;
+    struct {
+        const char *name;
+        PyTime_t duration;
+    } phases[_PyGC_MAX_PHASES];
+    /* number of collected and surviving objects per type (strong reference
+       to the type -> count), only with gc.DEBUG_TYPE_STATS */
+    struct _Py_hashtable_t *collected_types;
+    struct _Py_hashtable_t *survived_types;
+    /* the same counts keyed by fully qualified type name, filled in by
+       _PyGC_StatsNameTypes() before the garbage is cleared, since a type
+       may be part of the garbage itself */
+    PyObject *collected_type_names;
+    PyObject *survived_type_names;
 };
 
 /* Running stats per generation */
@@ -229,6 +252,12 @@ struct _gc_runtime_state {
     /* Which of the old spaces is the visited space */
     int visited_space;
     int phase;
+    /* Target maximum duration of an incremental collection, or 0 for no
+       limit (see gc.set_pause_budget()). */
+    PyTime_t pause_budget;
+    /* Average cost of an increment per object, in nanoseconds, used to
+       size increments to fit in pause_budget. */
+    double increment_ns_per_object;
 
 #ifdef Py_GIL_DISABLED
     /* This is the number of objects that survived the last full
@@ -245,6 +274,13 @@ struct _gc_runtime_state {
 
     /* True if gc.freeze() has been used. */
     int freeze_active;
+
+    /* Number of threads used to mark reachable objects, including the
+       collecting thread (set from PYTHON_GC_MARK_THREADS). */
+    int mark_threads;
+
+    /* The other marking threads, started on first use. */
+    struct _gc_mark_pool *mark_pool;
 #endif
 };
 
@@ -382,6 +418,18 @@ typedef struct _rare_events {
     uint8_t func_modification;
 } _rare_events;
 
+/* Reasons for the optimizer to give up on a trace, counted per-interpreter
+   and reported by sys._jit.get_abandoned(). */
+typedef enum {
+    _PY_TRACE_ABANDON_NO_PROGRESS,
+    _PY_TRACE_ABANDON_UNSUPPORTED_OPCODE,
+    _PY_TRACE_ABANDON_UNKNOWN_CALLEE,
+    _PY_TRACE_ABANDON_STACK_OVERFLOW,
+    _PY_TRACE_ABANDON_STACK_UNDERFLOW,
+    _PY_TRACE_ABANDON_OPTIMIZER,
+    _PY_TRACE_ABANDON_COUNT
+} _PyTraceAbandonReason;
+
 struct
 Bigint {
     struct Bigint *next;
@@ -741,6 +789,16 @@ struct _Py_unique_id_pool {
 
 #endif
 
+/* Executable memory that the JIT compiles executors into. Mappings are
+   carved up into page-sized runs, one per executor (see Python/jit.c). */
+struct _jit_code_arena {
+    struct _jit_code_chunk *chunks;
+    // Bytes currently handed out to executors
+    size_t used;
+    // Upper bound for "used" (PYTHON_JIT_MEMORY_LIMIT), or 0 if unbounded
+    size_t limit;
+};
+
 
 /* PyInterpreterState holds the global state for one of the runtime's
    interpreters.  Typically the initial (main) interpreter is the only one.
@@ -916,8 +974,14 @@ struct _is {
     struct callable_cache callable_cache;
     PyObject *common_consts[NUM_COMMON_CONSTANTS];
     bool jit;
+    // Emit machine code on a background thread (PYTHON_JIT_BACKGROUND)
+    bool jit_background;
+    struct _jit_code_arena jit_arena;
+    struct _jit_compiler *jit_compiler;
+    _PyWarmupCounters warmup;
     struct _PyExecutorObject *executor_list_head;
     size_t trace_run_counter;
+    uint64_t trace_abandoned[_PY_TRACE_ABANDON_COUNT];
     _rare_events rare_events;
     PyDict_WatchCallback builtins_dict_watcher;
 
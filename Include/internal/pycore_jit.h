@@ -19,6 +19,10 @@ typedef _Py_CODEUNIT *(*jit_func)(_PyInterpreterFrame *frame, _PyStackRef *stack
 
 int _PyJIT_Compile(_PyExecutorObject *executor, const _PyUOpInstruction *trace, size_t length);
 void _PyJIT_Free(_PyExecutorObject *executor);
+void _PyJIT_Fini(PyInterpreterState *interp);
+void _PyJIT_BeforeFork(PyInterpreterState *interp);
+void _PyJIT_AfterFork_Parent(PyInterpreterState *interp);
+void _PyJIT_AfterFork_Child(PyInterpreterState *interp);
 
 #endif  // _Py_JIT
 
@@ -69,6 +69,9 @@ PyMutex_LockFlags(PyMutex *m, _PyLockFlags flags)
 // error messages) otherwise returns 0.
 extern int _PyMutex_TryUnlock(PyMutex *m);
 
+// Yield the processor to other threads (sched_yield() or SwitchToThread()).
+extern void _Py_yield(void);
+
 
 // PyEvent is a one-time event notification
 typedef struct {
@@ -275,6 +275,7 @@ Known values:
     Python 3.14a6 3620 (Optimize bytecode for all/any/tuple called on a genexp)
     Python 3.14a7 3621 (Optimize LOAD_FAST opcodes into LOAD_FAST_BORROW)
     Python 3.14a7 3622 (Store annotations in different class dict keys)
+    Python 3.14a7 3623 (Add inline caches to FORMAT_SIMPLE and FORMAT_WITH_SPEC)
 
     Python 3.15 will start with 3650
 
@@ -287,7 +288,7 @@ PC/launcher.c must also be updated.
 
 */
 
-#define PYC_MAGIC_NUMBER 3622
+#define PYC_MAGIC_NUMBER 3623
 /* This is equivalent to converting PYC_MAGIC_NUMBER to 2 bytes
    (little-endian) and then appending b'\r\n'. */
 #define PYC_MAGIC_NUMBER_TOKEN \
@@ -909,6 +909,21 @@ extern int _PyType_CacheInitForSpecialization(PyHeapTypeObject *type,
                                               PyObject *init,
                                               unsigned int tp_version);
 
+// Same as _PyType_CacheInitForSpecialization(), but for the __call__ method
+// used when instances of type are called.
+extern int _PyType_CacheCallForSpecialization(PyHeapTypeObject *type,
+                                              PyObject *call,
+                                              unsigned int tp_version);
+
+// Same as _PyType_CacheInitForSpecialization(), but for the __setattr__
+// method and for a property stored to by STORE_ATTR.
+extern int _PyType_CacheSetattrForSpecialization(PyHeapTypeObject *type,
+                                                 PyObject *setattr,
+                                                 unsigned int tp_version);
+extern int _PyType_CachePropertyForSpecialization(PyHeapTypeObject *type,
+                                                  PyObject *property,
+                                                  unsigned int tp_version);
+
 #ifdef Py_GIL_DISABLED
 #  define MANAGED_DICT_OFFSET    (((Py_ssize_t)sizeof(PyObject *))*-1)
 #  define MANAGED_WEAKREF_OFFSET (((Py_ssize_t)sizeof(PyObject *))*-2)
@@ -97,6 +97,8 @@ int _PyOpcode_num_popped(int opcode, int oparg)  {
             return 2 + oparg;
         case CALL_BUILTIN_O:
             return 2 + oparg;
+        case CALL_DUNDER_CALL:
+            return 2 + oparg;
         case CALL_FUNCTION_EX:
             return 4;
         case CALL_INTRINSIC_1:
@@ -147,8 +149,12 @@ int _PyOpcode_num_popped(int opcode, int oparg)  {
             return 2;
         case COMPARE_OP_FLOAT:
             return 2;
+        case COMPARE_OP_FLOAT_INT:
+            return 2;
         case COMPARE_OP_INT:
             return 2;
+        case COMPARE_OP_INT_FLOAT:
+            return 2;
         case COMPARE_OP_STR:
             return 2;
         case CONTAINS_OP:
@@ -157,6 +163,8 @@ int _PyOpcode_num_popped(int opcode, int oparg)  {
             return 2;
         case CONTAINS_OP_SET:
             return 2;
+        case CONTAINS_OP_STR_TUPLE:
+            return 2;
         case CONVERT_VALUE:
             return 1;
         case COPY:
@@ -193,16 +201,34 @@ int _PyOpcode_num_popped(int opcode, int oparg)  {
             return 0;
         case FORMAT_SIMPLE:
             return 1;
+        case FORMAT_SIMPLE_FLOAT:
+            return 1;
+        case FORMAT_SIMPLE_INT:
+            return 1;
+        case FORMAT_SIMPLE_STR:
+            return 1;
         case FORMAT_WITH_SPEC:
             return 2;
+        case FORMAT_WITH_SPEC_FLOAT:
+            return 2;
+        case FORMAT_WITH_SPEC_INT:
+            return 2;
+        case FORMAT_WITH_SPEC_STR:
+            return 2;
         case FOR_ITER:
             return 1;
+        case FOR_ITER_DICT_ITEMS:
+            return 1;
+        case FOR_ITER_ENUMERATE:
+            return 1;
         case FOR_ITER_GEN:
             return 1;
         case FOR_ITER_LIST:
             return 1;
         case FOR_ITER_RANGE:
             return 1;
+        case FOR_ITER_REVERSED_LIST:
+            return 1;
         case FOR_ITER_TUPLE:
             return 1;
         case GET_AITER:
@@ -299,6 +325,8 @@ int _PyOpcode_num_popped(int opcode, int oparg)  {
             return 1;
         case LOAD_ATTR_INSTANCE_VALUE:
             return 1;
+        case LOAD_ATTR_INSTANCE_VALUE_POLY:
+            return 1;
         case LOAD_ATTR_METHOD_LAZY_DICT:
             return 1;
         case LOAD_ATTR_METHOD_NO_DICT:
@@ -441,6 +469,10 @@ int _PyOpcode_num_popped(int opcode, int oparg)  {
             return 2;
         case STORE_ATTR_INSTANCE_VALUE:
             return 2;
+        case STORE_ATTR_PROPERTY:
+            return 2;
+        case STORE_ATTR_SETATTR_OVERRIDDEN:
+            return 2;
         case STORE_ATTR_SLOT:
             return 2;
         case STORE_ATTR_WITH_HINT:
@@ -576,6 +608,8 @@ int _PyOpcode_num_pushed(int opcode, int oparg)  {
             return 1;
         case CALL_BUILTIN_O:
             return 1;
+        case CALL_DUNDER_CALL:
+            return 0;
         case CALL_FUNCTION_EX:
             return 1;
         case CALL_INTRINSIC_1:
@@ -626,8 +660,12 @@ int _PyOpcode_num_pushed(int opcode, int oparg)  {
             return 1;
         case COMPARE_OP_FLOAT:
             return 1;
+        case COMPARE_OP_FLOAT_INT:
+            return 1;
         case COMPARE_OP_INT:
             return 1;
+        case COMPARE_OP_INT_FLOAT:
+            return 1;
         case COMPARE_OP_STR:
             return 1;
         case CONTAINS_OP:
@@ -636,6 +674,8 @@ int _PyOpcode_num_pushed(int opcode, int oparg)  {
             return 1;
         case CONTAINS_OP_SET:
             return 1;
+        case CONTAINS_OP_STR_TUPLE:
+            return 1;
         case CONVERT_VALUE:
             return 1;
         case COPY:
@@ -672,16 +712,34 @@ int _PyOpcode_num_pushed(int opcode, int oparg)  {
             return 0;
         case FORMAT_SIMPLE:
             return 1;
+        case FORMAT_SIMPLE_FLOAT:
+            return 1;
+        case FORMAT_SIMPLE_INT:
+            return 1;
+        case FORMAT_SIMPLE_STR:
+            return 1;
         case FORMAT_WITH_SPEC:
             return 1;
+        case FORMAT_WITH_SPEC_FLOAT:
+            return 1;
+        case FORMAT_WITH_SPEC_INT:
+            return 1;
+        case FORMAT_WITH_SPEC_STR:
+            return 1;
         case FOR_ITER:
             return 2;
+        case FOR_ITER_DICT_ITEMS:
+            return 2;
+        case FOR_ITER_ENUMERATE:
+            return 2;
         case FOR_ITER_GEN:
             return 1;
         case FOR_ITER_LIST:
             return 2;
         case FOR_ITER_RANGE:
             return 2;
+        case FOR_ITER_REVERSED_LIST:
+            return 2;
         case FOR_ITER_TUPLE:
             return 2;
         case GET_AITER:
@@ -778,6 +836,8 @@ int _PyOpcode_num_pushed(int opcode, int oparg)  {
             return 1;
         case LOAD_ATTR_INSTANCE_VALUE:
             return 1 + (oparg & 1);
+        case LOAD_ATTR_INSTANCE_VALUE_POLY:
+            return 1 + (oparg & 1);
         case LOAD_ATTR_METHOD_LAZY_DICT:
             return 2;
         case LOAD_ATTR_METHOD_NO_DICT:
@@ -920,6 +980,10 @@ int _PyOpcode_num_pushed(int opcode, int oparg)  {
             return 0;
         case STORE_ATTR_INSTANCE_VALUE:
             return 0;
+        case STORE_ATTR_PROPERTY:
+            return 0;
+        case STORE_ATTR_SETATTR_OVERRIDDEN:
+            return 0;
         case STORE_ATTR_SLOT:
             return 0;
         case STORE_ATTR_WITH_HINT:
@@ -1072,7 +1136,7 @@ const struct opcode_metadata _PyOpcode_opcode_metadata[266] = {
     [BINARY_OP_SUBSCR_DICT] = { true, INSTR_FMT_IXC0000, HAS_EXIT_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG },
     [BINARY_OP_SUBSCR_GETITEM] = { true, INSTR_FMT_IXC0000, HAS_DEOPT_FLAG },
     [BINARY_OP_SUBSCR_LIST_INT] = { true, INSTR_FMT_IXC0000, HAS_DEOPT_FLAG | HAS_EXIT_FLAG | HAS_ESCAPES_FLAG },
-    [BINARY_OP_SUBSCR_STR_INT] = { true, INSTR_FMT_IXC0000, HAS_DEOPT_FLAG | HAS_EXIT_FLAG | HAS_ESCAPES_FLAG },
+    [BINARY_OP_SUBSCR_STR_INT] = { true, INSTR_FMT_IXC0000, HAS_DEOPT_FLAG | HAS_EXIT_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG },
     [BINARY_OP_SUBSCR_TUPLE_INT] = { true, INSTR_FMT_IXC0000, HAS_DEOPT_FLAG | HAS_EXIT_FLAG },
     [BINARY_OP_SUBTRACT_FLOAT] = { true, INSTR_FMT_IXC0000, HAS_EXIT_FLAG | HAS_ERROR_FLAG },
     [BINARY_OP_SUBTRACT_INT] = { true, INSTR_FMT_IXC0000, HAS_EXIT_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG },
@@ -1092,6 +1156,7 @@ const struct opcode_metadata _PyOpcode_opcode_metadata[266] = {
     [CALL_BUILTIN_FAST] = { true, INSTR_FMT_IBC00, HAS_ARG_FLAG | HAS_EVAL_BREAK_FLAG | HAS_DEOPT_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG },
     [CALL_BUILTIN_FAST_WITH_KEYWORDS] = { true, INSTR_FMT_IBC00, HAS_ARG_FLAG | HAS_EVAL_BREAK_FLAG | HAS_DEOPT_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG },
     [CALL_BUILTIN_O] = { true, INSTR_FMT_IBC00, HAS_ARG_FLAG | HAS_EVAL_BREAK_FLAG | HAS_EXIT_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG },
+    [CALL_DUNDER_CALL] = { true, INSTR_FMT_IBC00, HAS_ARG_FLAG | HAS_DEOPT_FLAG | HAS_EXIT_FLAG | HAS_ERROR_FLAG | HAS_ERROR_NO_POP_FLAG | HAS_ESCAPES_FLAG },
     [CALL_FUNCTION_EX] = { true, INSTR_FMT_IX, HAS_EVAL_BREAK_FLAG | HAS_ERROR_FLAG | HAS_ERROR_NO_POP_FLAG | HAS_ESCAPES_FLAG },
     [CALL_INTRINSIC_1] = { true, INSTR_FMT_IB, HAS_ARG_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG },
     [CALL_INTRINSIC_2] = { true, INSTR_FMT_IB, HAS_ARG_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG },
@@ -1117,11 +1182,14 @@ const struct opcode_metadata _PyOpcode_opcode_metadata[266] = {
     [CLEANUP_THROW] = { true, INSTR_FMT_IX, HAS_ERROR_FLAG | HAS_ERROR_NO_POP_FLAG | HAS_ESCAPES_FLAG },
     [COMPARE_OP] = { true, INSTR_FMT_IBC, HAS_ARG_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG },
     [COMPARE_OP_FLOAT] = { true, INSTR_FMT_IBC, HAS_ARG_FLAG | HAS_EXIT_FLAG },
+    [COMPARE_OP_FLOAT_INT] = { true, INSTR_FMT_IBC, HAS_ARG_FLAG | HAS_DEOPT_FLAG | HAS_EXIT_FLAG },
     [COMPARE_OP_INT] = { true, INSTR_FMT_IBC, HAS_ARG_FLAG | HAS_DEOPT_FLAG | HAS_EXIT_FLAG },
+    [COMPARE_OP_INT_FLOAT] = { true, INSTR_FMT_IBC, HAS_ARG_FLAG | HAS_DEOPT_FLAG | HAS_EXIT_FLAG },
     [COMPARE_OP_STR] = { true, INSTR_FMT_IBC, HAS_ARG_FLAG | HAS_EXIT_FLAG },
     [CONTAINS_OP] = { true, INSTR_FMT_IBC, HAS_ARG_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG },
     [CONTAINS_OP_DICT] = { true, INSTR_FMT_IBC, HAS_ARG_FLAG | HAS_EXIT_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG },
     [CONTAINS_OP_SET] = { true, INSTR_FMT_IBC, HAS_ARG_FLAG | HAS_DEOPT_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG },
+    [CONTAINS_OP_STR_TUPLE] = { true, INSTR_FMT_IBC, HAS_ARG_FLAG | HAS_DEOPT_FLAG | HAS_EXIT_FLAG },
     [CONVERT_VALUE] = { true, INSTR_FMT_IB, HAS_ARG_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG },
     [COPY] = { true, INSTR_FMT_IB, HAS_ARG_FLAG | HAS_PURE_FLAG },
     [COPY_FREE_VARS] = { true, INSTR_FMT_IB, HAS_ARG_FLAG },
@@ -1139,12 +1207,21 @@ const struct opcode_metadata _PyOpcode_opcode_metadata[266] = {
     [ENTER_EXECUTOR] = { true, INSTR_FMT_IB, HAS_ARG_FLAG },
     [EXIT_INIT_CHECK] = { true, INSTR_FMT_IX, HAS_ERROR_FLAG | HAS_ERROR_NO_POP_FLAG | HAS_ESCAPES_FLAG },
     [EXTENDED_ARG] = { true, INSTR_FMT_IB, HAS_ARG_FLAG },
-    [FORMAT_SIMPLE] = { true, INSTR_FMT_IX, HAS_ERROR_FLAG | HAS_ESCAPES_FLAG },
-    [FORMAT_WITH_SPEC] = { true, INSTR_FMT_IX, HAS_ERROR_FLAG | HAS_ESCAPES_FLAG },
+    [FORMAT_SIMPLE] = { true, INSTR_FMT_IXC, HAS_ERROR_FLAG | HAS_ESCAPES_FLAG },
+    [FORMAT_SIMPLE_FLOAT] = { true, INSTR_FMT_IXC, HAS_EXIT_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG },
+    [FORMAT_SIMPLE_INT] = { true, INSTR_FMT_IXC, HAS_EXIT_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG },
+    [FORMAT_SIMPLE_STR] = { true, INSTR_FMT_IXC, HAS_EXIT_FLAG },
+    [FORMAT_WITH_SPEC] = { true, INSTR_FMT_IXC, HAS_ERROR_FLAG | HAS_ESCAPES_FLAG },
+    [FORMAT_WITH_SPEC_FLOAT] = { true, INSTR_FMT_IXC, HAS_EXIT_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG },
+    [FORMAT_WITH_SPEC_INT] = { true, INSTR_FMT_IXC, HAS_EXIT_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG },
+    [FORMAT_WITH_SPEC_STR] = { true, INSTR_FMT_IXC, HAS_EXIT_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG },
     [FOR_ITER] = { true, INSTR_FMT_IBC, HAS_ARG_FLAG | HAS_JUMP_FLAG | HAS_ERROR_FLAG | HAS_ERROR_NO_POP_FLAG | HAS_ESCAPES_FLAG },
+    [FOR_ITER_DICT_ITEMS] = { true, INSTR_FMT_IBC, HAS_ARG_FLAG | HAS_JUMP_FLAG | HAS_EXIT_FLAG | HAS_ERROR_FLAG | HAS_ERROR_NO_POP_FLAG | HAS_ESCAPES_FLAG },
+    [FOR_ITER_ENUMERATE] = { true, INSTR_FMT_IBC, HAS_ARG_FLAG | HAS_JUMP_FLAG | HAS_EXIT_FLAG | HAS_ERROR_FLAG | HAS_ERROR_NO_POP_FLAG | HAS_ESCAPES_FLAG },
     [FOR_ITER_GEN] = { true, INSTR_FMT_IBC, HAS_ARG_FLAG | HAS_DEOPT_FLAG },
     [FOR_ITER_LIST] = { true, INSTR_FMT_IBC, HAS_ARG_FLAG | HAS_JUMP_FLAG | HAS_DEOPT_FLAG | HAS_EXIT_FLAG | HAS_ESCAPES_FLAG },
     [FOR_ITER_RANGE] = { true, INSTR_FMT_IBC, HAS_ARG_FLAG | HAS_JUMP_FLAG | HAS_EXIT_FLAG | HAS_ERROR_FLAG },
+    [FOR_ITER_REVERSED_LIST] = { true, INSTR_FMT_IBC, HAS_ARG_FLAG | HAS_JUMP_FLAG | HAS_EXIT_FLAG | HAS_ESCAPES_FLAG },
     [FOR_ITER_TUPLE] = { true, INSTR_FMT_IBC, HAS_ARG_FLAG | HAS_JUMP_FLAG | HAS_EXIT_FLAG | HAS_ESCAPES_FLAG },
     [GET_AITER] = { true, INSTR_FMT_IX, HAS_ERROR_FLAG | HAS_ESCAPES_FLAG },
     [GET_ANEXT] = { true, INSTR_FMT_IX, HAS_ERROR_FLAG | HAS_ERROR_NO_POP_FLAG | HAS_ESCAPES_FLAG },
@@ -1189,6 +1266,7 @@ const struct opcode_metadata _PyOpcode_opcode_metadata[266] = {
     [LOAD_ATTR_CLASS_WITH_METACLASS_CHECK] = { true, INSTR_FMT_IBC00000000, HAS_ARG_FLAG | HAS_EXIT_FLAG },
     [LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN] = { true, INSTR_FMT_IBC00000000, HAS_ARG_FLAG | HAS_NAME_FLAG | HAS_DEOPT_FLAG },
     [LOAD_ATTR_INSTANCE_VALUE] = { true, INSTR_FMT_IBC00000000, HAS_ARG_FLAG | HAS_DEOPT_FLAG | HAS_EXIT_FLAG | HAS_ESCAPES_FLAG },
+    [LOAD_ATTR_INSTANCE_VALUE_POLY] = { true, INSTR_FMT_IBC00000000, HAS_ARG_FLAG | HAS_DEOPT_FLAG | HAS_EXIT_FLAG | HAS_ESCAPES_FLAG },
     [LOAD_ATTR_METHOD_LAZY_DICT] = { true, INSTR_FMT_IBC00000000, HAS_ARG_FLAG | HAS_DEOPT_FLAG | HAS_EXIT_FLAG },
     [LOAD_ATTR_METHOD_NO_DICT] = { true, INSTR_FMT_IBC00000000, HAS_ARG_FLAG | HAS_EXIT_FLAG },
     [LOAD_ATTR_METHOD_WITH_VALUES] = { true, INSTR_FMT_IBC00000000, HAS_ARG_FLAG | HAS_DEOPT_FLAG | HAS_EXIT_FLAG },
@@ -1255,6 +1333,8 @@ const struct opcode_metadata _PyOpcode_opcode_metadata[266] = {
     [SET_UPDATE] = { true, INSTR_FMT_IB, HAS_ARG_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG },
     [STORE_ATTR] = { true, INSTR_FMT_IBC000, HAS_ARG_FLAG | HAS_NAME_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG },
     [STORE_ATTR_INSTANCE_VALUE] = { true, INSTR_FMT_IXC000, HAS_EXIT_FLAG | HAS_ESCAPES_FLAG },
+    [STORE_ATTR_PROPERTY] = { true, INSTR_FMT_IBC000, HAS_ARG_FLAG | HAS_NAME_FLAG | HAS_DEOPT_FLAG | HAS_EXIT_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG },
+    [STORE_ATTR_SETATTR_OVERRIDDEN] = { true, INSTR_FMT_IBC000, HAS_ARG_FLAG | HAS_NAME_FLAG | HAS_EXIT_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG },
     [STORE_ATTR_SLOT] = { true, INSTR_FMT_IXC000, HAS_DEOPT_FLAG | HAS_EXIT_FLAG | HAS_ESCAPES_FLAG },
     [STORE_ATTR_WITH_HINT] = { true, INSTR_FMT_IBC000, HAS_ARG_FLAG | HAS_NAME_FLAG | HAS_DEOPT_FLAG | HAS_EXIT_FLAG | HAS_ESCAPES_FLAG },
     [STORE_DEREF] = { true, INSTR_FMT_IB, HAS_ARG_FLAG | HAS_FREE_FLAG | HAS_ESCAPES_FLAG },
@@ -1337,6 +1417,7 @@ _PyOpcode_macro_expansion[256] = {
     [CALL_BUILTIN_FAST] = { .nuops = 2, .uops = { { _CALL_BUILTIN_FAST, OPARG_SIMPLE, 3 }, { _CHECK_PERIODIC, OPARG_SIMPLE, 3 } } },
     [CALL_BUILTIN_FAST_WITH_KEYWORDS] = { .nuops = 2, .uops = { { _CALL_BUILTIN_FAST_WITH_KEYWORDS, OPARG_SIMPLE, 3 }, { _CHECK_PERIODIC, OPARG_SIMPLE, 3 } } },
     [CALL_BUILTIN_O] = { .nuops = 2, .uops = { { _CALL_BUILTIN_O, OPARG_SIMPLE, 3 }, { _CHECK_PERIODIC, OPARG_SIMPLE, 3 } } },
+    [CALL_DUNDER_CALL] = { .nuops = 6, .uops = { { _CHECK_PEP_523, OPARG_SIMPLE, 1 }, { _CHECK_DUNDER_CALL, 2, 1 }, { _EXPAND_DUNDER_CALL, OPARG_SIMPLE, 3 }, { _PY_FRAME_GENERAL, OPARG_SIMPLE, 3 }, { _SAVE_RETURN_OFFSET, OPARG_SAVE_RETURN_OFFSET, 3 }, { _PUSH_FRAME, OPARG_SIMPLE, 3 } } },
     [CALL_INTRINSIC_1] = { .nuops = 1, .uops = { { _CALL_INTRINSIC_1, OPARG_SIMPLE, 0 } } },
     [CALL_INTRINSIC_2] = { .nuops = 1, .uops = { { _CALL_INTRINSIC_2, OPARG_SIMPLE, 0 } } },
     [CALL_ISINSTANCE] = { .nuops = 1, .uops = { { _CALL_ISINSTANCE, OPARG_SIMPLE, 3 } } },
@@ -1359,11 +1440,14 @@ _PyOpcode_macro_expansion[256] = {
     [CHECK_EXC_MATCH] = { .nuops = 1, .uops = { { _CHECK_EXC_MATCH, OPARG_SIMPLE, 0 } } },
     [COMPARE_OP] = { .nuops = 1, .uops = { { _COMPARE_OP, OPARG_SIMPLE, 0 } } },
     [COMPARE_OP_FLOAT] = { .nuops = 3, .uops = { { _GUARD_TOS_FLOAT, OPARG_SIMPLE, 0 }, { _GUARD_NOS_FLOAT, OPARG_SIMPLE, 0 }, { _COMPARE_OP_FLOAT, OPARG_SIMPLE, 1 } } },
+    [COMPARE_OP_FLOAT_INT] = { .nuops = 3, .uops = { { _GUARD_TOS_INT, OPARG_SIMPLE, 0 }, { _GUARD_NOS_FLOAT, OPARG_SIMPLE, 0 }, { _COMPARE_OP_FLOAT_INT, OPARG_SIMPLE, 1 } } },
     [COMPARE_OP_INT] = { .nuops = 3, .uops = { { _GUARD_TOS_INT, OPARG_SIMPLE, 0 }, { _GUARD_NOS_INT, OPARG_SIMPLE, 0 }, { _COMPARE_OP_INT, OPARG_SIMPLE, 1 } } },
+    [COMPARE_OP_INT_FLOAT] = { .nuops = 3, .uops = { { _GUARD_TOS_FLOAT, OPARG_SIMPLE, 0 }, { _GUARD_NOS_INT, OPARG_SIMPLE, 0 }, { _COMPARE_OP_INT_FLOAT, OPARG_SIMPLE, 1 } } },
     [COMPARE_OP_STR] = { .nuops = 3, .uops = { { _GUARD_TOS_UNICODE, OPARG_SIMPLE, 0 }, { _GUARD_NOS_UNICODE, OPARG_SIMPLE, 0 }, { _COMPARE_OP_STR, OPARG_SIMPLE, 1 } } },
     [CONTAINS_OP] = { .nuops = 1, .uops = { { _CONTAINS_OP, OPARG_SIMPLE, 0 } } },
     [CONTAINS_OP_DICT] = { .nuops = 2, .uops = { { _GUARD_TOS_DICT, OPARG_SIMPLE, 0 }, { _CONTAINS_OP_DICT, OPARG_SIMPLE, 1 } } },
     [CONTAINS_OP_SET] = { .nuops = 2, .uops = { { _GUARD_TOS_ANY_SET, OPARG_SIMPLE, 0 }, { _CONTAINS_OP_SET, OPARG_SIMPLE, 1 } } },
+    [CONTAINS_OP_STR_TUPLE] = { .nuops = 3, .uops = { { _GUARD_TOS_TUPLE, OPARG_SIMPLE, 0 }, { _GUARD_NOS_UNICODE, OPARG_SIMPLE, 0 }, { _CONTAINS_OP_STR_TUPLE, OPARG_SIMPLE, 1 } } },
     [CONVERT_VALUE] = { .nuops = 1, .uops = { { _CONVERT_VALUE, OPARG_SIMPLE, 0 } } },
     [COPY] = { .nuops = 1, .uops = { { _COPY, OPARG_SIMPLE, 0 } } },
     [COPY_FREE_VARS] = { .nuops = 1, .uops = { { _COPY_FREE_VARS, OPARG_SIMPLE, 0 } } },
@@ -1379,11 +1463,20 @@ _PyOpcode_macro_expansion[256] = {
     [END_SEND] = { .nuops = 1, .uops = { { _END_SEND, OPARG_SIMPLE, 0 } } },
     [EXIT_INIT_CHECK] = { .nuops = 1, .uops = { { _EXIT_INIT_CHECK, OPARG_SIMPLE, 0 } } },
     [FORMAT_SIMPLE] = { .nuops = 1, .uops = { { _FORMAT_SIMPLE, OPARG_SIMPLE, 0 } } },
+    [FORMAT_SIMPLE_FLOAT] = { .nuops = 2, .uops = { { _GUARD_TOS_FLOAT, OPARG_SIMPLE, 0 }, { _FORMAT_SIMPLE_FLOAT, OPARG_SIMPLE, 1 } } },
+    [FORMAT_SIMPLE_INT] = { .nuops = 2, .uops = { { _GUARD_TOS_INT, OPARG_SIMPLE, 0 }, { _FORMAT_SIMPLE_INT, OPARG_SIMPLE, 1 } } },
+    [FORMAT_SIMPLE_STR] = { .nuops = 2, .uops = { { _GUARD_TOS_UNICODE, OPARG_SIMPLE, 0 }, { _FORMAT_SIMPLE_STR, OPARG_SIMPLE, 1 } } },
     [FORMAT_WITH_SPEC] = { .nuops = 1, .uops = { { _FORMAT_WITH_SPEC, OPARG_SIMPLE, 0 } } },
+    [FORMAT_WITH_SPEC_FLOAT] = { .nuops = 2, .uops = { { _GUARD_NOS_FLOAT, OPARG_SIMPLE, 0 }, { _FORMAT_WITH_SPEC_FLOAT, OPARG_SIMPLE, 1 } } },
+    [FORMAT_WITH_SPEC_INT] = { .nuops = 2, .uops = { { _GUARD_NOS_INT, OPARG_SIMPLE, 0 }, { _FORMAT_WITH_SPEC_INT, OPARG_SIMPLE, 1 } } },
+    [FORMAT_WITH_SPEC_STR] = { .nuops = 2, .uops = { { _GUARD_NOS_UNICODE, OPARG_SIMPLE, 0 }, { _FORMAT_WITH_SPEC_STR, OPARG_SIMPLE, 1 } } },
     [FOR_ITER] = { .nuops = 1, .uops = { { _FOR_ITER, OPARG_REPLACED, 0 } } },
+    [FOR_ITER_DICT_ITEMS] = { .nuops = 2, .uops = { { _ITER_CHECK_DICT_ITEMS, OPARG_SIMPLE, 1 }, { _ITER_NEXT_DICT_ITEMS, OPARG_REPLACED, 1 } } },
+    [FOR_ITER_ENUMERATE] = { .nuops = 2, .uops = { { _ITER_CHECK_ENUMERATE, OPARG_SIMPLE, 1 }, { _ITER_NEXT_ENUMERATE, OPARG_REPLACED, 1 } } },
     [FOR_ITER_GEN] = { .nuops = 3, .uops = { { _CHECK_PEP_523, OPARG_SIMPLE, 1 }, { _FOR_ITER_GEN_FRAME, OPARG_SIMPLE, 1 }, { _PUSH_FRAME, OPARG_SIMPLE, 1 } } },
     [FOR_ITER_LIST] = { .nuops = 3, .uops = { { _ITER_CHECK_LIST, OPARG_SIMPLE, 1 }, { _ITER_JUMP_LIST, OPARG_REPLACED, 1 }, { _ITER_NEXT_LIST, OPARG_REPLACED, 1 } } },
     [FOR_ITER_RANGE] = { .nuops = 3, .uops = { { _ITER_CHECK_RANGE, OPARG_SIMPLE, 1 }, { _ITER_JUMP_RANGE, OPARG_REPLACED, 1 }, { _ITER_NEXT_RANGE, OPARG_SIMPLE, 1 } } },
+    [FOR_ITER_REVERSED_LIST] = { .nuops = 3, .uops = { { _ITER_CHECK_REVERSED_LIST, OPARG_SIMPLE, 1 }, { _ITER_JUMP_REVERSED_LIST, OPARG_REPLACED, 1 }, { _ITER_NEXT_REVERSED_LIST, OPARG_SIMPLE, 1 } } },
     [FOR_ITER_TUPLE] = { .nuops = 3, .uops = { { _ITER_CHECK_TUPLE, OPARG_SIMPLE, 1 }, { _ITER_JUMP_TUPLE, OPARG_REPLACED, 1 }, { _ITER_NEXT_TUPLE, OPARG_SIMPLE, 1 } } },
     [GET_AITER] = { .nuops = 1, .uops = { { _GET_AITER, OPARG_SIMPLE, 0 } } },
     [GET_ANEXT] = { .nuops = 1, .uops = { { _GET_ANEXT, OPARG_SIMPLE, 0 } } },
@@ -1400,6 +1493,7 @@ _PyOpcode_macro_expansion[256] = {
     [LOAD_ATTR_CLASS] = { .nuops = 3, .uops = { { _CHECK_ATTR_CLASS, 2, 1 }, { _LOAD_ATTR_CLASS, 4, 5 }, { _PUSH_NULL_CONDITIONAL, OPARG_SIMPLE, 9 } } },
     [LOAD_ATTR_CLASS_WITH_METACLASS_CHECK] = { .nuops = 4, .uops = { { _CHECK_ATTR_CLASS, 2, 1 }, { _GUARD_TYPE_VERSION, 2, 3 }, { _LOAD_ATTR_CLASS, 4, 5 }, { _PUSH_NULL_CONDITIONAL, OPARG_SIMPLE, 9 } } },
     [LOAD_ATTR_INSTANCE_VALUE] = { .nuops = 4, .uops = { { _GUARD_TYPE_VERSION, 2, 1 }, { _CHECK_MANAGED_OBJECT_HAS_VALUES, OPARG_SIMPLE, 3 }, { _LOAD_ATTR_INSTANCE_VALUE, 1, 3 }, { _PUSH_NULL_CONDITIONAL, OPARG_SIMPLE, 9 } } },
+    [LOAD_ATTR_INSTANCE_VALUE_POLY] = { .nuops = 5, .uops = { { _GUARD_TYPE_VERSION_POLY, 2, 1 }, { _GUARD_TYPE_VERSION_POLY, OPERAND1_2, 3 }, { _CHECK_MANAGED_OBJECT_HAS_VALUES, OPARG_SIMPLE, 5 }, { _LOAD_ATTR_INSTANCE_VALUE_INDEX, 1, 5 }, { _PUSH_NULL_CONDITIONAL, OPARG_SIMPLE, 9 } } },
     [LOAD_ATTR_METHOD_LAZY_DICT] = { .nuops = 3, .uops = { { _GUARD_TYPE_VERSION, 2, 1 }, { _CHECK_ATTR_METHOD_LAZY_DICT, 1, 3 }, { _LOAD_ATTR_METHOD_LAZY_DICT, 4, 5 } } },
     [LOAD_ATTR_METHOD_NO_DICT] = { .nuops = 2, .uops = { { _GUARD_TYPE_VERSION, 2, 1 }, { _LOAD_ATTR_METHOD_NO_DICT, 4, 5 } } },
     [LOAD_ATTR_METHOD_WITH_VALUES] = { .nuops = 4, .uops = { { _GUARD_TYPE_VERSION, 2, 1 }, { _GUARD_DORV_VALUES_INST_ATTR_FROM_DICT, OPARG_SIMPLE, 3 }, { _GUARD_KEYS_VERSION, 2, 3 }, { _LOAD_ATTR_METHOD_WITH_VALUES, 4, 5 } } },
@@ -1458,6 +1552,8 @@ _PyOpcode_macro_expansion[256] = {
     [SET_UPDATE] = { .nuops = 1, .uops = { { _SET_UPDATE, OPARG_SIMPLE, 0 } } },
     [STORE_ATTR] = { .nuops = 1, .uops = { { _STORE_ATTR, OPARG_SIMPLE, 3 } } },
     [STORE_ATTR_INSTANCE_VALUE] = { .nuops = 3, .uops = { { _GUARD_TYPE_VERSION_AND_LOCK, 2, 1 }, { _GUARD_DORV_NO_DICT, OPARG_SIMPLE, 3 }, { _STORE_ATTR_INSTANCE_VALUE, 1, 3 } } },
+    [STORE_ATTR_PROPERTY] = { .nuops = 2, .uops = { { _GUARD_TYPE_VERSION, 2, 1 }, { _STORE_ATTR_PROPERTY, OPARG_SIMPLE, 4 } } },
+    [STORE_ATTR_SETATTR_OVERRIDDEN] = { .nuops = 2, .uops = { { _GUARD_TYPE_VERSION, 2, 1 }, { _STORE_ATTR_SETATTR_OVERRIDDEN, OPARG_SIMPLE, 4 } } },
     [STORE_ATTR_SLOT] = { .nuops = 2, .uops = { { _GUARD_TYPE_VERSION, 2, 1 }, { _STORE_ATTR_SLOT, 1, 3 } } },
     [STORE_ATTR_WITH_HINT] = { .nuops = 2, .uops = { { _GUARD_TYPE_VERSION, 2, 1 }, { _STORE_ATTR_WITH_HINT, 1, 3 } } },
     [STORE_DEREF] = { .nuops = 1, .uops = { { _STORE_DEREF, OPARG_SIMPLE, 0 } } },
@@ -1525,6 +1621,7 @@ const char *_PyOpcode_OpName[266] = {
     [CALL_BUILTIN_FAST] = "CALL_BUILTIN_FAST",
     [CALL_BUILTIN_FAST_WITH_KEYWORDS] = "CALL_BUILTIN_FAST_WITH_KEYWORDS",
     [CALL_BUILTIN_O] = "CALL_BUILTIN_O",
+    [CALL_DUNDER_CALL] = "CALL_DUNDER_CALL",
     [CALL_FUNCTION_EX] = "CALL_FUNCTION_EX",
     [CALL_INTRINSIC_1] = "CALL_INTRINSIC_1",
     [CALL_INTRINSIC_2] = "CALL_INTRINSIC_2",
@@ -1550,11 +1647,14 @@ const char *_PyOpcode_OpName[266] = {
     [CLEANUP_THROW] = "CLEANUP_THROW",
     [COMPARE_OP] = "COMPARE_OP",
     [COMPARE_OP_FLOAT] = "COMPARE_OP_FLOAT",
+    [COMPARE_OP_FLOAT_INT] = "COMPARE_OP_FLOAT_INT",
     [COMPARE_OP_INT] = "COMPARE_OP_INT",
+    [COMPARE_OP_INT_FLOAT] = "COMPARE_OP_INT_FLOAT",
     [COMPARE_OP_STR] = "COMPARE_OP_STR",
     [CONTAINS_OP] = "CONTAINS_OP",
     [CONTAINS_OP_DICT] = "CONTAINS_OP_DICT",
     [CONTAINS_OP_SET] = "CONTAINS_OP_SET",
+    [CONTAINS_OP_STR_TUPLE] = "CONTAINS_OP_STR_TUPLE",
     [CONVERT_VALUE] = "CONVERT_VALUE",
     [COPY] = "COPY",
     [COPY_FREE_VARS] = "COPY_FREE_VARS",
@@ -1573,11 +1673,20 @@ const char *_PyOpcode_OpName[266] = {
     [EXIT_INIT_CHECK] = "EXIT_INIT_CHECK",
     [EXTENDED_ARG] = "EXTENDED_ARG",
     [FORMAT_SIMPLE] = "FORMAT_SIMPLE",
+    [FORMAT_SIMPLE_FLOAT] = "FORMAT_SIMPLE_FLOAT",
+    [FORMAT_SIMPLE_INT] = "FORMAT_SIMPLE_INT",
+    [FORMAT_SIMPLE_STR] = "FORMAT_SIMPLE_STR",
     [FORMAT_WITH_SPEC] = "FORMAT_WITH_SPEC",
+    [FORMAT_WITH_SPEC_FLOAT] = "FORMAT_WITH_SPEC_FLOAT",
+    [FORMAT_WITH_SPEC_INT] = "FORMAT_WITH_SPEC_INT",
+    [FORMAT_WITH_SPEC_STR] = "FORMAT_WITH_SPEC_STR",
     [FOR_ITER] = "FOR_ITER",
+    [FOR_ITER_DICT_ITEMS] = "FOR_ITER_DICT_ITEMS",
+    [FOR_ITER_ENUMERATE] = "FOR_ITER_ENUMERATE",
     [FOR_ITER_GEN] = "FOR_ITER_GEN",
     [FOR_ITER_LIST] = "FOR_ITER_LIST",
     [FOR_ITER_RANGE] = "FOR_ITER_RANGE",
+    [FOR_ITER_REVERSED_LIST] = "FOR_ITER_REVERSED_LIST",
     [FOR_ITER_TUPLE] = "FOR_ITER_TUPLE",
     [GET_AITER] = "GET_AITER",
     [GET_ANEXT] = "GET_ANEXT",
@@ -1626,6 +1735,7 @@ const char *_PyOpcode_OpName[266] = {
     [LOAD_ATTR_CLASS_WITH_METACLASS_CHECK] = "LOAD_ATTR_CLASS_WITH_METACLASS_CHECK",
     [LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN] = "LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN",
     [LOAD_ATTR_INSTANCE_VALUE] = "LOAD_ATTR_INSTANCE_VALUE",
+    [LOAD_ATTR_INSTANCE_VALUE_POLY] = "LOAD_ATTR_INSTANCE_VALUE_POLY",
     [LOAD_ATTR_METHOD_LAZY_DICT] = "LOAD_ATTR_METHOD_LAZY_DICT",
     [LOAD_ATTR_METHOD_NO_DICT] = "LOAD_ATTR_METHOD_NO_DICT",
     [LOAD_ATTR_METHOD_WITH_VALUES] = "LOAD_ATTR_METHOD_WITH_VALUES",
@@ -1697,6 +1807,8 @@ const char *_PyOpcode_OpName[266] = {
     [SET_UPDATE] = "SET_UPDATE",
     [STORE_ATTR] = "STORE_ATTR",
     [STORE_ATTR_INSTANCE_VALUE] = "STORE_ATTR_INSTANCE_VALUE",
+    [STORE_ATTR_PROPERTY] = "STORE_ATTR_PROPERTY",
+    [STORE_ATTR_SETATTR_OVERRIDDEN] = "STORE_ATTR_SETATTR_OVERRIDDEN",
     [STORE_ATTR_SLOT] = "STORE_ATTR_SLOT",
     [STORE_ATTR_WITH_HINT] = "STORE_ATTR_WITH_HINT",
     [STORE_DEREF] = "STORE_DEREF",
@@ -1752,6 +1864,8 @@ const uint8_t _PyOpcode_Caches[256] = {
     [FOR_ITER] = 1,
     [CALL] = 3,
     [CALL_KW] = 3,
+    [FORMAT_SIMPLE] = 1,
+    [FORMAT_WITH_SPEC] = 1,
     [BINARY_OP] = 5,
 };
 #endif
@@ -1790,6 +1904,7 @@ const uint8_t _PyOpcode_Deopt[256] = {
     [CALL_BUILTIN_FAST] = CALL,
     [CALL_BUILTIN_FAST_WITH_KEYWORDS] = CALL,
     [CALL_BUILTIN_O] = CALL,
+    [CALL_DUNDER_CALL] = CALL,
     [CALL_FUNCTION_EX] = CALL_FUNCTION_EX,
     [CALL_INTRINSIC_1] = CALL_INTRINSIC_1,
     [CALL_INTRINSIC_2] = CALL_INTRINSIC_2,
@@ -1815,11 +1930,14 @@ const uint8_t _PyOpcode_Deopt[256] = {
     [CLEANUP_THROW] = CLEANUP_THROW,
     [COMPARE_OP] = COMPARE_OP,
     [COMPARE_OP_FLOAT] = COMPARE_OP,
+    [COMPARE_OP_FLOAT_INT] = COMPARE_OP,
     [COMPARE_OP_INT] = COMPARE_OP,
+    [COMPARE_OP_INT_FLOAT] = COMPARE_OP,
     [COMPARE_OP_STR] = COMPARE_OP,
     [CONTAINS_OP] = CONTAINS_OP,
     [CONTAINS_OP_DICT] = CONTAINS_OP,
     [CONTAINS_OP_SET] = CONTAINS_OP,
+    [CONTAINS_OP_STR_TUPLE] = CONTAINS_OP,
     [CONVERT_VALUE] = CONVERT_VALUE,
     [COPY] = COPY,
     [COPY_FREE_VARS] = COPY_FREE_VARS,
@@ -1838,11 +1956,20 @@ const uint8_t _PyOpcode_Deopt[256] = {
     [EXIT_INIT_CHECK] = EXIT_INIT_CHECK,
     [EXTENDED_ARG] = EXTENDED_ARG,
     [FORMAT_SIMPLE] = FORMAT_SIMPLE,
+    [FORMAT_SIMPLE_FLOAT] = FORMAT_SIMPLE,
+    [FORMAT_SIMPLE_INT] = FORMAT_SIMPLE,
+    [FORMAT_SIMPLE_STR] = FORMAT_SIMPLE,
     [FORMAT_WITH_SPEC] = FORMAT_WITH_SPEC,
+    [FORMAT_WITH_SPEC_FLOAT] = FORMAT_WITH_SPEC,
+    [FORMAT_WITH_SPEC_INT] = FORMAT_WITH_SPEC,
+    [FORMAT_WITH_SPEC_STR] = FORMAT_WITH_SPEC,
     [FOR_ITER] = FOR_ITER,
+    [FOR_ITER_DICT_ITEMS] = FOR_ITER,
+    [FOR_ITER_ENUMERATE] = FOR_ITER,
     [FOR_ITER_GEN] = FOR_ITER,
     [FOR_ITER_LIST] = FOR_ITER,
     [FOR_ITER_RANGE] = FOR_ITER,
+    [FOR_ITER_REVERSED_LIST] = FOR_ITER,
     [FOR_ITER_TUPLE] = FOR_ITER,
     [GET_AITER] = GET_AITER,
     [GET_ANEXT] = GET_ANEXT,
@@ -1887,6 +2014,7 @@ const uint8_t _PyOpcode_Deopt[256] = {
     [LOAD_ATTR_CLASS_WITH_METACLASS_CHECK] = LOAD_ATTR,
     [LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN] = LOAD_ATTR,
     [LOAD_ATTR_INSTANCE_VALUE] = LOAD_ATTR,
+    [LOAD_ATTR_INSTANCE_VALUE_POLY] = LOAD_ATTR,
     [LOAD_ATTR_METHOD_LAZY_DICT] = LOAD_ATTR,
     [LOAD_ATTR_METHOD_NO_DICT] = LOAD_ATTR,
     [LOAD_ATTR_METHOD_WITH_VALUES] = LOAD_ATTR,
@@ -1953,6 +2081,8 @@ const uint8_t _PyOpcode_Deopt[256] = {
     [SET_UPDATE] = SET_UPDATE,
     [STORE_ATTR] = STORE_ATTR,
     [STORE_ATTR_INSTANCE_VALUE] = STORE_ATTR,
+    [STORE_ATTR_PROPERTY] = STORE_ATTR,
+    [STORE_ATTR_SETATTR_OVERRIDDEN] = STORE_ATTR,
     [STORE_ATTR_SLOT] = STORE_ATTR,
     [STORE_ATTR_WITH_HINT] = STORE_ATTR,
     [STORE_DEREF] = STORE_DEREF,
@@ -1997,22 +2127,6 @@ const uint8_t _PyOpcode_Deopt[256] = {
     case 125: \
     case 126: \
     case 127: \
-    case 211: \
-    case 212: \
-    case 213: \
-    case 214: \
-    case 215: \
-    case 216: \
-    case 217: \
-    case 218: \
-    case 219: \
-    case 220: \
-    case 221: \
-    case 222: \
-    case 223: \
-    case 224: \
-    case 225: \
-    case 226: \
     case 227: \
     case 228: \
     case 229: \
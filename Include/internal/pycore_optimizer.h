@@ -70,6 +70,7 @@ typedef struct {
     uint32_t target;
     _Py_BackoffCounter temperature;
     const struct _PyExecutorObject *executor;
+    uint64_t hit_count;  // Number of times this exit was taken
 } _PyExitData;
 
 typedef struct _PyExecutorObject {
@@ -81,9 +82,28 @@ typedef struct _PyExecutorObject {
     size_t jit_size;
     void *jit_code;
     void *jit_side_entry;
+    uint64_t run_count;    // Entries plus loop iterations
+    uint64_t deopt_count;  // Exits through _DEOPT
+    // The code object each exit target is in, as one tuple of
+    // (qualname, filename, firstlineno) or None per exit
+    PyObject *exit_locations;
     _PyExitData exits[1];
 } _PyExecutorObject;
 
+/* With PYTHON_JIT_BACKGROUND, an executor's machine code is emitted on the
+ * JIT's compiler thread, and is only published once it is complete. Until
+ * then, execution has to stay in tier 1. */
+static inline int
+_PyExecutor_IsReady(_PyExecutorObject *executor)
+{
+#ifdef _Py_JIT
+    return _Py_atomic_load_ptr_acquire(&executor->jit_code) != NULL;
+#else
+    (void)executor;
+    return 1;
+#endif
+}
+
 
 // Export for '_opcode' shared extension (JIT compiler).
 PyAPI_FUNC(_PyExecutorObject*) _Py_GetExecutor(PyCodeObject *code, int offset);
@@ -304,6 +324,8 @@ static inline int is_terminator(const _PyUOpInstruction *uop)
 }
 
 PyAPI_FUNC(int) _PyDumpExecutors(FILE *out);
+PyAPI_FUNC(PyObject *) _PyGetExecutorProfiles(void);
+PyAPI_FUNC(PyObject *) _PyGetAbandonedTraces(void);
 
 #ifdef __cplusplus
 }
@@ -998,6 +998,7 @@ extern "C" {
     INIT_ID(identity_hint), \
     INIT_ID(ignore), \
     INIT_ID(imag), \
+    INIT_ID(immortalize), \
     INIT_ID(importlib), \
     INIT_ID(in_fd), \
     INIT_ID(incoming), \
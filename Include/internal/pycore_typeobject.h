@@ -93,6 +93,7 @@ extern PyObject * _PyType_GetBases(PyTypeObject *type);
 extern PyObject * _PyType_GetMRO(PyTypeObject *type);
 extern PyObject* _PyType_GetSubclasses(PyTypeObject *);
 extern int _PyType_HasSubclasses(PyTypeObject *);
+extern int _PyType_HasStaticTraverse(PyTypeObject *);
 
 // Export for _testinternalcapi extension.
 PyAPI_FUNC(PyObject *) _PyType_GetSlotWrapperNames(void);
@@ -113,6 +114,8 @@ extern PyObject* _Py_BaseObject_RichCompare(PyObject* self, PyObject* other, int
 
 extern PyObject* _Py_slot_tp_getattro(PyObject *self, PyObject *name);
 extern PyObject* _Py_slot_tp_getattr_hook(PyObject *self, PyObject *name);
+extern int _Py_slot_tp_setattro(PyObject *self, PyObject *name, PyObject *value);
+extern PyObject* _Py_slot_tp_call(PyObject *self, PyObject *args, PyObject *kwds);
 
 extern PyTypeObject _PyBufferWrapper_Type;
 
@@ -56,101 +56,114 @@ extern "C" {
 #define _CHECK_ATTR_CLASS 332
 #define _CHECK_ATTR_METHOD_LAZY_DICT 333
 #define _CHECK_CALL_BOUND_METHOD_EXACT_ARGS 334
+#define _CHECK_DUNDER_CALL 335
 #define _CHECK_EG_MATCH CHECK_EG_MATCH
 #define _CHECK_EXC_MATCH CHECK_EXC_MATCH
-#define _CHECK_FUNCTION 335
-#define _CHECK_FUNCTION_EXACT_ARGS 336
-#define _CHECK_FUNCTION_VERSION 337
-#define _CHECK_FUNCTION_VERSION_INLINE 338
-#define _CHECK_FUNCTION_VERSION_KW 339
-#define _CHECK_IS_NOT_PY_CALLABLE 340
-#define _CHECK_IS_NOT_PY_CALLABLE_KW 341
-#define _CHECK_MANAGED_OBJECT_HAS_VALUES 342
-#define _CHECK_METHOD_VERSION 343
-#define _CHECK_METHOD_VERSION_KW 344
-#define _CHECK_PEP_523 345
-#define _CHECK_PERIODIC 346
-#define _CHECK_PERIODIC_IF_NOT_YIELD_FROM 347
-#define _CHECK_STACK_SPACE 348
-#define _CHECK_STACK_SPACE_OPERAND 349
-#define _CHECK_VALIDITY 350
-#define _COMPARE_OP 351
-#define _COMPARE_OP_FLOAT 352
-#define _COMPARE_OP_INT 353
-#define _COMPARE_OP_STR 354
-#define _CONTAINS_OP 355
-#define _CONTAINS_OP_DICT 356
-#define _CONTAINS_OP_SET 357
+#define _CHECK_FUNCTION 336
+#define _CHECK_FUNCTION_EXACT_ARGS 337
+#define _CHECK_FUNCTION_VERSION 338
+#define _CHECK_FUNCTION_VERSION_INLINE 339
+#define _CHECK_FUNCTION_VERSION_KW 340
+#define _CHECK_IS_NOT_PY_CALLABLE 341
+#define _CHECK_IS_NOT_PY_CALLABLE_KW 342
+#define _CHECK_MANAGED_OBJECT_HAS_VALUES 343
+#define _CHECK_METHOD_VERSION 344
+#define _CHECK_METHOD_VERSION_KW 345
+#define _CHECK_PEP_523 346
+#define _CHECK_PERIODIC 347
+#define _CHECK_PERIODIC_IF_NOT_YIELD_FROM 348
+#define _CHECK_STACK_SPACE 349
+#define _CHECK_STACK_SPACE_OPERAND 350
+#define _CHECK_VALIDITY 351
+#define _COMPARE_OP 352
+#define _COMPARE_OP_FLOAT 353
+#define _COMPARE_OP_FLOAT_INT 354
+#define _COMPARE_OP_INT 355
+#define _COMPARE_OP_INT_FLOAT 356
+#define _COMPARE_OP_STR 357
+#define _CONTAINS_OP 358
+#define _CONTAINS_OP_DICT 359
+#define _CONTAINS_OP_SET 360
+#define _CONTAINS_OP_STR_TUPLE 361
 #define _CONVERT_VALUE CONVERT_VALUE
 #define _COPY COPY
 #define _COPY_FREE_VARS COPY_FREE_VARS
-#define _CREATE_INIT_FRAME 358
+#define _CREATE_INIT_FRAME 362
 #define _DELETE_ATTR DELETE_ATTR
 #define _DELETE_DEREF DELETE_DEREF
 #define _DELETE_FAST DELETE_FAST
 #define _DELETE_GLOBAL DELETE_GLOBAL
 #define _DELETE_NAME DELETE_NAME
 #define _DELETE_SUBSCR DELETE_SUBSCR
-#define _DEOPT 359
+#define _DEOPT 363
 #define _DICT_MERGE DICT_MERGE
 #define _DICT_UPDATE DICT_UPDATE
-#define _DO_CALL 360
-#define _DO_CALL_FUNCTION_EX 361
-#define _DO_CALL_KW 362
+#define _DO_CALL 364
+#define _DO_CALL_FUNCTION_EX 365
+#define _DO_CALL_KW 366
 #define _END_FOR END_FOR
 #define _END_SEND END_SEND
-#define _ERROR_POP_N 363
+#define _ERROR_POP_N 367
 #define _EXIT_INIT_CHECK EXIT_INIT_CHECK
-#define _EXPAND_METHOD 364
-#define _EXPAND_METHOD_KW 365
-#define _FATAL_ERROR 366
-#define _FORMAT_SIMPLE FORMAT_SIMPLE
-#define _FORMAT_WITH_SPEC FORMAT_WITH_SPEC
-#define _FOR_ITER 367
-#define _FOR_ITER_GEN_FRAME 368
-#define _FOR_ITER_TIER_TWO 369
+#define _EXPAND_DUNDER_CALL 368
+#define _EXPAND_METHOD 369
+#define _EXPAND_METHOD_KW 370
+#define _FATAL_ERROR 371
+#define _FORMAT_SIMPLE 372
+#define _FORMAT_SIMPLE_FLOAT 373
+#define _FORMAT_SIMPLE_INT 374
+#define _FORMAT_SIMPLE_STR 375
+#define _FORMAT_WITH_SPEC 376
+#define _FORMAT_WITH_SPEC_FLOAT 377
+#define _FORMAT_WITH_SPEC_INT 378
+#define _FORMAT_WITH_SPEC_STR 379
+#define _FOR_ITER 380
+#define _FOR_ITER_GEN_FRAME 381
+#define _FOR_ITER_TIER_TWO 382
 #define _GET_AITER GET_AITER
 #define _GET_ANEXT GET_ANEXT
 #define _GET_AWAITABLE GET_AWAITABLE
 #define _GET_ITER GET_ITER
 #define _GET_LEN GET_LEN
 #define _GET_YIELD_FROM_ITER GET_YIELD_FROM_ITER
-#define _GUARD_BINARY_OP_EXTEND 370
-#define _GUARD_DORV_NO_DICT 371
-#define _GUARD_DORV_VALUES_INST_ATTR_FROM_DICT 372
-#define _GUARD_GLOBALS_VERSION 373
-#define _GUARD_IS_FALSE_POP 374
-#define _GUARD_IS_NONE_POP 375
-#define _GUARD_IS_NOT_NONE_POP 376
-#define _GUARD_IS_TRUE_POP 377
-#define _GUARD_KEYS_VERSION 378
-#define _GUARD_NOS_DICT 379
-#define _GUARD_NOS_FLOAT 380
-#define _GUARD_NOS_INT 381
-#define _GUARD_NOS_LIST 382
-#define _GUARD_NOS_TUPLE 383
-#define _GUARD_NOS_UNICODE 384
-#define _GUARD_NOT_EXHAUSTED_LIST 385
-#define _GUARD_NOT_EXHAUSTED_RANGE 386
-#define _GUARD_NOT_EXHAUSTED_TUPLE 387
-#define _GUARD_TOS_ANY_SET 388
-#define _GUARD_TOS_DICT 389
-#define _GUARD_TOS_FLOAT 390
-#define _GUARD_TOS_INT 391
-#define _GUARD_TOS_LIST 392
-#define _GUARD_TOS_TUPLE 393
-#define _GUARD_TOS_UNICODE 394
-#define _GUARD_TYPE_VERSION 395
-#define _GUARD_TYPE_VERSION_AND_LOCK 396
+#define _GUARD_BINARY_OP_EXTEND 383
+#define _GUARD_DORV_NO_DICT 384
+#define _GUARD_DORV_VALUES_INST_ATTR_FROM_DICT 385
+#define _GUARD_GLOBALS_VERSION 386
+#define _GUARD_IS_FALSE_POP 387
+#define _GUARD_IS_NONE_POP 388
+#define _GUARD_IS_NOT_NONE_POP 389
+#define _GUARD_IS_TRUE_POP 390
+#define _GUARD_KEYS_VERSION 391
+#define _GUARD_NOS_DICT 392
+#define _GUARD_NOS_FLOAT 393
+#define _GUARD_NOS_INT 394
+#define _GUARD_NOS_LIST 395
+#define _GUARD_NOS_TUPLE 396
+#define _GUARD_NOS_UNICODE 397
+#define _GUARD_NOT_EXHAUSTED_LIST 398
+#define _GUARD_NOT_EXHAUSTED_RANGE 399
+#define _GUARD_NOT_EXHAUSTED_REVERSED_LIST 400
+#define _GUARD_NOT_EXHAUSTED_TUPLE 401
+#define _GUARD_TOS_ANY_SET 402
+#define _GUARD_TOS_DICT 403
+#define _GUARD_TOS_FLOAT 404
+#define _GUARD_TOS_INT 405
+#define _GUARD_TOS_LIST 406
+#define _GUARD_TOS_TUPLE 407
+#define _GUARD_TOS_UNICODE 408
+#define _GUARD_TYPE_VERSION 409
+#define _GUARD_TYPE_VERSION_AND_LOCK 410
+#define _GUARD_TYPE_VERSION_POLY 411
 #define _IMPORT_FROM IMPORT_FROM
 #define _IMPORT_NAME IMPORT_NAME
-#define _INIT_CALL_BOUND_METHOD_EXACT_ARGS 397
-#define _INIT_CALL_PY_EXACT_ARGS 398
-#define _INIT_CALL_PY_EXACT_ARGS_0 399
-#define _INIT_CALL_PY_EXACT_ARGS_1 400
-#define _INIT_CALL_PY_EXACT_ARGS_2 401
-#define _INIT_CALL_PY_EXACT_ARGS_3 402
-#define _INIT_CALL_PY_EXACT_ARGS_4 403
+#define _INIT_CALL_BOUND_METHOD_EXACT_ARGS 412
+#define _INIT_CALL_PY_EXACT_ARGS 413
+#define _INIT_CALL_PY_EXACT_ARGS_0 414
+#define _INIT_CALL_PY_EXACT_ARGS_1 415
+#define _INIT_CALL_PY_EXACT_ARGS_2 416
+#define _INIT_CALL_PY_EXACT_ARGS_3 417
+#define _INIT_CALL_PY_EXACT_ARGS_4 418
 #define _INSTRUMENTED_FOR_ITER INSTRUMENTED_FOR_ITER
 #define _INSTRUMENTED_INSTRUCTION INSTRUMENTED_INSTRUCTION
 #define _INSTRUMENTED_JUMP_FORWARD INSTRUMENTED_JUMP_FORWARD
@@ -160,163 +173,180 @@ extern "C" {
 #define _INSTRUMENTED_POP_JUMP_IF_NONE INSTRUMENTED_POP_JUMP_IF_NONE
 #define _INSTRUMENTED_POP_JUMP_IF_NOT_NONE INSTRUMENTED_POP_JUMP_IF_NOT_NONE
 #define _INSTRUMENTED_POP_JUMP_IF_TRUE INSTRUMENTED_POP_JUMP_IF_TRUE
-#define _IS_NONE 404
+#define _IS_NONE 419
 #define _IS_OP IS_OP
-#define _ITER_CHECK_LIST 405
-#define _ITER_CHECK_RANGE 406
-#define _ITER_CHECK_TUPLE 407
-#define _ITER_JUMP_LIST 408
-#define _ITER_JUMP_RANGE 409
-#define _ITER_JUMP_TUPLE 410
-#define _ITER_NEXT_LIST 411
-#define _ITER_NEXT_LIST_TIER_TWO 412
-#define _ITER_NEXT_RANGE 413
-#define _ITER_NEXT_TUPLE 414
-#define _JUMP_TO_TOP 415
+#define _ITER_CHECK_DICT_ITEMS 420
+#define _ITER_CHECK_ENUMERATE 421
+#define _ITER_CHECK_LIST 422
+#define _ITER_CHECK_RANGE 423
+#define _ITER_CHECK_REVERSED_LIST 424
+#define _ITER_CHECK_TUPLE 425
+#define _ITER_JUMP_LIST 426
+#define _ITER_JUMP_RANGE 427
+#define _ITER_JUMP_REVERSED_LIST 428
+#define _ITER_JUMP_TUPLE 429
+#define _ITER_NEXT_DICT_ITEMS 430
+#define _ITER_NEXT_DICT_ITEMS_TIER_TWO 431
+#define _ITER_NEXT_DICT_ITEMS_UNPACK 432
+#define _ITER_NEXT_ENUMERATE 433
+#define _ITER_NEXT_ENUMERATE_TIER_TWO 434
+#define _ITER_NEXT_ENUMERATE_UNPACK 435
+#define _ITER_NEXT_LIST 436
+#define _ITER_NEXT_LIST_TIER_TWO 437
+#define _ITER_NEXT_RANGE 438
+#define _ITER_NEXT_REVERSED_LIST 439
+#define _ITER_NEXT_TUPLE 440
+#define _JUMP_TO_TOP 441
 #define _LIST_APPEND LIST_APPEND
 #define _LIST_EXTEND LIST_EXTEND
-#define _LOAD_ATTR 416
-#define _LOAD_ATTR_CLASS 417
+#define _LOAD_ATTR 442
+#define _LOAD_ATTR_CLASS 443
 #define _LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN
-#define _LOAD_ATTR_INSTANCE_VALUE 418
-#define _LOAD_ATTR_METHOD_LAZY_DICT 419
-#define _LOAD_ATTR_METHOD_NO_DICT 420
-#define _LOAD_ATTR_METHOD_WITH_VALUES 421
-#define _LOAD_ATTR_MODULE 422
-#define _LOAD_ATTR_NONDESCRIPTOR_NO_DICT 423
-#define _LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES 424
-#define _LOAD_ATTR_PROPERTY_FRAME 425
-#define _LOAD_ATTR_SLOT 426
-#define _LOAD_ATTR_WITH_HINT 427
+#define _LOAD_ATTR_INSTANCE_VALUE 444
+#define _LOAD_ATTR_INSTANCE_VALUE_INDEX 445
+#define _LOAD_ATTR_METHOD_LAZY_DICT 446
+#define _LOAD_ATTR_METHOD_NO_DICT 447
+#define _LOAD_ATTR_METHOD_WITH_VALUES 448
+#define _LOAD_ATTR_MODULE 449
+#define _LOAD_ATTR_NONDESCRIPTOR_NO_DICT 450
+#define _LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES 451
+#define _LOAD_ATTR_PROPERTY_FRAME 452
+#define _LOAD_ATTR_SLOT 453
+#define _LOAD_ATTR_WITH_HINT 454
 #define _LOAD_BUILD_CLASS LOAD_BUILD_CLASS
-#define _LOAD_BYTECODE 428
+#define _LOAD_BYTECODE 455
 #define _LOAD_COMMON_CONSTANT LOAD_COMMON_CONSTANT
 #define _LOAD_CONST LOAD_CONST
 #define _LOAD_CONST_IMMORTAL LOAD_CONST_IMMORTAL
-#define _LOAD_CONST_INLINE 429
-#define _LOAD_CONST_INLINE_BORROW 430
+#define _LOAD_CONST_INLINE 456
+#define _LOAD_CONST_INLINE_BORROW 457
 #define _LOAD_CONST_MORTAL LOAD_CONST_MORTAL
 #define _LOAD_DEREF LOAD_DEREF
-#define _LOAD_FAST 431
-#define _LOAD_FAST_0 432
-#define _LOAD_FAST_1 433
-#define _LOAD_FAST_2 434
-#define _LOAD_FAST_3 435
-#define _LOAD_FAST_4 436
-#define _LOAD_FAST_5 437
-#define _LOAD_FAST_6 438
-#define _LOAD_FAST_7 439
+#define _LOAD_FAST 458
+#define _LOAD_FAST_0 459
+#define _LOAD_FAST_1 460
+#define _LOAD_FAST_2 461
+#define _LOAD_FAST_3 462
+#define _LOAD_FAST_4 463
+#define _LOAD_FAST_5 464
+#define _LOAD_FAST_6 465
+#define _LOAD_FAST_7 466
 #define _LOAD_FAST_AND_CLEAR LOAD_FAST_AND_CLEAR
-#define _LOAD_FAST_BORROW 440
-#define _LOAD_FAST_BORROW_0 441
-#define _LOAD_FAST_BORROW_1 442
-#define _LOAD_FAST_BORROW_2 443
-#define _LOAD_FAST_BORROW_3 444
-#define _LOAD_FAST_BORROW_4 445
-#define _LOAD_FAST_BORROW_5 446
-#define _LOAD_FAST_BORROW_6 447
-#define _LOAD_FAST_BORROW_7 448
+#define _LOAD_FAST_BORROW 467
+#define _LOAD_FAST_BORROW_0 468
+#define _LOAD_FAST_BORROW_1 469
+#define _LOAD_FAST_BORROW_2 470
+#define _LOAD_FAST_BORROW_3 471
+#define _LOAD_FAST_BORROW_4 472
+#define _LOAD_FAST_BORROW_5 473
+#define _LOAD_FAST_BORROW_6 474
+#define _LOAD_FAST_BORROW_7 475
 #define _LOAD_FAST_BORROW_LOAD_FAST_BORROW LOAD_FAST_BORROW_LOAD_FAST_BORROW
 #define _LOAD_FAST_CHECK LOAD_FAST_CHECK
 #define _LOAD_FAST_LOAD_FAST LOAD_FAST_LOAD_FAST
 #define _LOAD_FROM_DICT_OR_DEREF LOAD_FROM_DICT_OR_DEREF
 #define _LOAD_FROM_DICT_OR_GLOBALS LOAD_FROM_DICT_OR_GLOBALS
-#define _LOAD_GLOBAL 449
-#define _LOAD_GLOBAL_BUILTINS 450
-#define _LOAD_GLOBAL_MODULE 451
+#define _LOAD_GLOBAL 476
+#define _LOAD_GLOBAL_BUILTINS 477
+#define _LOAD_GLOBAL_MODULE 478
 #define _LOAD_LOCALS LOAD_LOCALS
 #define _LOAD_NAME LOAD_NAME
-#define _LOAD_SMALL_INT 452
-#define _LOAD_SMALL_INT_0 453
-#define _LOAD_SMALL_INT_1 454
-#define _LOAD_SMALL_INT_2 455
-#define _LOAD_SMALL_INT_3 456
+#define _LOAD_SMALL_INT 479
+#define _LOAD_SMALL_INT_0 480
+#define _LOAD_SMALL_INT_1 481
+#define _LOAD_SMALL_INT_2 482
+#define _LOAD_SMALL_INT_3 483
 #define _LOAD_SPECIAL LOAD_SPECIAL
 #define _LOAD_SUPER_ATTR_ATTR LOAD_SUPER_ATTR_ATTR
 #define _LOAD_SUPER_ATTR_METHOD LOAD_SUPER_ATTR_METHOD
-#define _MAKE_CALLARGS_A_TUPLE 457
+#define _MAKE_CALLARGS_A_TUPLE 484
 #define _MAKE_CELL MAKE_CELL
 #define _MAKE_FUNCTION MAKE_FUNCTION
-#define _MAKE_WARM 458
+#define _MAKE_WARM 485
 #define _MAP_ADD MAP_ADD
 #define _MATCH_CLASS MATCH_CLASS
 #define _MATCH_KEYS MATCH_KEYS
 #define _MATCH_MAPPING MATCH_MAPPING
 #define _MATCH_SEQUENCE MATCH_SEQUENCE
-#define _MAYBE_EXPAND_METHOD 459
-#define _MAYBE_EXPAND_METHOD_KW 460
-#define _MONITOR_CALL 461
-#define _MONITOR_CALL_KW 462
-#define _MONITOR_JUMP_BACKWARD 463
-#define _MONITOR_RESUME 464
+#define _MAYBE_EXPAND_METHOD 486
+#define _MAYBE_EXPAND_METHOD_KW 487
+#define _MONITOR_CALL 488
+#define _MONITOR_CALL_KW 489
+#define _MONITOR_JUMP_BACKWARD 490
+#define _MONITOR_RESUME 491
 #define _NOP NOP
+#define _POP_CALL_LOAD_ARG 492
+#define _POP_CALL_LOAD_CONST_INLINE 493
 #define _POP_EXCEPT POP_EXCEPT
-#define _POP_JUMP_IF_FALSE 465
-#define _POP_JUMP_IF_TRUE 466
+#define _POP_JUMP_IF_FALSE 494
+#define _POP_JUMP_IF_TRUE 495
 #define _POP_TOP POP_TOP
-#define _POP_TOP_LOAD_CONST_INLINE 467
-#define _POP_TOP_LOAD_CONST_INLINE_BORROW 468
-#define _POP_TWO_LOAD_CONST_INLINE_BORROW 469
+#define _POP_TOP_LOAD_CONST_INLINE 496
+#define _POP_TOP_LOAD_CONST_INLINE_BORROW 497
+#define _POP_TWO_LOAD_CONST_INLINE_BORROW 498
 #define _PUSH_EXC_INFO PUSH_EXC_INFO
-#define _PUSH_FRAME 470
+#define _PUSH_FRAME 499
 #define _PUSH_NULL PUSH_NULL
-#define _PUSH_NULL_CONDITIONAL 471
-#define _PY_FRAME_GENERAL 472
-#define _PY_FRAME_KW 473
-#define _QUICKEN_RESUME 474
-#define _REPLACE_WITH_TRUE 475
+#define _PUSH_NULL_CONDITIONAL 500
+#define _PY_FRAME_GENERAL 501
+#define _PY_FRAME_KW 502
+#define _QUICKEN_RESUME 503
+#define _REPLACE_WITH_TRUE 504
 #define _RESUME_CHECK RESUME_CHECK
 #define _RETURN_GENERATOR RETURN_GENERATOR
 #define _RETURN_VALUE RETURN_VALUE
-#define _SAVE_RETURN_OFFSET 476
-#define _SEND 477
-#define _SEND_GEN_FRAME 478
+#define _REVERSE 505
+#define _SAVE_RETURN_OFFSET 506
+#define _SEND 507
+#define _SEND_GEN_FRAME 508
 #define _SETUP_ANNOTATIONS SETUP_ANNOTATIONS
 #define _SET_ADD SET_ADD
 #define _SET_FUNCTION_ATTRIBUTE SET_FUNCTION_ATTRIBUTE
 #define _SET_UPDATE SET_UPDATE
-#define _START_EXECUTOR 479
-#define _STORE_ATTR 480
-#define _STORE_ATTR_INSTANCE_VALUE 481
-#define _STORE_ATTR_SLOT 482
-#define _STORE_ATTR_WITH_HINT 483
+#define _START_EXECUTOR 509
+#define _STORE_ATTR 510
+#define _STORE_ATTR_INSTANCE_VALUE 511
+#define _STORE_ATTR_PROPERTY 512
+#define _STORE_ATTR_SETATTR_OVERRIDDEN 513
+#define _STORE_ATTR_SLOT 514
+#define _STORE_ATTR_WITH_HINT 515
 #define _STORE_DEREF STORE_DEREF
-#define _STORE_FAST 484
-#define _STORE_FAST_0 485
-#define _STORE_FAST_1 486
-#define _STORE_FAST_2 487
-#define _STORE_FAST_3 488
-#define _STORE_FAST_4 489
-#define _STORE_FAST_5 490
-#define _STORE_FAST_6 491
-#define _STORE_FAST_7 492
+#define _STORE_FAST 516
+#define _STORE_FAST_0 517
+#define _STORE_FAST_1 518
+#define _STORE_FAST_2 519
+#define _STORE_FAST_3 520
+#define _STORE_FAST_4 521
+#define _STORE_FAST_5 522
+#define _STORE_FAST_6 523
+#define _STORE_FAST_7 524
 #define _STORE_FAST_LOAD_FAST STORE_FAST_LOAD_FAST
 #define _STORE_FAST_STORE_FAST STORE_FAST_STORE_FAST
 #define _STORE_GLOBAL STORE_GLOBAL
 #define _STORE_NAME STORE_NAME
-#define _STORE_SLICE 493
-#define _STORE_SUBSCR 494
-#define _STORE_SUBSCR_DICT 495
-#define _STORE_SUBSCR_LIST_INT 496
+#define _STORE_SLICE 525
+#define _STORE_SUBSCR 526
+#define _STORE_SUBSCR_DICT 527
+#define _STORE_SUBSCR_LIST_INT 528
 #define _SWAP SWAP
-#define _TIER2_RESUME_CHECK 497
-#define _TO_BOOL 498
+#define _TIER2_RESUME_CHECK 529
+#define _TO_BOOL 530
 #define _TO_BOOL_BOOL TO_BOOL_BOOL
 #define _TO_BOOL_INT TO_BOOL_INT
-#define _TO_BOOL_LIST 499
+#define _TO_BOOL_LIST 531
 #define _TO_BOOL_NONE TO_BOOL_NONE
-#define _TO_BOOL_STR 500
+#define _TO_BOOL_STR 532
 #define _UNARY_INVERT UNARY_INVERT
 #define _UNARY_NEGATIVE UNARY_NEGATIVE
 #define _UNARY_NOT UNARY_NOT
 #define _UNPACK_EX UNPACK_EX
-#define _UNPACK_SEQUENCE 501
-#define _UNPACK_SEQUENCE_LIST 502
-#define _UNPACK_SEQUENCE_TUPLE 503
-#define _UNPACK_SEQUENCE_TWO_TUPLE 504
+#define _UNPACK_SEQUENCE 533
+#define _UNPACK_SEQUENCE_LIST 534
+#define _UNPACK_SEQUENCE_TUPLE 535
+#define _UNPACK_SEQUENCE_TWO_TUPLE 536
 #define _WITH_EXCEPT_START WITH_EXCEPT_START
 #define _YIELD_VALUE YIELD_VALUE
-#define MAX_UOP_ID 504
+#define MAX_UOP_ID 536
 
 #ifdef __cplusplus
 }
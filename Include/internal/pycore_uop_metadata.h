@@ -98,7 +98,7 @@ const uint16_t _PyUop_Flags[MAX_UOP_ID+1] = {
     [_BINARY_SLICE] = HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_STORE_SLICE] = HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_BINARY_OP_SUBSCR_LIST_INT] = HAS_DEOPT_FLAG | HAS_ESCAPES_FLAG,
-    [_BINARY_OP_SUBSCR_STR_INT] = HAS_DEOPT_FLAG | HAS_ESCAPES_FLAG,
+    [_BINARY_OP_SUBSCR_STR_INT] = HAS_DEOPT_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_GUARD_NOS_TUPLE] = HAS_EXIT_FLAG,
     [_GUARD_TOS_TUPLE] = HAS_EXIT_FLAG,
     [_BINARY_OP_SUBSCR_TUPLE_INT] = HAS_DEOPT_FLAG,
@@ -167,6 +167,8 @@ const uint16_t _PyUop_Flags[MAX_UOP_ID+1] = {
     [_GUARD_TYPE_VERSION_AND_LOCK] = HAS_EXIT_FLAG,
     [_CHECK_MANAGED_OBJECT_HAS_VALUES] = HAS_DEOPT_FLAG,
     [_LOAD_ATTR_INSTANCE_VALUE] = HAS_DEOPT_FLAG | HAS_ESCAPES_FLAG,
+    [_GUARD_TYPE_VERSION_POLY] = HAS_EXIT_FLAG,
+    [_LOAD_ATTR_INSTANCE_VALUE_INDEX] = HAS_DEOPT_FLAG | HAS_ESCAPES_FLAG,
     [_LOAD_ATTR_MODULE] = HAS_DEOPT_FLAG | HAS_ESCAPES_FLAG,
     [_LOAD_ATTR_WITH_HINT] = HAS_ARG_FLAG | HAS_NAME_FLAG | HAS_DEOPT_FLAG | HAS_ESCAPES_FLAG,
     [_LOAD_ATTR_SLOT] = HAS_DEOPT_FLAG,
@@ -177,15 +179,20 @@ const uint16_t _PyUop_Flags[MAX_UOP_ID+1] = {
     [_STORE_ATTR_INSTANCE_VALUE] = HAS_ESCAPES_FLAG,
     [_STORE_ATTR_WITH_HINT] = HAS_ARG_FLAG | HAS_NAME_FLAG | HAS_DEOPT_FLAG | HAS_ESCAPES_FLAG,
     [_STORE_ATTR_SLOT] = HAS_DEOPT_FLAG | HAS_ESCAPES_FLAG,
+    [_STORE_ATTR_PROPERTY] = HAS_ARG_FLAG | HAS_NAME_FLAG | HAS_DEOPT_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
+    [_STORE_ATTR_SETATTR_OVERRIDDEN] = HAS_ARG_FLAG | HAS_NAME_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_COMPARE_OP] = HAS_ARG_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_COMPARE_OP_FLOAT] = HAS_ARG_FLAG,
     [_COMPARE_OP_INT] = HAS_ARG_FLAG | HAS_DEOPT_FLAG,
+    [_COMPARE_OP_FLOAT_INT] = HAS_ARG_FLAG | HAS_DEOPT_FLAG,
+    [_COMPARE_OP_INT_FLOAT] = HAS_ARG_FLAG | HAS_DEOPT_FLAG,
     [_COMPARE_OP_STR] = HAS_ARG_FLAG,
     [_IS_OP] = HAS_ARG_FLAG,
     [_CONTAINS_OP] = HAS_ARG_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_GUARD_TOS_ANY_SET] = HAS_DEOPT_FLAG,
     [_CONTAINS_OP_SET] = HAS_ARG_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_CONTAINS_OP_DICT] = HAS_ARG_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
+    [_CONTAINS_OP_STR_TUPLE] = HAS_ARG_FLAG | HAS_DEOPT_FLAG,
     [_CHECK_EG_MATCH] = HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_CHECK_EXC_MATCH] = HAS_ERROR_FLAG | HAS_ERROR_NO_POP_FLAG | HAS_ESCAPES_FLAG,
     [_IMPORT_NAME] = HAS_ARG_FLAG | HAS_NAME_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
@@ -209,6 +216,15 @@ const uint16_t _PyUop_Flags[MAX_UOP_ID+1] = {
     [_GUARD_NOT_EXHAUSTED_RANGE] = HAS_EXIT_FLAG,
     [_ITER_NEXT_RANGE] = HAS_ERROR_FLAG,
     [_FOR_ITER_GEN_FRAME] = HAS_ARG_FLAG | HAS_DEOPT_FLAG,
+    [_ITER_CHECK_DICT_ITEMS] = HAS_EXIT_FLAG,
+    [_ITER_NEXT_DICT_ITEMS_TIER_TWO] = HAS_EXIT_FLAG | HAS_ERROR_FLAG | HAS_ERROR_NO_POP_FLAG | HAS_ESCAPES_FLAG,
+    [_ITER_NEXT_DICT_ITEMS_UNPACK] = HAS_EXIT_FLAG | HAS_ERROR_FLAG | HAS_ERROR_NO_POP_FLAG | HAS_ESCAPES_FLAG,
+    [_ITER_CHECK_ENUMERATE] = HAS_EXIT_FLAG,
+    [_ITER_NEXT_ENUMERATE_TIER_TWO] = HAS_EXIT_FLAG | HAS_ERROR_FLAG | HAS_ERROR_NO_POP_FLAG | HAS_ESCAPES_FLAG,
+    [_ITER_NEXT_ENUMERATE_UNPACK] = HAS_EXIT_FLAG | HAS_ERROR_FLAG | HAS_ERROR_NO_POP_FLAG | HAS_ESCAPES_FLAG,
+    [_ITER_CHECK_REVERSED_LIST] = HAS_EXIT_FLAG,
+    [_GUARD_NOT_EXHAUSTED_REVERSED_LIST] = HAS_EXIT_FLAG,
+    [_ITER_NEXT_REVERSED_LIST] = 0,
     [_LOAD_SPECIAL] = HAS_ARG_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_WITH_EXCEPT_START] = HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_PUSH_EXC_INFO] = 0,
@@ -226,6 +242,8 @@ const uint16_t _PyUop_Flags[MAX_UOP_ID+1] = {
     [_CHECK_FUNCTION_VERSION_INLINE] = HAS_EXIT_FLAG,
     [_CHECK_METHOD_VERSION] = HAS_ARG_FLAG | HAS_EXIT_FLAG,
     [_EXPAND_METHOD] = HAS_ARG_FLAG | HAS_ESCAPES_FLAG,
+    [_CHECK_DUNDER_CALL] = HAS_ARG_FLAG | HAS_EXIT_FLAG,
+    [_EXPAND_DUNDER_CALL] = HAS_ARG_FLAG,
     [_CHECK_IS_NOT_PY_CALLABLE] = HAS_ARG_FLAG | HAS_EXIT_FLAG,
     [_CALL_NON_PY_GENERAL] = HAS_ARG_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_CHECK_CALL_BOUND_METHOD_EXACT_ARGS] = HAS_ARG_FLAG | HAS_EXIT_FLAG,
@@ -271,7 +289,13 @@ const uint16_t _PyUop_Flags[MAX_UOP_ID+1] = {
     [_BUILD_SLICE] = HAS_ARG_FLAG | HAS_ERROR_FLAG,
     [_CONVERT_VALUE] = HAS_ARG_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_FORMAT_SIMPLE] = HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
+    [_FORMAT_SIMPLE_STR] = 0,
+    [_FORMAT_SIMPLE_INT] = HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
+    [_FORMAT_SIMPLE_FLOAT] = HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_FORMAT_WITH_SPEC] = HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
+    [_FORMAT_WITH_SPEC_STR] = HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
+    [_FORMAT_WITH_SPEC_INT] = HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
+    [_FORMAT_WITH_SPEC_FLOAT] = HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_COPY] = HAS_ARG_FLAG | HAS_PURE_FLAG,
     [_BINARY_OP] = HAS_ARG_FLAG | HAS_ERROR_FLAG | HAS_ERROR_NO_POP_FLAG | HAS_ESCAPES_FLAG,
     [_SWAP] = HAS_ARG_FLAG | HAS_PURE_FLAG,
@@ -290,6 +314,9 @@ const uint16_t _PyUop_Flags[MAX_UOP_ID+1] = {
     [_LOAD_CONST_INLINE_BORROW] = HAS_PURE_FLAG,
     [_POP_TOP_LOAD_CONST_INLINE_BORROW] = HAS_ESCAPES_FLAG | HAS_PURE_FLAG,
     [_POP_TWO_LOAD_CONST_INLINE_BORROW] = HAS_ESCAPES_FLAG | HAS_PURE_FLAG,
+    [_REVERSE] = HAS_ARG_FLAG | HAS_PURE_FLAG,
+    [_POP_CALL_LOAD_CONST_INLINE] = HAS_ARG_FLAG | HAS_ESCAPES_FLAG,
+    [_POP_CALL_LOAD_ARG] = HAS_ARG_FLAG | HAS_ESCAPES_FLAG,
     [_CHECK_FUNCTION] = HAS_DEOPT_FLAG,
     [_START_EXECUTOR] = HAS_ESCAPES_FLAG,
     [_MAKE_WARM] = 0,
@@ -353,6 +380,7 @@ const char *const _PyOpcode_uop_name[MAX_UOP_ID+1] = {
     [_CHECK_ATTR_CLASS] = "_CHECK_ATTR_CLASS",
     [_CHECK_ATTR_METHOD_LAZY_DICT] = "_CHECK_ATTR_METHOD_LAZY_DICT",
     [_CHECK_CALL_BOUND_METHOD_EXACT_ARGS] = "_CHECK_CALL_BOUND_METHOD_EXACT_ARGS",
+    [_CHECK_DUNDER_CALL] = "_CHECK_DUNDER_CALL",
     [_CHECK_EG_MATCH] = "_CHECK_EG_MATCH",
     [_CHECK_EXC_MATCH] = "_CHECK_EXC_MATCH",
     [_CHECK_FUNCTION] = "_CHECK_FUNCTION",
@@ -373,11 +401,14 @@ const char *const _PyOpcode_uop_name[MAX_UOP_ID+1] = {
     [_CHECK_VALIDITY] = "_CHECK_VALIDITY",
     [_COMPARE_OP] = "_COMPARE_OP",
     [_COMPARE_OP_FLOAT] = "_COMPARE_OP_FLOAT",
+    [_COMPARE_OP_FLOAT_INT] = "_COMPARE_OP_FLOAT_INT",
     [_COMPARE_OP_INT] = "_COMPARE_OP_INT",
+    [_COMPARE_OP_INT_FLOAT] = "_COMPARE_OP_INT_FLOAT",
     [_COMPARE_OP_STR] = "_COMPARE_OP_STR",
     [_CONTAINS_OP] = "_CONTAINS_OP",
     [_CONTAINS_OP_DICT] = "_CONTAINS_OP_DICT",
     [_CONTAINS_OP_SET] = "_CONTAINS_OP_SET",
+    [_CONTAINS_OP_STR_TUPLE] = "_CONTAINS_OP_STR_TUPLE",
     [_CONVERT_VALUE] = "_CONVERT_VALUE",
     [_COPY] = "_COPY",
     [_COPY_FREE_VARS] = "_COPY_FREE_VARS",
@@ -396,11 +427,18 @@ const char *const _PyOpcode_uop_name[MAX_UOP_ID+1] = {
     [_ERROR_POP_N] = "_ERROR_POP_N",
     [_EXIT_INIT_CHECK] = "_EXIT_INIT_CHECK",
     [_EXIT_TRACE] = "_EXIT_TRACE",
+    [_EXPAND_DUNDER_CALL] = "_EXPAND_DUNDER_CALL",
     [_EXPAND_METHOD] = "_EXPAND_METHOD",
     [_EXPAND_METHOD_KW] = "_EXPAND_METHOD_KW",
     [_FATAL_ERROR] = "_FATAL_ERROR",
     [_FORMAT_SIMPLE] = "_FORMAT_SIMPLE",
+    [_FORMAT_SIMPLE_FLOAT] = "_FORMAT_SIMPLE_FLOAT",
+    [_FORMAT_SIMPLE_INT] = "_FORMAT_SIMPLE_INT",
+    [_FORMAT_SIMPLE_STR] = "_FORMAT_SIMPLE_STR",
     [_FORMAT_WITH_SPEC] = "_FORMAT_WITH_SPEC",
+    [_FORMAT_WITH_SPEC_FLOAT] = "_FORMAT_WITH_SPEC_FLOAT",
+    [_FORMAT_WITH_SPEC_INT] = "_FORMAT_WITH_SPEC_INT",
+    [_FORMAT_WITH_SPEC_STR] = "_FORMAT_WITH_SPEC_STR",
     [_FOR_ITER_GEN_FRAME] = "_FOR_ITER_GEN_FRAME",
     [_FOR_ITER_TIER_TWO] = "_FOR_ITER_TIER_TWO",
     [_GET_AITER] = "_GET_AITER",
@@ -426,6 +464,7 @@ const char *const _PyOpcode_uop_name[MAX_UOP_ID+1] = {
     [_GUARD_NOS_UNICODE] = "_GUARD_NOS_UNICODE",
     [_GUARD_NOT_EXHAUSTED_LIST] = "_GUARD_NOT_EXHAUSTED_LIST",
     [_GUARD_NOT_EXHAUSTED_RANGE] = "_GUARD_NOT_EXHAUSTED_RANGE",
+    [_GUARD_NOT_EXHAUSTED_REVERSED_LIST] = "_GUARD_NOT_EXHAUSTED_REVERSED_LIST",
     [_GUARD_NOT_EXHAUSTED_TUPLE] = "_GUARD_NOT_EXHAUSTED_TUPLE",
     [_GUARD_TOS_ANY_SET] = "_GUARD_TOS_ANY_SET",
     [_GUARD_TOS_DICT] = "_GUARD_TOS_DICT",
@@ -436,6 +475,7 @@ const char *const _PyOpcode_uop_name[MAX_UOP_ID+1] = {
     [_GUARD_TOS_UNICODE] = "_GUARD_TOS_UNICODE",
     [_GUARD_TYPE_VERSION] = "_GUARD_TYPE_VERSION",
     [_GUARD_TYPE_VERSION_AND_LOCK] = "_GUARD_TYPE_VERSION_AND_LOCK",
+    [_GUARD_TYPE_VERSION_POLY] = "_GUARD_TYPE_VERSION_POLY",
     [_IMPORT_FROM] = "_IMPORT_FROM",
     [_IMPORT_NAME] = "_IMPORT_NAME",
     [_INIT_CALL_BOUND_METHOD_EXACT_ARGS] = "_INIT_CALL_BOUND_METHOD_EXACT_ARGS",
@@ -447,11 +487,19 @@ const char *const _PyOpcode_uop_name[MAX_UOP_ID+1] = {
     [_INIT_CALL_PY_EXACT_ARGS_4] = "_INIT_CALL_PY_EXACT_ARGS_4",
     [_IS_NONE] = "_IS_NONE",
     [_IS_OP] = "_IS_OP",
+    [_ITER_CHECK_DICT_ITEMS] = "_ITER_CHECK_DICT_ITEMS",
+    [_ITER_CHECK_ENUMERATE] = "_ITER_CHECK_ENUMERATE",
     [_ITER_CHECK_LIST] = "_ITER_CHECK_LIST",
     [_ITER_CHECK_RANGE] = "_ITER_CHECK_RANGE",
+    [_ITER_CHECK_REVERSED_LIST] = "_ITER_CHECK_REVERSED_LIST",
     [_ITER_CHECK_TUPLE] = "_ITER_CHECK_TUPLE",
+    [_ITER_NEXT_DICT_ITEMS_TIER_TWO] = "_ITER_NEXT_DICT_ITEMS_TIER_TWO",
+    [_ITER_NEXT_DICT_ITEMS_UNPACK] = "_ITER_NEXT_DICT_ITEMS_UNPACK",
+    [_ITER_NEXT_ENUMERATE_TIER_TWO] = "_ITER_NEXT_ENUMERATE_TIER_TWO",
+    [_ITER_NEXT_ENUMERATE_UNPACK] = "_ITER_NEXT_ENUMERATE_UNPACK",
     [_ITER_NEXT_LIST_TIER_TWO] = "_ITER_NEXT_LIST_TIER_TWO",
     [_ITER_NEXT_RANGE] = "_ITER_NEXT_RANGE",
+    [_ITER_NEXT_REVERSED_LIST] = "_ITER_NEXT_REVERSED_LIST",
     [_ITER_NEXT_TUPLE] = "_ITER_NEXT_TUPLE",
     [_JUMP_TO_TOP] = "_JUMP_TO_TOP",
     [_LIST_APPEND] = "_LIST_APPEND",
@@ -459,6 +507,7 @@ const char *const _PyOpcode_uop_name[MAX_UOP_ID+1] = {
     [_LOAD_ATTR] = "_LOAD_ATTR",
     [_LOAD_ATTR_CLASS] = "_LOAD_ATTR_CLASS",
     [_LOAD_ATTR_INSTANCE_VALUE] = "_LOAD_ATTR_INSTANCE_VALUE",
+    [_LOAD_ATTR_INSTANCE_VALUE_INDEX] = "_LOAD_ATTR_INSTANCE_VALUE_INDEX",
     [_LOAD_ATTR_METHOD_LAZY_DICT] = "_LOAD_ATTR_METHOD_LAZY_DICT",
     [_LOAD_ATTR_METHOD_NO_DICT] = "_LOAD_ATTR_METHOD_NO_DICT",
     [_LOAD_ATTR_METHOD_WITH_VALUES] = "_LOAD_ATTR_METHOD_WITH_VALUES",
@@ -523,6 +572,8 @@ const char *const _PyOpcode_uop_name[MAX_UOP_ID+1] = {
     [_MAYBE_EXPAND_METHOD] = "_MAYBE_EXPAND_METHOD",
     [_MAYBE_EXPAND_METHOD_KW] = "_MAYBE_EXPAND_METHOD_KW",
     [_NOP] = "_NOP",
+    [_POP_CALL_LOAD_ARG] = "_POP_CALL_LOAD_ARG",
+    [_POP_CALL_LOAD_CONST_INLINE] = "_POP_CALL_LOAD_CONST_INLINE",
     [_POP_EXCEPT] = "_POP_EXCEPT",
     [_POP_TOP] = "_POP_TOP",
     [_POP_TOP_LOAD_CONST_INLINE] = "_POP_TOP_LOAD_CONST_INLINE",
@@ -538,6 +589,7 @@ const char *const _PyOpcode_uop_name[MAX_UOP_ID+1] = {
     [_RESUME_CHECK] = "_RESUME_CHECK",
     [_RETURN_GENERATOR] = "_RETURN_GENERATOR",
     [_RETURN_VALUE] = "_RETURN_VALUE",
+    [_REVERSE] = "_REVERSE",
     [_SAVE_RETURN_OFFSET] = "_SAVE_RETURN_OFFSET",
     [_SEND_GEN_FRAME] = "_SEND_GEN_FRAME",
     [_SETUP_ANNOTATIONS] = "_SETUP_ANNOTATIONS",
@@ -548,6 +600,8 @@ const char *const _PyOpcode_uop_name[MAX_UOP_ID+1] = {
     [_START_EXECUTOR] = "_START_EXECUTOR",
     [_STORE_ATTR] = "_STORE_ATTR",
     [_STORE_ATTR_INSTANCE_VALUE] = "_STORE_ATTR_INSTANCE_VALUE",
+    [_STORE_ATTR_PROPERTY] = "_STORE_ATTR_PROPERTY",
+    [_STORE_ATTR_SETATTR_OVERRIDDEN] = "_STORE_ATTR_SETATTR_OVERRIDDEN",
     [_STORE_ATTR_SLOT] = "_STORE_ATTR_SLOT",
     [_STORE_ATTR_WITH_HINT] = "_STORE_ATTR_WITH_HINT",
     [_STORE_DEREF] = "_STORE_DEREF",
@@ -886,6 +940,10 @@ int _PyUop_num_popped(int opcode, int oparg)
             return 0;
         case _LOAD_ATTR_INSTANCE_VALUE:
             return 1;
+        case _GUARD_TYPE_VERSION_POLY:
+            return 0;
+        case _LOAD_ATTR_INSTANCE_VALUE_INDEX:
+            return 1;
         case _LOAD_ATTR_MODULE:
             return 1;
         case _LOAD_ATTR_WITH_HINT:
@@ -906,12 +964,20 @@ int _PyUop_num_popped(int opcode, int oparg)
             return 2;
         case _STORE_ATTR_SLOT:
             return 2;
+        case _STORE_ATTR_PROPERTY:
+            return 2;
+        case _STORE_ATTR_SETATTR_OVERRIDDEN:
+            return 2;
         case _COMPARE_OP:
             return 2;
         case _COMPARE_OP_FLOAT:
             return 2;
         case _COMPARE_OP_INT:
             return 2;
+        case _COMPARE_OP_FLOAT_INT:
+            return 2;
+        case _COMPARE_OP_INT_FLOAT:
+            return 2;
         case _COMPARE_OP_STR:
             return 2;
         case _IS_OP:
@@ -924,6 +990,8 @@ int _PyUop_num_popped(int opcode, int oparg)
             return 2;
         case _CONTAINS_OP_DICT:
             return 2;
+        case _CONTAINS_OP_STR_TUPLE:
+            return 2;
         case _CHECK_EG_MATCH:
             return 2;
         case _CHECK_EXC_MATCH:
@@ -970,6 +1038,24 @@ int _PyUop_num_popped(int opcode, int oparg)
             return 0;
         case _FOR_ITER_GEN_FRAME:
             return 0;
+        case _ITER_CHECK_DICT_ITEMS:
+            return 0;
+        case _ITER_NEXT_DICT_ITEMS_TIER_TWO:
+            return 0;
+        case _ITER_NEXT_DICT_ITEMS_UNPACK:
+            return 0;
+        case _ITER_CHECK_ENUMERATE:
+            return 0;
+        case _ITER_NEXT_ENUMERATE_TIER_TWO:
+            return 0;
+        case _ITER_NEXT_ENUMERATE_UNPACK:
+            return 0;
+        case _ITER_CHECK_REVERSED_LIST:
+            return 0;
+        case _GUARD_NOT_EXHAUSTED_REVERSED_LIST:
+            return 0;
+        case _ITER_NEXT_REVERSED_LIST:
+            return 0;
         case _LOAD_SPECIAL:
             return 1;
         case _WITH_EXCEPT_START:
@@ -1004,6 +1090,10 @@ int _PyUop_num_popped(int opcode, int oparg)
             return 0;
         case _EXPAND_METHOD:
             return 0;
+        case _CHECK_DUNDER_CALL:
+            return 0;
+        case _EXPAND_DUNDER_CALL:
+            return 0;
         case _CHECK_IS_NOT_PY_CALLABLE:
             return 0;
         case _CALL_NON_PY_GENERAL:
@@ -1094,8 +1184,20 @@ int _PyUop_num_popped(int opcode, int oparg)
             return 1;
         case _FORMAT_SIMPLE:
             return 1;
+        case _FORMAT_SIMPLE_STR:
+            return 1;
+        case _FORMAT_SIMPLE_INT:
+            return 1;
+        case _FORMAT_SIMPLE_FLOAT:
+            return 1;
         case _FORMAT_WITH_SPEC:
             return 2;
+        case _FORMAT_WITH_SPEC_STR:
+            return 2;
+        case _FORMAT_WITH_SPEC_INT:
+            return 2;
+        case _FORMAT_WITH_SPEC_FLOAT:
+            return 2;
         case _COPY:
             return 0;
         case _BINARY_OP:
@@ -1132,6 +1234,12 @@ int _PyUop_num_popped(int opcode, int oparg)
             return 1;
         case _POP_TWO_LOAD_CONST_INLINE_BORROW:
             return 2;
+        case _REVERSE:
+            return 0;
+        case _POP_CALL_LOAD_CONST_INLINE:
+            return 2 + oparg;
+        case _POP_CALL_LOAD_ARG:
+            return 2 + oparg;
         case _CHECK_FUNCTION:
             return 0;
         case _START_EXECUTOR:
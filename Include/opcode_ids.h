@@ -150,68 +150,84 @@ extern "C" {
 #define CALL_BUILTIN_FAST                      146
 #define CALL_BUILTIN_FAST_WITH_KEYWORDS        147
 #define CALL_BUILTIN_O                         148
-#define CALL_ISINSTANCE                        149
-#define CALL_KW_BOUND_METHOD                   150
-#define CALL_KW_NON_PY                         151
-#define CALL_KW_PY                             152
-#define CALL_LEN                               153
-#define CALL_LIST_APPEND                       154
-#define CALL_METHOD_DESCRIPTOR_FAST            155
-#define CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS 156
-#define CALL_METHOD_DESCRIPTOR_NOARGS          157
-#define CALL_METHOD_DESCRIPTOR_O               158
-#define CALL_NON_PY_GENERAL                    159
-#define CALL_PY_EXACT_ARGS                     160
-#define CALL_PY_GENERAL                        161
-#define CALL_STR_1                             162
-#define CALL_TUPLE_1                           163
-#define CALL_TYPE_1                            164
-#define COMPARE_OP_FLOAT                       165
-#define COMPARE_OP_INT                         166
-#define COMPARE_OP_STR                         167
-#define CONTAINS_OP_DICT                       168
-#define CONTAINS_OP_SET                        169
-#define FOR_ITER_GEN                           170
-#define FOR_ITER_LIST                          171
-#define FOR_ITER_RANGE                         172
-#define FOR_ITER_TUPLE                         173
-#define JUMP_BACKWARD_JIT                      174
-#define JUMP_BACKWARD_NO_JIT                   175
-#define LOAD_ATTR_CLASS                        176
-#define LOAD_ATTR_CLASS_WITH_METACLASS_CHECK   177
-#define LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN      178
-#define LOAD_ATTR_INSTANCE_VALUE               179
-#define LOAD_ATTR_METHOD_LAZY_DICT             180
-#define LOAD_ATTR_METHOD_NO_DICT               181
-#define LOAD_ATTR_METHOD_WITH_VALUES           182
-#define LOAD_ATTR_MODULE                       183
-#define LOAD_ATTR_NONDESCRIPTOR_NO_DICT        184
-#define LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES    185
-#define LOAD_ATTR_PROPERTY                     186
-#define LOAD_ATTR_SLOT                         187
-#define LOAD_ATTR_WITH_HINT                    188
-#define LOAD_CONST_IMMORTAL                    189
-#define LOAD_CONST_MORTAL                      190
-#define LOAD_GLOBAL_BUILTIN                    191
-#define LOAD_GLOBAL_MODULE                     192
-#define LOAD_SUPER_ATTR_ATTR                   193
-#define LOAD_SUPER_ATTR_METHOD                 194
-#define RESUME_CHECK                           195
-#define SEND_GEN                               196
-#define STORE_ATTR_INSTANCE_VALUE              197
-#define STORE_ATTR_SLOT                        198
-#define STORE_ATTR_WITH_HINT                   199
-#define STORE_SUBSCR_DICT                      200
-#define STORE_SUBSCR_LIST_INT                  201
-#define TO_BOOL_ALWAYS_TRUE                    202
-#define TO_BOOL_BOOL                           203
-#define TO_BOOL_INT                            204
-#define TO_BOOL_LIST                           205
-#define TO_BOOL_NONE                           206
-#define TO_BOOL_STR                            207
-#define UNPACK_SEQUENCE_LIST                   208
-#define UNPACK_SEQUENCE_TUPLE                  209
-#define UNPACK_SEQUENCE_TWO_TUPLE              210
+#define CALL_DUNDER_CALL                       149
+#define CALL_ISINSTANCE                        150
+#define CALL_KW_BOUND_METHOD                   151
+#define CALL_KW_NON_PY                         152
+#define CALL_KW_PY                             153
+#define CALL_LEN                               154
+#define CALL_LIST_APPEND                       155
+#define CALL_METHOD_DESCRIPTOR_FAST            156
+#define CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS 157
+#define CALL_METHOD_DESCRIPTOR_NOARGS          158
+#define CALL_METHOD_DESCRIPTOR_O               159
+#define CALL_NON_PY_GENERAL                    160
+#define CALL_PY_EXACT_ARGS                     161
+#define CALL_PY_GENERAL                        162
+#define CALL_STR_1                             163
+#define CALL_TUPLE_1                           164
+#define CALL_TYPE_1                            165
+#define COMPARE_OP_FLOAT                       166
+#define COMPARE_OP_FLOAT_INT                   167
+#define COMPARE_OP_INT                         168
+#define COMPARE_OP_INT_FLOAT                   169
+#define COMPARE_OP_STR                         170
+#define CONTAINS_OP_DICT                       171
+#define CONTAINS_OP_SET                        172
+#define CONTAINS_OP_STR_TUPLE                  173
+#define FORMAT_SIMPLE_FLOAT                    174
+#define FORMAT_SIMPLE_INT                      175
+#define FORMAT_SIMPLE_STR                      176
+#define FORMAT_WITH_SPEC_FLOAT                 177
+#define FORMAT_WITH_SPEC_INT                   178
+#define FORMAT_WITH_SPEC_STR                   179
+#define FOR_ITER_DICT_ITEMS                    180
+#define FOR_ITER_ENUMERATE                     181
+#define FOR_ITER_GEN                           182
+#define FOR_ITER_LIST                          183
+#define FOR_ITER_RANGE                         184
+#define FOR_ITER_REVERSED_LIST                 185
+#define FOR_ITER_TUPLE                         186
+#define JUMP_BACKWARD_JIT                      187
+#define JUMP_BACKWARD_NO_JIT                   188
+#define LOAD_ATTR_CLASS                        189
+#define LOAD_ATTR_CLASS_WITH_METACLASS_CHECK   190
+#define LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN      191
+#define LOAD_ATTR_INSTANCE_VALUE               192
+#define LOAD_ATTR_INSTANCE_VALUE_POLY          193
+#define LOAD_ATTR_METHOD_LAZY_DICT             194
+#define LOAD_ATTR_METHOD_NO_DICT               195
+#define LOAD_ATTR_METHOD_WITH_VALUES           196
+#define LOAD_ATTR_MODULE                       197
+#define LOAD_ATTR_NONDESCRIPTOR_NO_DICT        198
+#define LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES    199
+#define LOAD_ATTR_PROPERTY                     200
+#define LOAD_ATTR_SLOT                         201
+#define LOAD_ATTR_WITH_HINT                    202
+#define LOAD_CONST_IMMORTAL                    203
+#define LOAD_CONST_MORTAL                      204
+#define LOAD_GLOBAL_BUILTIN                    205
+#define LOAD_GLOBAL_MODULE                     206
+#define LOAD_SUPER_ATTR_ATTR                   207
+#define LOAD_SUPER_ATTR_METHOD                 208
+#define RESUME_CHECK                           209
+#define SEND_GEN                               210
+#define STORE_ATTR_INSTANCE_VALUE              211
+#define STORE_ATTR_PROPERTY                    212
+#define STORE_ATTR_SETATTR_OVERRIDDEN          213
+#define STORE_ATTR_SLOT                        214
+#define STORE_ATTR_WITH_HINT                   215
+#define STORE_SUBSCR_DICT                      216
+#define STORE_SUBSCR_LIST_INT                  217
+#define TO_BOOL_ALWAYS_TRUE                    218
+#define TO_BOOL_BOOL                           219
+#define TO_BOOL_INT                            220
+#define TO_BOOL_LIST                           221
+#define TO_BOOL_NONE                           222
+#define TO_BOOL_STR                            223
+#define UNPACK_SEQUENCE_LIST                   224
+#define UNPACK_SEQUENCE_TUPLE                  225
+#define UNPACK_SEQUENCE_TWO_TUPLE              226
 #define INSTRUMENTED_END_FOR                   234
 #define INSTRUMENTED_POP_ITER                  235
 #define INSTRUMENTED_END_SEND                  236
@@ -50,6 +50,8 @@ _specializations = {
         "STORE_ATTR_INSTANCE_VALUE",
         "STORE_ATTR_SLOT",
         "STORE_ATTR_WITH_HINT",
+        "STORE_ATTR_PROPERTY",
+        "STORE_ATTR_SETATTR_OVERRIDDEN",
     ],
     "LOAD_GLOBAL": [
         "LOAD_GLOBAL_MODULE",
@@ -61,6 +63,7 @@ _specializations = {
     ],
     "LOAD_ATTR": [
         "LOAD_ATTR_INSTANCE_VALUE",
+        "LOAD_ATTR_INSTANCE_VALUE_POLY",
         "LOAD_ATTR_MODULE",
         "LOAD_ATTR_WITH_HINT",
         "LOAD_ATTR_SLOT",
@@ -76,12 +79,15 @@ _specializations = {
     ],
     "COMPARE_OP": [
         "COMPARE_OP_FLOAT",
+        "COMPARE_OP_FLOAT_INT",
         "COMPARE_OP_INT",
+        "COMPARE_OP_INT_FLOAT",
         "COMPARE_OP_STR",
     ],
     "CONTAINS_OP": [
         "CONTAINS_OP_SET",
         "CONTAINS_OP_DICT",
+        "CONTAINS_OP_STR_TUPLE",
     ],
     "JUMP_BACKWARD": [
         "JUMP_BACKWARD_NO_JIT",
@@ -92,6 +98,9 @@ _specializations = {
         "FOR_ITER_TUPLE",
         "FOR_ITER_RANGE",
         "FOR_ITER_GEN",
+        "FOR_ITER_DICT_ITEMS",
+        "FOR_ITER_ENUMERATE",
+        "FOR_ITER_REVERSED_LIST",
     ],
     "CALL": [
         "CALL_BOUND_METHOD_EXACT_ARGS",
@@ -113,6 +122,7 @@ _specializations = {
         "CALL_ALLOC_AND_ENTER_INIT",
         "CALL_PY_GENERAL",
         "CALL_BOUND_METHOD_GENERAL",
+        "CALL_DUNDER_CALL",
         "CALL_NON_PY_GENERAL",
     ],
     "CALL_KW": [
@@ -120,6 +130,16 @@ _specializations = {
         "CALL_KW_PY",
         "CALL_KW_NON_PY",
     ],
+    "FORMAT_SIMPLE": [
+        "FORMAT_SIMPLE_STR",
+        "FORMAT_SIMPLE_INT",
+        "FORMAT_SIMPLE_FLOAT",
+    ],
+    "FORMAT_WITH_SPEC": [
+        "FORMAT_WITH_SPEC_STR",
+        "FORMAT_WITH_SPEC_INT",
+        "FORMAT_WITH_SPEC_FLOAT",
+    ],
 }
 
 _specialized_opmap = {
@@ -144,68 +164,84 @@ _specialized_opmap = {
     'CALL_BUILTIN_FAST': 146,
     'CALL_BUILTIN_FAST_WITH_KEYWORDS': 147,
     'CALL_BUILTIN_O': 148,
-    'CALL_ISINSTANCE': 149,
-    'CALL_KW_BOUND_METHOD': 150,
-    'CALL_KW_NON_PY': 151,
-    'CALL_KW_PY': 152,
-    'CALL_LEN': 153,
-    'CALL_LIST_APPEND': 154,
-    'CALL_METHOD_DESCRIPTOR_FAST': 155,
-    'CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS': 156,
-    'CALL_METHOD_DESCRIPTOR_NOARGS': 157,
-    'CALL_METHOD_DESCRIPTOR_O': 158,
-    'CALL_NON_PY_GENERAL': 159,
-    'CALL_PY_EXACT_ARGS': 160,
-    'CALL_PY_GENERAL': 161,
-    'CALL_STR_1': 162,
-    'CALL_TUPLE_1': 163,
-    'CALL_TYPE_1': 164,
-    'COMPARE_OP_FLOAT': 165,
-    'COMPARE_OP_INT': 166,
-    'COMPARE_OP_STR': 167,
-    'CONTAINS_OP_DICT': 168,
-    'CONTAINS_OP_SET': 169,
-    'FOR_ITER_GEN': 170,
-    'FOR_ITER_LIST': 171,
-    'FOR_ITER_RANGE': 172,
-    'FOR_ITER_TUPLE': 173,
-    'JUMP_BACKWARD_JIT': 174,
-    'JUMP_BACKWARD_NO_JIT': 175,
-    'LOAD_ATTR_CLASS': 176,
-    'LOAD_ATTR_CLASS_WITH_METACLASS_CHECK': 177,
-    'LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN': 178,
-    'LOAD_ATTR_INSTANCE_VALUE': 179,
-    'LOAD_ATTR_METHOD_LAZY_DICT': 180,
-    'LOAD_ATTR_METHOD_NO_DICT': 181,
-    'LOAD_ATTR_METHOD_WITH_VALUES': 182,
-    'LOAD_ATTR_MODULE': 183,
-    'LOAD_ATTR_NONDESCRIPTOR_NO_DICT': 184,
-    'LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES': 185,
-    'LOAD_ATTR_PROPERTY': 186,
-    'LOAD_ATTR_SLOT': 187,
-    'LOAD_ATTR_WITH_HINT': 188,
-    'LOAD_CONST_IMMORTAL': 189,
-    'LOAD_CONST_MORTAL': 190,
-    'LOAD_GLOBAL_BUILTIN': 191,
-    'LOAD_GLOBAL_MODULE': 192,
-    'LOAD_SUPER_ATTR_ATTR': 193,
-    'LOAD_SUPER_ATTR_METHOD': 194,
-    'RESUME_CHECK': 195,
-    'SEND_GEN': 196,
-    'STORE_ATTR_INSTANCE_VALUE': 197,
-    'STORE_ATTR_SLOT': 198,
-    'STORE_ATTR_WITH_HINT': 199,
-    'STORE_SUBSCR_DICT': 200,
-    'STORE_SUBSCR_LIST_INT': 201,
-    'TO_BOOL_ALWAYS_TRUE': 202,
-    'TO_BOOL_BOOL': 203,
-    'TO_BOOL_INT': 204,
-    'TO_BOOL_LIST': 205,
-    'TO_BOOL_NONE': 206,
-    'TO_BOOL_STR': 207,
-    'UNPACK_SEQUENCE_LIST': 208,
-    'UNPACK_SEQUENCE_TUPLE': 209,
-    'UNPACK_SEQUENCE_TWO_TUPLE': 210,
+    'CALL_DUNDER_CALL': 149,
+    'CALL_ISINSTANCE': 150,
+    'CALL_KW_BOUND_METHOD': 151,
+    'CALL_KW_NON_PY': 152,
+    'CALL_KW_PY': 153,
+    'CALL_LEN': 154,
+    'CALL_LIST_APPEND': 155,
+    'CALL_METHOD_DESCRIPTOR_FAST': 156,
+    'CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS': 157,
+    'CALL_METHOD_DESCRIPTOR_NOARGS': 158,
+    'CALL_METHOD_DESCRIPTOR_O': 159,
+    'CALL_NON_PY_GENERAL': 160,
+    'CALL_PY_EXACT_ARGS': 161,
+    'CALL_PY_GENERAL': 162,
+    'CALL_STR_1': 163,
+    'CALL_TUPLE_1': 164,
+    'CALL_TYPE_1': 165,
+    'COMPARE_OP_FLOAT': 166,
+    'COMPARE_OP_FLOAT_INT': 167,
+    'COMPARE_OP_INT': 168,
+    'COMPARE_OP_INT_FLOAT': 169,
+    'COMPARE_OP_STR': 170,
+    'CONTAINS_OP_DICT': 171,
+    'CONTAINS_OP_SET': 172,
+    'CONTAINS_OP_STR_TUPLE': 173,
+    'FORMAT_SIMPLE_FLOAT': 174,
+    'FORMAT_SIMPLE_INT': 175,
+    'FORMAT_SIMPLE_STR': 176,
+    'FORMAT_WITH_SPEC_FLOAT': 177,
+    'FORMAT_WITH_SPEC_INT': 178,
+    'FORMAT_WITH_SPEC_STR': 179,
+    'FOR_ITER_DICT_ITEMS': 180,
+    'FOR_ITER_ENUMERATE': 181,
+    'FOR_ITER_GEN': 182,
+    'FOR_ITER_LIST': 183,
+    'FOR_ITER_RANGE': 184,
+    'FOR_ITER_REVERSED_LIST': 185,
+    'FOR_ITER_TUPLE': 186,
+    'JUMP_BACKWARD_JIT': 187,
+    'JUMP_BACKWARD_NO_JIT': 188,
+    'LOAD_ATTR_CLASS': 189,
+    'LOAD_ATTR_CLASS_WITH_METACLASS_CHECK': 190,
+    'LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN': 191,
+    'LOAD_ATTR_INSTANCE_VALUE': 192,
+    'LOAD_ATTR_INSTANCE_VALUE_POLY': 193,
+    'LOAD_ATTR_METHOD_LAZY_DICT': 194,
+    'LOAD_ATTR_METHOD_NO_DICT': 195,
+    'LOAD_ATTR_METHOD_WITH_VALUES': 196,
+    'LOAD_ATTR_MODULE': 197,
+    'LOAD_ATTR_NONDESCRIPTOR_NO_DICT': 198,
+    'LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES': 199,
+    'LOAD_ATTR_PROPERTY': 200,
+    'LOAD_ATTR_SLOT': 201,
+    'LOAD_ATTR_WITH_HINT': 202,
+    'LOAD_CONST_IMMORTAL': 203,
+    'LOAD_CONST_MORTAL': 204,
+    'LOAD_GLOBAL_BUILTIN': 205,
+    'LOAD_GLOBAL_MODULE': 206,
+    'LOAD_SUPER_ATTR_ATTR': 207,
+    'LOAD_SUPER_ATTR_METHOD': 208,
+    'RESUME_CHECK': 209,
+    'SEND_GEN': 210,
+    'STORE_ATTR_INSTANCE_VALUE': 211,
+    'STORE_ATTR_PROPERTY': 212,
+    'STORE_ATTR_SETATTR_OVERRIDDEN': 213,
+    'STORE_ATTR_SLOT': 214,
+    'STORE_ATTR_WITH_HINT': 215,
+    'STORE_SUBSCR_DICT': 216,
+    'STORE_SUBSCR_LIST_INT': 217,
+    'TO_BOOL_ALWAYS_TRUE': 218,
+    'TO_BOOL_BOOL': 219,
+    'TO_BOOL_INT': 220,
+    'TO_BOOL_LIST': 221,
+    'TO_BOOL_NONE': 222,
+    'TO_BOOL_STR': 223,
+    'UNPACK_SEQUENCE_LIST': 224,
+    'UNPACK_SEQUENCE_TUPLE': 225,
+    'UNPACK_SEQUENCE_TWO_TUPLE': 226,
 }
 
 opmap = {
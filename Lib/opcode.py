@@ -65,6 +65,12 @@
     "CONTAINS_OP": {
         "counter": 1,
     },
+    "FORMAT_SIMPLE": {
+        "counter": 1,
+    },
+    "FORMAT_WITH_SPEC": {
+        "counter": 1,
+    },
     "FOR_ITER": {
         "counter": 1,
     },
@@ -1,5 +1,7 @@
 import contextlib
+import dis
 import itertools
+import math
 import sys
 import textwrap
 import unittest
@@ -349,6 +351,56 @@ def testfunc(a):
         # Verification that the jump goes past END_FOR
         # is done by manual inspection of the output
 
+    def test_for_iter_dict_items(self):
+        def testfunc(d):
+            total = 0
+            for k, v in d.items():
+                total += k * v
+            return total
+
+        d = {i: i for i in range(TIER2_THRESHOLD)}
+        total = testfunc(d)
+        self.assertEqual(total, sum(i * i for i in d))
+
+        ex = get_first_executor(testfunc)
+        self.assertIsNotNone(ex)
+        uops = get_opnames(ex)
+        self.assertIn("_ITER_NEXT_DICT_ITEMS_UNPACK", uops)
+        self.assertNotIn("_UNPACK_SEQUENCE_TWO_TUPLE", uops)
+
+    def test_for_iter_enumerate(self):
+        def testfunc(a):
+            total = 0
+            for i, x in enumerate(a):
+                total += i * x
+            return total
+
+        a = list(range(TIER2_THRESHOLD))
+        total = testfunc(a)
+        self.assertEqual(total, sum(i * i for i in a))
+
+        ex = get_first_executor(testfunc)
+        self.assertIsNotNone(ex)
+        uops = get_opnames(ex)
+        self.assertIn("_ITER_NEXT_ENUMERATE_UNPACK", uops)
+        self.assertNotIn("_UNPACK_SEQUENCE_TWO_TUPLE", uops)
+
+    def test_for_iter_reversed_list(self):
+        def testfunc(a):
+            total = 0
+            for i in reversed(a):
+                total += i
+            return total
+
+        a = list(range(TIER2_THRESHOLD))
+        total = testfunc(a)
+        self.assertEqual(total, sum(a))
+
+        ex = get_first_executor(testfunc)
+        self.assertIsNotNone(ex)
+        uops = get_opnames(ex)
+        self.assertIn("_GUARD_NOT_EXHAUSTED_REVERSED_LIST", uops)
+
     def test_list_edge_case(self):
         def testfunc(it):
             for x in it:
@@ -445,6 +497,84 @@ def testfunc(n):
         count = ops.count("_GUARD_IS_TRUE_POP") + ops.count("_GUARD_IS_FALSE_POP")
         self.assertLessEqual(count, 2)
 
+    def test_executor_profiles(self):
+        def testfunc(n):
+            total = 0
+            for i in range(n):
+                if i % 10 == 0:
+                    total += 1
+            return total
+
+        self.assertTrue(sys._jit.is_enabled())
+        with clear_executors(testfunc):
+            testfunc(TIER2_THRESHOLD * 2)
+            ex = get_first_executor(testfunc)
+            self.assertIsNotNone(ex)
+            profiles = [p for p in sys._jit.get_executors()
+                        if p["code"] is testfunc.__code__]
+            self.assertEqual(len(profiles), 1)
+            profile = profiles[0]
+            self.assertTrue(profile["valid"])
+            self.assertEqual(list(profile["uops"]), get_opnames(ex)[:len(profile["uops"])])
+            self.assertEqual(profile["uops"][-1], "_JUMP_TO_TOP")
+            self.assertGreater(profile["runs"], 0)
+            self.assertGreaterEqual(profile["jit_size"], 0)
+            # The branch guard is the one that fails roughly every tenth run
+            taken = [e for e in profile["exits"] if e["hits"]]
+            self.assertTrue(any(e["reasons"] for e in taken))
+            for e in profile["exits"]:
+                self.assertIsInstance(e["target"], int)
+                self.assertIsInstance(e["linked"], bool)
+                self.assertEqual(e["qualname"], testfunc.__code__.co_qualname)
+                self.assertEqual(e["filename"], testfunc.__code__.co_filename)
+                self.assertEqual(e["firstlineno"],
+                                 testfunc.__code__.co_firstlineno)
+
+    def test_executor_profiles_exit_in_callee(self):
+        def callee(i):
+            if i % 10 == 0:
+                return 1
+            return 0
+
+        def testfunc(n):
+            total = 0
+            for i in range(n):
+                total += callee(i)
+            return total
+
+        with clear_executors(testfunc):
+            testfunc(TIER2_THRESHOLD * 2)
+            profiles = [p for p in sys._jit.get_executors()
+                        if p["code"] is testfunc.__code__]
+            self.assertEqual(len(profiles), 1)
+            taken = [e for e in profiles[0]["exits"] if e["hits"]]
+            # The branch in the callee exits the trace, and its target is
+            # an offset into the callee's code object.
+            in_callee = [e for e in taken
+                         if e["qualname"] == callee.__code__.co_qualname]
+            self.assertEqual(len(in_callee), 1)
+            self.assertEqual(in_callee[0]["firstlineno"],
+                             callee.__code__.co_firstlineno)
+            self.assertIn(in_callee[0]["target"],
+                          [i.offset for i in dis.get_instructions(callee)])
+
+    def test_abandoned_traces(self):
+        def gen(n):
+            for i in range(n):
+                yield i
+
+        before = sys._jit.get_abandoned()
+        self.assertEqual(set(before), {
+            "no_progress", "unsupported_opcode", "unknown_callee",
+            "trace_stack_overflow", "trace_stack_underflow", "optimizer"})
+        # Tracing the loop in the generator reaches the yield, which would
+        # return out of the frame the trace started in.
+        for _ in gen(TIER2_THRESHOLD * 2):
+            pass
+        after = sys._jit.get_abandoned()
+        self.assertGreater(after["trace_stack_underflow"],
+                           before["trace_stack_underflow"])
+
 
 @requires_specialization
 @unittest.skipIf(Py_GIL_DISABLED, "optimizer not yet supported in free-threaded builds")
@@ -658,6 +788,156 @@ def testfunc(n):
         """), PYTHON_JIT="1")
         self.assertEqual(result[0].rc, 0, result)
 
+    def test_jit_memory_limit(self):
+        # Compile many distinct hot loops with a 1 MB budget for machine code
+        result = script_helper.run_python_until_end('-c', textwrap.dedent("""
+        import sys
+        import _testinternalcapi
+
+        for i in range(200):
+            ns = {}
+            exec(f"def f(n):\\n    for j in range(n):\\n        j + {i}\\n", ns)
+            ns["f"](_testinternalcapi.TIER2_THRESHOLD)
+            used = sum(p["jit_size"] for p in sys._jit.get_executors())
+            assert used <= 1024 * 1024, used
+        """), PYTHON_JIT="1", PYTHON_JIT_MEMORY_LIMIT="1")
+        self.assertEqual(result[0].rc, 0, result)
+
+    def test_jit_background_compilation(self):
+        # Hot loops keep running correctly while their code is being compiled
+        result = script_helper.run_python_until_end('-c', textwrap.dedent("""
+        import _testinternalcapi
+
+        def f(n):
+            total = 0
+            for i in range(n):
+                total += i % 7
+            return total
+
+        n = _testinternalcapi.TIER2_THRESHOLD * 10
+        expected = sum(i % 7 for i in range(n))
+        for _ in range(10):
+            assert f(n) == expected
+        """), PYTHON_JIT="1", PYTHON_JIT_BACKGROUND="1")
+        self.assertEqual(result[0].rc, 0, result)
+
+    def test_jit_jump_backward_warmup(self):
+        # A lower warmup traces loops long before the default threshold
+        result = script_helper.run_python_until_end('-c', textwrap.dedent("""
+        import _opcode
+
+        def f(n):
+            total = 0
+            for i in range(n):
+                total += i
+            return total
+
+        def get_first_executor(func):
+            code = func.__code__
+            for i in range(0, len(code.co_code), 2):
+                try:
+                    return _opcode.get_executor(code, i)
+                except ValueError:
+                    pass
+            return None
+
+        f(100)
+        assert get_first_executor(f) is not None, "loop was not traced"
+        """), PYTHON_JIT="1", PYTHON_JIT_JUMP_BACKWARD_WARMUP="16")
+        self.assertEqual(result[0].rc, 0, result)
+
+    # Prints how many times the loop runs before it is traced, then how many
+    # times it runs before it is traced again once its executor has been
+    # invalidated. Then does the same for a side exit of the loop, whose
+    # executor is invalidated through the function that only it calls.
+    WARMUP_SCRIPT = textwrap.dedent("""
+        import sys
+        import _opcode
+        import _testinternalcapi
+
+        def get_first_executor(func):
+            code = func.__code__
+            for i in range(0, len(code.co_code), 2):
+                try:
+                    return _opcode.get_executor(code, i)
+                except ValueError:
+                    pass
+            return None
+
+        def loop(n):
+            for i in range(n):
+                pass
+
+        def back_edges_until_traced():
+            count = 0
+            while get_first_executor(loop) is None:
+                loop(1)
+                count += 1
+            return count
+
+        first = back_edges_until_traced()
+        _testinternalcapi.invalidate_executors(loop.__code__)
+        assert get_first_executor(loop) is None
+        print(first, back_edges_until_traced())
+
+        def g(i):
+            return i + 1
+
+        def f(n, start):
+            total = 0
+            for i in range(n):
+                total += g(i) if i >= start else i
+            return total
+
+        def branch_exit():
+            profiles = [p for p in sys._jit.get_executors()
+                        if p["code"] is f.__code__]
+            assert len(profiles) == 1, profiles
+            assert profiles[0]["valid"]
+            return max(profiles[0]["exits"], key=lambda e: e["hits"])
+
+        def hits_until_linked():
+            # An invalidated executor stays linked until the exit is hit
+            start = branch_exit()["hits"]
+            f(10, 0)
+            while not branch_exit()["linked"]:
+                f(10, 0)
+            return branch_exit()["hits"] - start
+
+        f(100, 100)
+        first = hits_until_linked()
+        _testinternalcapi.invalidate_executors(g.__code__)
+        print(first, hits_until_linked())
+        """)
+
+    def run_warmup_script(self, **env):
+        result = script_helper.run_python_until_end(
+            '-c', self.WARMUP_SCRIPT, PYTHON_JIT="1",
+            PYTHON_JIT_JUMP_BACKWARD_WARMUP="16", **env)
+        self.assertEqual(result[0].rc, 0, result)
+        loop, side_exit = result[0].out.decode().splitlines()
+        return ([int(n) for n in loop.split()],
+                [int(n) for n in side_exit.split()])
+
+    def test_jit_side_exit_warmup(self):
+        _, (default, _) = self.run_warmup_script()
+        self.assertGreaterEqual(default, 4096)
+        _, (lowered, _) = self.run_warmup_script(
+            PYTHON_JIT_SIDE_EXIT_WARMUP="64")
+        # The exit is hit ten times per call:
+        self.assertGreaterEqual(lowered, 64)
+        self.assertLess(lowered, 64 + 10)
+
+    def test_jit_invalidated_executor_backoff(self):
+        (loop, loop_again), (_, exit_again) = self.run_warmup_script(
+            PYTHON_JIT_SIDE_EXIT_WARMUP="64")
+        # _Py_ExecutorDetach backs the JUMP_BACKWARD counter off, and
+        # _EXIT_TRACE does the same when it finds an invalidated executor:
+        self.assertEqual(loop, 16)
+        self.assertEqual(loop_again, 2 * loop)
+        self.assertGreaterEqual(exit_again, 2 * 64)
+        self.assertLess(exit_again, 2 * 64 + 10)
+
     def test_float_add_constant_propagation(self):
         def testfunc(n):
             a = 1.0
@@ -724,6 +1004,46 @@ def testfunc(n):
         # We'll also need to verify that propagation actually occurs.
         self.assertIn("_BINARY_OP_MULTIPLY_FLOAT", uops)
 
+    def test_float_intermediates_reused(self):
+        def testfunc(n):
+            a = 1.5
+            results = []
+            for _ in range(n):
+                b = (a + 1.0) * 2.0  # The sum is a unique intermediate...
+                c = b * 2.0  # ...but b is still referenced by the local.
+                results.append((b, c))
+            return results
+
+        res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
+        self.assertEqual(res, [(5.0, 10.0)] * TIER2_THRESHOLD)
+        self.assertIsNotNone(ex)
+        uops = get_opnames(ex)
+        self.assertIn("_BINARY_OP_ADD_FLOAT", uops)
+        self.assertIn("_BINARY_OP_MULTIPLY_FLOAT", uops)
+
+        # Check the reuse itself: when both operands are only referenced
+        # from the stack, the result is stored in the left one.  Freeing
+        # both and allocating would hand back the right one's memory.
+        ids = []
+        def make(i):
+            x = i + 0.5
+            ids.append(id(x))
+            return x
+
+        def testfunc(n):
+            reused = 0
+            for i in range(n):
+                ids.clear()
+                r = make(i) + make(i)
+                reused += id(r) == ids[0]
+            return reused
+
+        res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
+        # The first iteration runs before BINARY_OP is specialized.
+        self.assertEqual(res, TIER2_THRESHOLD - 1)
+        self.assertIsNotNone(ex)
+        self.assertIn("_BINARY_OP_ADD_FLOAT", get_opnames(ex))
+
     def test_add_unicode_propagation(self):
         def testfunc(n):
             a = ""
@@ -1037,8 +1357,10 @@ def testfunc(n):
 
         uops_and_operands = [(opcode, operand) for opcode, _, _, operand in ex]
         uop_names = [uop[0] for uop in uops_and_operands]
-        self.assertEqual(uop_names.count("_PUSH_FRAME"), 15)
-        self.assertEqual(uop_names.count("_RETURN_VALUE"), 15)
+        # The six calls to dummy0 are inlined, the rest push a frame:
+        self.assertEqual(uop_names.count("_POP_CALL_LOAD_ARG"), 6)
+        self.assertEqual(uop_names.count("_PUSH_FRAME"), 9)
+        self.assertEqual(uop_names.count("_RETURN_VALUE"), 9)
 
         self.assertEqual(uop_names.count("_CHECK_STACK_SPACE"), 0)
         self.assertEqual(uop_names.count("_CHECK_STACK_SPACE_OPERAND"), 1)
@@ -1363,13 +1685,90 @@ def testfunc(n):
         ex = get_first_executor(testfunc)
         self.assertIsNotNone(ex)
         uops = get_opnames(ex)
-        self.assertIn("_PUSH_FRAME", uops)
+        # global_identity is simple enough to be inlined
+        self.assertIn("_POP_CALL_LOAD_ARG", uops)
         # Strength reduced version
         self.assertIn("_CHECK_FUNCTION_VERSION_INLINE", uops)
         self.assertNotIn("_CHECK_FUNCTION_VERSION", uops)
         # Removed guard
         self.assertNotIn("_CHECK_FUNCTION_EXACT_ARGS", uops)
 
+    def test_loop_invariant_guards_hoisted(self):
+        def testfunc(n):
+            x = 0
+            for i in range(n):
+                x += global_identity(i)
+            return x
+
+        res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
+        self.assertEqual(res, sum(range(TIER2_THRESHOLD)))
+        self.assertIsNotNone(ex)
+        uops = get_opnames(ex)
+        self.assertIn("_POP_CALL_LOAD_ARG", uops)
+        # The guards on the outermost frame are checked once, before
+        # the top of the loop:
+        self.assertEqual(uops.count("_CHECK_FUNCTION"), 1)
+        self.assertEqual(uops.count("_CHECK_STACK_SPACE_OPERAND"), 1)
+        loop_top = uops.index("_MAKE_WARM")
+        self.assertLess(uops.index("_CHECK_FUNCTION"), loop_top)
+        self.assertLess(uops.index("_CHECK_STACK_SPACE_OPERAND"), loop_top)
+        jump = list(ex)[uops.index("_JUMP_TO_TOP")]
+        self.assertEqual(jump[1], loop_top - 1)
+
+    def test_trivial_calls_inlined(self):
+        def identity(x):
+            return x
+        def constant(x, y):
+            return 7
+        def increment(x):
+            return x + 1  # May raise, so needs a frame
+        class C:
+            def method(self):
+                return self
+        def testfunc(n):
+            c = C()
+            x = 0
+            for i in range(n):
+                x += identity(i)
+                x += constant(i, i)
+                x += increment(i)
+                x += c.method() is c
+            return x
+
+        res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
+        expected = sum(range(TIER2_THRESHOLD)) * 2 + TIER2_THRESHOLD * 9
+        self.assertEqual(res, expected)
+        self.assertIsNotNone(ex)
+        uops = get_opnames(ex)
+        self.assertEqual(uops.count("_POP_CALL_LOAD_ARG"), 2)
+        self.assertEqual(uops.count("_POP_CALL_LOAD_CONST_INLINE"), 1)
+        self.assertEqual(uops.count("_PUSH_FRAME"), 1)
+        self.assertEqual(uops.count("_RETURN_VALUE"), 1)
+        # The function versions are still checked:
+        self.assertEqual(uops.count("_CHECK_FUNCTION_VERSION"), 4)
+
+    def test_build_and_unpack_tuple_sunk(self):
+        def testfunc(n):
+            x = 0
+            for i in range(n):
+                a, b, c, d = i, 1, 2, 3
+                a, b, c, d = d, c, b, a
+                p, q = (a, d) if i % 2 else (d, a)
+                x += a * 1000 + d * 100 + p * 10 + q
+            return x
+
+        res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
+        expected = sum(3000 + i * 100 + (30 + i if i % 2 else 10 * i + 3)
+                       for i in range(TIER2_THRESHOLD))
+        self.assertEqual(res, expected)
+        self.assertIsNotNone(ex)
+        uops = get_opnames(ex)
+        self.assertNotIn("_BUILD_TUPLE", uops)
+        self.assertNotIn("_UNPACK_SEQUENCE_TUPLE", uops)
+        self.assertNotIn("_UNPACK_SEQUENCE_TWO_TUPLE", uops)
+        self.assertIn("_REVERSE", uops)
+        self.assertIn("_SWAP", uops)
+
     def test_jit_error_pops(self):
         """
         Tests that the correct number of pops are inserted into the
@@ -1601,7 +2000,24 @@ def testfunc(n):
         self.assertIsNotNone(ex)
         uops = get_opnames(ex)
         self.assertNotIn("_COMPARE_OP_INT", uops)
-        self.assertIn("_POP_TWO_LOAD_CONST_INLINE_BORROW", uops)
+        # The operands are never pushed, so there is nothing left to pop:
+        self.assertNotIn("_POP_TWO_LOAD_CONST_INLINE_BORROW", uops)
+        self.assertNotIn("_GUARD_IS_TRUE_POP", uops)
+
+    def test_pop_top_load_const_inline_cancels_push(self):
+        def testfunc(n):
+            x = 0.0
+            for _ in range(n):
+                x += math.pi
+            return x
+
+        res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
+        self.assertAlmostEqual(res, math.pi * TIER2_THRESHOLD)
+        self.assertIsNotNone(ex)
+        uops = get_opnames(ex)
+        self.assertNotIn("_LOAD_ATTR_MODULE", uops)
+        self.assertNotIn("_POP_TOP_LOAD_CONST_INLINE", uops)
+        self.assertIn("_LOAD_CONST_INLINE", uops)
 
     def test_to_bool_bool_contains_op_set(self):
         """
@@ -1767,6 +2183,48 @@ def testfunc(n):
         self.assertNotIn("_GUARD_TOS_UNICODE", uops)
         self.assertIn("_BINARY_OP_ADD_UNICODE", uops)
 
+    def test_binary_op_extend_narrows_to_float(self):
+        def testfunc(n):
+            a = 2
+            b = 0.25
+            x = 0.0
+            for _ in range(n):
+                y = a * b      # _BINARY_OP_EXTEND
+                x = x + (y + b)  # _BINARY_OP_ADD_FLOAT
+            return x
+
+        res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
+        self.assertAlmostEqual(res, TIER2_THRESHOLD * 0.75)
+        self.assertIsNotNone(ex)
+        uops = get_opnames(ex)
+        self.assertIn("_BINARY_OP_EXTEND", uops)
+        # The result of int * float is known to be a float, and so is b
+        # once the extended guard has passed, so y + b needs no guards.
+        self.assertIn("_BINARY_OP_ADD_FLOAT", uops)
+        self.assertLessEqual(
+            len([op for op in iter_opnames(ex) if op == "_GUARD_TOS_FLOAT"]), 1)
+        self.assertLessEqual(
+            len([op for op in iter_opnames(ex) if op == "_GUARD_NOS_FLOAT"]), 1)
+
+    def test_binary_slice_narrows_to_container_type(self):
+        def testfunc(n):
+            x = []
+            lo = 1
+            for _ in range(n):
+                y = "foo"[lo:]  # _BINARY_SLICE
+                z = y + "bar"   # (_GUARD_NOS_UNICODE) + _BINARY_OP_ADD_UNICODE
+                x.append(z)
+            return x
+
+        res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
+        self.assertEqual(res, ["oobar"] * TIER2_THRESHOLD)
+        self.assertIsNotNone(ex)
+        uops = get_opnames(ex)
+        self.assertIn("_BINARY_SLICE", uops)
+        # Slicing a str gives a str, so the guard is removed.
+        self.assertNotIn("_GUARD_NOS_UNICODE", uops)
+        self.assertIn("_BINARY_OP_ADD_UNICODE", uops)
+
 
 def global_identity(x):
     return x
@@ -6,6 +6,7 @@
 import gc
 
 from test.support import threading_helper
+from test.support.script_helper import assert_python_ok
 
 
 class MyObj:
@@ -62,6 +63,61 @@ def mutator_thread():
         with threading_helper.start_threads(gcs + mutators):
             pass
 
+    def test_parallel_mark(self):
+        # PYTHON_GC_MARK_THREADS splits the marking pass across threads.
+        code = """if 1:
+            import functools
+            import gc
+
+            class Node:
+                pass
+
+            gc.collect()
+            gc.disable()
+            head = cur = Node()
+            for i in range(200_000):
+                cur.next = Node()
+                # partial is a heap type with its own tp_traverse, so it is
+                # traversed by the collecting thread
+                cur.items = [cur, {i: cur}, functools.partial(id, cur)]
+                cur = cur.next
+            for i in range(50_000):
+                x = Node()
+                x.self = x
+            del x, cur
+            assert gc.collect() == 50_000, "wrong number of objects collected"
+
+            n = 0
+            cur = head
+            while cur is not None:
+                n += 1
+                cur = getattr(cur, "next", None)
+            assert n == 200_001, n
+            assert gc.collect() == 0
+            del head
+            assert gc.collect() == 1_200_001
+
+            # the helper threads are kept between collections; a forked
+            # child must start its own
+            import os, warnings
+            if hasattr(os, "fork"):
+                with warnings.catch_warnings():
+                    warnings.simplefilter("ignore", DeprecationWarning)
+                    pid = os.fork()
+                if pid == 0:
+                    gc.collect()
+                    for i in range(300_000):
+                        x = Node()
+                        x.self = x
+                    del x
+                    os._exit(gc.collect() != 300_000)
+                _, status = os.waitpid(pid, 0)
+                assert os.waitstatus_to_exitcode(status) == 0, status
+        """
+        for threads in ("1", "4"):
+            with self.subTest(threads=threads):
+                assert_python_ok("-c", code, PYTHON_GC_MARK_THREADS=threads)
+
 
 if __name__ == "__main__":
     unittest.main()
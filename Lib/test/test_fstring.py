@@ -63,6 +63,67 @@ def __format__(self, spec):
         self.assertEqual(type(x).__format__(x, ''), 'class')
         self.assertEqual(type(y).__format__(y, ''), 'class')
 
+    def test__format__subclasses(self):
+        # Exact str, int and float are formatted without looking up
+        # __format__. Make sure that subclasses still call it.
+        for base, value in ((str, 'abc'), (int, 42), (float, 2.5)):
+            with self.subTest(base=base):
+                class X(base):
+                    def __format__(self, spec):
+                        return f'X<{spec}>'
+
+                x = X(value)
+                self.assertEqual(f'{x}', 'X<>')
+                self.assertEqual(f'{x:}', 'X<>')
+                self.assertEqual(f'{x:>10}', 'X<>10>')
+                spec = '^8'
+                self.assertEqual(f'{x:{spec}}', 'X<^8>')
+                self.assertEqual(f'a{x}b{x:d}c', 'aX<>bX<d>c')
+                self.assertEqual(format(x), 'X<>')
+                self.assertEqual(format(x, 'x'), 'X<x>')
+                # Conversions call str() or repr() first:
+                self.assertEqual(f'{x!s}', str(value))
+                self.assertEqual(f'{x!r:}', repr(value))
+
+    def test_builtin_types_format(self):
+        # f-strings must give the same results as calling __format__
+        cases = [
+            ('', ['', '>10', '<5', '^9', '*^9', '.2', '10.3', '=>6', 's']),
+            ('abc', ['', '>10', '<5', '^9', '*^9', '.2', '10.3', '=>6', 's']),
+            ('€\U0001f600', ['', '>5', '_^6', '.1']),
+            (0, ['', 'd', '5', '+', ' ', '05', 'x', '#X', 'o', 'b', ',', '_',
+                 'n', 'c', 'e', '.3f', '%', '>+10,', '=12']),
+            (-123456789, ['', ',', '_x', '+015,d', '<20', 'g']),
+            (2**100, ['', ',', '_b', 'e', '.3g']),
+            (True, ['', 'd', '>6', 'x']),
+            (0.1, ['', 'f', '.20f', 'e', 'E', 'g', '.3', '%', '+010.2f',
+                   ',.2f', '_', 'n', 'z.1f']),
+            (-0.0, ['', 'f', 'z', 'z.3f', 'g', '+']),
+            (1e300, ['', 'e', ',.1f', 'g', '.50g']),
+            (float('inf'), ['', '>6', 'f', 'E']),
+            (float('nan'), ['', '<6', 'F', 'g']),
+            (1.5, ['', '^10', '010', '.0f', '.0%']),
+        ]
+        for value, specs in cases:
+            for spec in specs:
+                with self.subTest(value=value, spec=spec):
+                    expected = type(value).__format__(value, spec)
+                    self.assertEqual(f'{value:{spec}}', expected)
+                    self.assertEqual(format(value, spec), expected)
+                    self.assertEqual(f'<{value:{spec}}>', f'<{expected}>')
+            with self.subTest(value=value):
+                self.assertEqual(f'{value}', type(value).__format__(value, ''))
+                self.assertEqual(f'{value}', str(value))
+
+        for value, spec in ((1, 's'), ('a', 'd'), (1.0, 'd'), (1, '.2'),
+                            ('a', '='), (1, 'z'), (1, '€')):
+            with self.subTest(value=value, spec=spec):
+                with self.assertRaises(ValueError) as expected:
+                    type(value).__format__(value, spec)
+                with self.assertRaises(ValueError) as cm:
+                    f'{value:{spec}}'
+                self.assertEqual(str(cm.exception), str(expected.exception))
+
     def test_ast(self):
         # Inspired by http://bugs.python.org/issue24975
         class X:
@@ -365,6 +365,20 @@ def __del__(self):
         gc.disable()
         gc.set_threshold(*thresholds)
 
+    def test_pause_budget(self):
+        budget = gc.get_pause_budget()
+        self.assertEqual(budget, 0.0)
+        try:
+            gc.set_pause_budget(0.002)
+            self.assertEqual(gc.get_pause_budget(), 0.002)
+            gc.set_pause_budget(0)
+            self.assertEqual(gc.get_pause_budget(), 0.0)
+            self.assertRaises(ValueError, gc.set_pause_budget, -1.0)
+            self.assertRaises(ValueError, gc.set_pause_budget, float('nan'))
+            self.assertRaises(TypeError, gc.set_pause_budget, None)
+        finally:
+            gc.set_pause_budget(budget)
+
     # The following two tests are fragile:
     # They precisely count the number of allocations,
     # which is highly implementation-dependent.
@@ -817,6 +831,35 @@ def test_freeze(self):
         gc.unfreeze()
         self.assertEqual(gc.get_freeze_count(), 0)
 
+    def test_freeze_immortalize(self):
+        # Run in a subprocess: immortal objects are never freed.
+        code = """if 1:
+            import gc, sys, weakref
+            class A:
+                pass
+            x = [A(), 1.5, 10**20, (A(), 2.5), b"bytes"]
+            gc.collect()
+            gc.freeze(immortalize=True)
+            assert sys._is_immortal(x)
+            assert all(sys._is_immortal(o) for o in x)
+            assert sys._is_immortal(x[3][0])
+            assert not gc.is_tracked(x)
+            assert gc.get_freeze_count() == 0
+
+            # New objects referenced from immortal ones are still collected.
+            y = A()
+            y.cycle = y
+            x.append(y)
+            x.pop()
+            wr = weakref.ref(y)
+            del y
+            gc.collect()
+            assert wr() is None
+            gc.unfreeze()
+            assert sys._is_immortal(x)
+            """
+        assert_python_ok("-c", code)
+
     def test_get_objects(self):
         gc.collect()
         l = []
@@ -1186,6 +1229,16 @@ def make_ll(depth):
         if not enabled:
             gc.disable()
 
+    def test_incremental_gc_with_pause_budget(self):
+        # With a tiny budget, increments are kept small but the collector
+        # still keeps up with the allocation rate.
+        budget = gc.get_pause_budget()
+        gc.set_pause_budget(1e-6)
+        try:
+            self.test_incremental_gc_handles_fast_cycle_creation()
+        finally:
+            gc.set_pause_budget(budget)
+
 
 class GCCallbackTests(unittest.TestCase):
     def setUp(self):
@@ -1307,6 +1360,77 @@ def test_collect_garbage(self):
         # Uncollectables should be gone
         self.assertEqual(len(gc.garbage), 0)
 
+    @cpython_only
+    def test_collect_phases(self):
+        self.preclean()
+        gc.collect()
+        for v in self.visit:
+            info = v[2]
+            if v[1] == "start":
+                self.assertNotIn("phases", info)
+                continue
+            self.assertGreater(info["visited"], 0)
+            phases = info["phases"]
+            self.assertIn("update_refs", phases)
+            self.assertIn("finalize", phases)
+            self.assertIn("delete", phases)
+            for duration in phases.values():
+                self.assertGreaterEqual(duration, 0.0)
+            self.assertGreaterEqual(info["duration"] + 1e-9,
+                                    sum(phases.values()))
+            self.assertNotIn("collected_types", info)
+            self.assertNotIn("survived_types", info)
+
+    @cpython_only
+    def test_collect_type_stats(self):
+        class Garbage:
+            pass
+        class Survivor:
+            pass
+
+        self.preclean()
+        survivor = Survivor()
+        survivor.self = survivor
+        for i in range(3):
+            garbage = Garbage()
+            garbage.self = garbage
+        del garbage
+        gc.set_debug(gc.DEBUG_TYPE_STATS)
+        gc.collect()
+        garbage_name = f"{__name__}.{Garbage.__qualname__}"
+        survivor_name = f"{__name__}.{Survivor.__qualname__}"
+        for v in self.visit:
+            if v[1] != "stop":
+                continue
+            info = v[2]
+            self.assertEqual(info["collected_types"][garbage_name], 3)
+            self.assertNotIn(survivor_name, info["collected_types"])
+            self.assertEqual(info["survived_types"][survivor_name], 1)
+            self.assertNotIn(garbage_name, info["survived_types"])
+
+    @cpython_only
+    def test_collect_type_stats_garbage_type(self):
+        # A class that is part of the garbage itself is reported by name,
+        # rather than kept alive for the callbacks after it has been cleared.
+        def make_garbage():
+            class Cyclic:
+                pass
+            Cyclic.instance = Cyclic()
+            return f"{__name__}.{Cyclic.__qualname__}", weakref.ref(Cyclic)
+
+        self.preclean()
+        name, ref = make_garbage()
+        gc.set_debug(gc.DEBUG_TYPE_STATS)
+        gc.collect()
+        self.assertIsNone(ref())
+        for v in self.visit:
+            if v[1] != "stop":
+                continue
+            info = v[2]
+            self.assertEqual(info["collected_types"][name], 1)
+            for key in [*info["collected_types"], *info["survived_types"]]:
+                self.assertIsInstance(key, str)
+
 
     @requires_subprocess()
     @unittest.skipIf(BUILD_WITH_NDEBUG,
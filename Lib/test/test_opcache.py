@@ -550,6 +550,29 @@ def instantiate():
         with self.assertRaises(TypeError):
             instantiate()
 
+    @requires_jit_disabled
+    @requires_specialization_ft
+    def test_call_dunder_call(self):
+        class Adder:
+            def __init__(self, n):
+                self.n = n
+            def __call__(self, x, y=0):
+                return self.n + x + y
+
+        def call(f, x):
+            return f(x)
+
+        add = Adder(1)
+        for _ in range(_testinternalcapi.SPECIALIZATION_THRESHOLD):
+            self.assertEqual(call(add, 2), 3)
+        self.assert_specialized(call, "CALL_DUNDER_CALL")
+
+        # Replacing __call__ changes the type version and must be seen:
+        Adder.__call__ = lambda self, x: self.n * x
+        self.assertEqual(call(add, 5), 5)
+        with self.assertRaises(TypeError):
+            call(add, None)
+
 
 def make_deferred_ref_count_obj():
     """Create an object that uses deferred reference counting.
@@ -1483,6 +1506,76 @@ def contains_op_set():
         self.assert_specialized(contains_op_set, "CONTAINS_OP_SET")
         self.assert_no_opcode(contains_op_set, "CONTAINS_OP")
 
+        def contains_op_str_tuple():
+            for _ in range(_testinternalcapi.SPECIALIZATION_THRESHOLD):
+                a = "".join(["b", "ar"])
+                self.assertTrue(a in ("foo", "bar", "baz"))
+                self.assertFalse("spam" in ("foo", "bar", "baz"))
+                self.assertTrue("spam" not in ("foo", "bar", "baz"))
+
+        contains_op_str_tuple()
+        self.assert_specialized(contains_op_str_tuple, "CONTAINS_OP_STR_TUPLE")
+        self.assert_no_opcode(contains_op_str_tuple, "CONTAINS_OP")
+
+        class EqualsEverything:
+            def __eq__(self, other):
+                return True
+            __hash__ = None
+
+        def contains_op_mixed_tuple(a, b):
+            return a in b
+
+        for _ in range(_testinternalcapi.SPECIALIZATION_THRESHOLD):
+            self.assertFalse(contains_op_mixed_tuple("x", ("a", "b")))
+        self.assert_specialized(contains_op_mixed_tuple, "CONTAINS_OP_STR_TUPLE")
+        self.assertTrue(contains_op_mixed_tuple("x", ("a", EqualsEverything())))
+        self.assertTrue(contains_op_mixed_tuple(EqualsEverything(), ("a", "b")))
+
+    @cpython_only
+    @requires_specialization_ft
+    def test_format_simple(self):
+        for value, opname in [("abc", "FORMAT_SIMPLE_STR"),
+                              (12345, "FORMAT_SIMPLE_INT"),
+                              (1.5, "FORMAT_SIMPLE_FLOAT")]:
+            with self.subTest(opname=opname):
+                @reset_code
+                def format_simple(value):
+                    return f"{value}"
+
+                for _ in range(_testinternalcapi.SPECIALIZATION_THRESHOLD):
+                    self.assertEqual(format_simple(value), str(value))
+                self.assert_specialized(format_simple, opname)
+                self.assert_no_opcode(format_simple, "FORMAT_SIMPLE")
+                # Subclasses keep their own __format__ and __str__.
+                class Sub(type(value)):
+                    def __format__(self, spec):
+                        return "sub"
+                self.assertEqual(format_simple(Sub(value)), "sub")
+
+    @cpython_only
+    @requires_specialization_ft
+    def test_format_with_spec(self):
+        for value, spec, opname in [("abc", ">5", "FORMAT_WITH_SPEC_STR"),
+                                    (12345, ",", "FORMAT_WITH_SPEC_INT"),
+                                    (1.5, ".3f", "FORMAT_WITH_SPEC_FLOAT")]:
+            with self.subTest(opname=opname):
+                @reset_code
+                def format_with_spec(value, spec):
+                    return f"{value:{spec}}"
+
+                for _ in range(_testinternalcapi.SPECIALIZATION_THRESHOLD):
+                    self.assertEqual(format_with_spec(value, spec),
+                                     format(value, spec))
+                self.assert_specialized(format_with_spec, opname)
+                self.assert_no_opcode(format_with_spec, "FORMAT_WITH_SPEC")
+                self.assertEqual(format_with_spec(value, ""), str(value))
+                with self.assertRaises(ValueError):
+                    format_with_spec(value, "invalid")
+                class Sub(type(value)):
+                    def __format__(self, spec):
+                        return "sub"
+                self.assertEqual(format_with_spec(Sub(value), spec), "sub")
+
     @cpython_only
     @requires_specialization_ft
     def test_send_with(self):
@@ -1525,6 +1618,48 @@ def send_yield_from():
         self.assert_specialized(send_yield_from, "SEND_GEN")
         self.assert_no_opcode(send_yield_from, "SEND")
 
+    @cpython_only
+    @requires_specialization
+    @requires_jit_disabled
+    def test_load_attr_instance_value_poly(self):
+        class A:
+            def __init__(self):
+                self.x = 1
+
+        class B:
+            def __init__(self):
+                self.x = 2
+
+        class C:
+            def __init__(self):
+                self.a = 0
+                self.x = 3
+
+        @reset_code
+        def get_value(objs):
+            total = 0
+            for obj in objs:
+                total += obj.x
+            return total
+
+        n = _testinternalcapi.SPECIALIZATION_THRESHOLD
+        get_value([A()] * n)
+        self.assert_specialized(get_value, "LOAD_ATTR_INSTANCE_VALUE")
+
+        # A second type with the same layout makes the site polymorphic.
+        get_value([B()] * _testinternalcapi.SPECIALIZATION_COOLDOWN)
+        get_value([B()] * n)
+        self.assert_specialized(get_value, "LOAD_ATTR_INSTANCE_VALUE_POLY")
+        self.assertEqual(get_value([A(), B()] * n), 3 * n)
+        self.assert_specialized(get_value, "LOAD_ATTR_INSTANCE_VALUE_POLY")
+
+        # A type storing the attribute in a different slot does not.
+        get_value([C()] * _testinternalcapi.SPECIALIZATION_COOLDOWN)
+        get_value([C()] * n)
+        self.assert_specialized(get_value, "LOAD_ATTR_INSTANCE_VALUE")
+        self.assert_no_opcode(get_value, "LOAD_ATTR_INSTANCE_VALUE_POLY")
+        self.assertEqual(get_value([A(), B(), C()]), 6)
+
     @cpython_only
     @requires_specialization_ft
     def test_store_attr_slot(self):
@@ -1593,6 +1728,98 @@ def set_value(n):
         set_value(_testinternalcapi.SPECIALIZATION_COOLDOWN)
         self.assert_no_opcode(set_value, "STORE_ATTR_WITH_HINT")
 
+    @cpython_only
+    @requires_specialization
+    def test_store_attr_property(self):
+        class C:
+            def __init__(self):
+                self._x = 0
+            @property
+            def x(self):
+                return self._x
+            @x.setter
+            def x(self, value):
+                if value < 0:
+                    raise ValueError(value)
+                self._x = value
+
+        @reset_code
+        def set_value(n):
+            c = C()
+            for i in range(n):
+                c.x = i
+            return c
+
+        c = set_value(_testinternalcapi.SPECIALIZATION_THRESHOLD)
+        self.assertEqual(c.x, _testinternalcapi.SPECIALIZATION_THRESHOLD - 1)
+        self.assert_specialized(set_value, "STORE_ATTR_PROPERTY")
+        self.assert_no_opcode(set_value, "STORE_ATTR")
+        with self.assertRaises(ValueError):
+            c = C()
+            for i in range(0, -2, -1):
+                c.x = i
+
+        # Reinitializing the property in place doesn't change the type
+        # version, so the specialized code must notice the missing setter.
+        C.__dict__["x"].__init__(C.x.fget)
+        with self.assertRaises(AttributeError):
+            set_value(_testinternalcapi.SPECIALIZATION_COOLDOWN)
+
+        # The type caches one property, so stores to a second property of
+        # the same type must not call the setter of the first.
+        class D:
+            @property
+            def x(self):
+                return self._x
+            @x.setter
+            def x(self, value):
+                self._x = value
+            @property
+            def y(self):
+                return self._y
+            @y.setter
+            def y(self, value):
+                self._y = -value
+
+        @reset_code
+        def set_both(n):
+            d = D()
+            for i in range(n):
+                d.x = i
+                d.y = i
+            return d
+
+        d = set_both(_testinternalcapi.SPECIALIZATION_THRESHOLD)
+        last = _testinternalcapi.SPECIALIZATION_THRESHOLD - 1
+        self.assertEqual((d.x, d.y), (last, -last))
+        d = set_both(_testinternalcapi.SPECIALIZATION_COOLDOWN)
+        last = _testinternalcapi.SPECIALIZATION_COOLDOWN - 1
+        self.assertEqual((d.x, d.y), (last, -last))
+
+    @cpython_only
+    @requires_specialization
+    def test_store_attr_setattr_overridden(self):
+        class C:
+            def __setattr__(self, name, value):
+                object.__setattr__(self, name, value * 2)
+
+        @reset_code
+        def set_value(n):
+            c = C()
+            for i in range(n):
+                c.x = i
+            return c
+
+        c = set_value(_testinternalcapi.SPECIALIZATION_THRESHOLD)
+        self.assertEqual(c.x, 2 * (_testinternalcapi.SPECIALIZATION_THRESHOLD - 1))
+        self.assert_specialized(set_value, "STORE_ATTR_SETATTR_OVERRIDDEN")
+        self.assert_no_opcode(set_value, "STORE_ATTR")
+
+        # A new __setattr__ changes the type version and unspecializes.
+        C.__setattr__ = lambda self, name, value: object.__setattr__(self, name, -1)
+        c = set_value(_testinternalcapi.SPECIALIZATION_COOLDOWN)
+        self.assertEqual(c.x, -1)
+
     @cpython_only
     @requires_specialization_ft
     def test_to_bool(self):
@@ -1743,6 +1970,16 @@ def binary_subscr_str_int():
         self.assert_specialized(binary_subscr_str_int, "BINARY_OP_SUBSCR_STR_INT")
         self.assert_no_opcode(binary_subscr_str_int, "BINARY_OP")
 
+        def binary_subscr_str_int_non_ascii():
+            for _ in range(_testinternalcapi.SPECIALIZATION_THRESHOLD):
+                a = "f\xe9\u20ac\U0001f40d"
+                for idx, expected in enumerate(a):
+                    self.assertEqual(a[idx], expected)
+
+        binary_subscr_str_int_non_ascii()
+        self.assert_specialized(binary_subscr_str_int_non_ascii, "BINARY_OP_SUBSCR_STR_INT")
+        self.assert_no_opcode(binary_subscr_str_int_non_ascii, "BINARY_OP")
+
         def binary_subscr_getitems():
             class C:
                 def __init__(self, val):
@@ -1791,6 +2028,26 @@ def compare_op_str():
         self.assert_specialized(compare_op_str, "COMPARE_OP_STR")
         self.assert_no_opcode(compare_op_str, "COMPARE_OP")
 
+        def compare_op_float_int():
+            for _ in range(_testinternalcapi.SPECIALIZATION_THRESHOLD):
+                a, b = 1.5, 2
+                self.assertTrue(a < b)
+                self.assertFalse(float("nan") == b)
+
+        compare_op_float_int()
+        self.assert_specialized(compare_op_float_int, "COMPARE_OP_FLOAT_INT")
+        self.assert_no_opcode(compare_op_float_int, "COMPARE_OP")
+
+        def compare_op_int_float():
+            for _ in range(_testinternalcapi.SPECIALIZATION_THRESHOLD):
+                a, b = 2, 1.5
+                self.assertTrue(a > b)
+                self.assertFalse(a == float("nan"))
+
+        compare_op_int_float()
+        self.assert_specialized(compare_op_int_float, "COMPARE_OP_INT_FLOAT")
+        self.assert_no_opcode(compare_op_int_float, "COMPARE_OP")
+
     @cpython_only
     @requires_specialization_ft
     def test_load_const(self):
@@ -1844,6 +2101,90 @@ def for_iter_generator():
         self.assert_specialized(for_iter_generator, "FOR_ITER_GEN")
         self.assert_no_opcode(for_iter_generator, "FOR_ITER")
 
+        d = dict.fromkeys(range(10))
+        def for_iter_dict_items():
+            for k, v in d.items():
+                self.assertIn(k, d)
+
+        for_iter_dict_items()
+        self.assert_specialized(for_iter_dict_items, "FOR_ITER_DICT_ITEMS")
+        self.assert_no_opcode(for_iter_dict_items, "FOR_ITER")
+
+        def for_iter_enumerate():
+            for i, x in enumerate(L):
+                self.assertEqual(x, L[i])
+
+        for_iter_enumerate()
+        self.assert_specialized(for_iter_enumerate, "FOR_ITER_ENUMERATE")
+        self.assert_no_opcode(for_iter_enumerate, "FOR_ITER")
+
+    @cpython_only
+    @requires_specialization
+    def test_for_iter_reversed_list(self):
+        L = list(range(10))
+        def for_iter_reversed_list():
+            result = []
+            for i in reversed(L):
+                result.append(i)
+            return result
+
+        self.assertEqual(for_iter_reversed_list(), L[::-1])
+        self.assert_specialized(for_iter_reversed_list, "FOR_ITER_REVERSED_LIST")
+        self.assert_no_opcode(for_iter_reversed_list, "FOR_ITER")
+
+        def shrink_while_iterating(seq):
+            result = []
+            for x in reversed(seq):
+                result.append(x)
+                del seq[-2:]
+            return result
+
+        for _ in range(_testinternalcapi.SPECIALIZATION_THRESHOLD):
+            self.assertEqual(shrink_while_iterating(list(range(6))), [5])
+        self.assert_specialized(shrink_while_iterating, "FOR_ITER_REVERSED_LIST")
+
+    @cpython_only
+    @requires_specialization_ft
+    def test_for_iter_dict_items_and_enumerate_errors(self):
+        def iterate_items(d):
+            for k, v in d.items():
+                d[str(k)] = v
+
+        for _ in range(_testinternalcapi.SPECIALIZATION_THRESHOLD):
+            with self.assertRaises(RuntimeError):
+                iterate_items({1: 2})
+        self.assert_specialized(iterate_items, "FOR_ITER_DICT_ITEMS")
+
+        class StopAfter:
+            def __init__(self, n):
+                self.n = n
+            def __iter__(self):
+                return self
+            def __next__(self):
+                if self.n == 0:
+                    raise StopIteration
+                self.n -= 1
+                return self.n
+
+        class Boom(Exception):
+            pass
+
+        class RaiseAfter(StopAfter):
+            def __next__(self):
+                if self.n == 0:
+                    raise Boom
+                return super().__next__()
+
+        def iterate_enumerate(it):
+            return [(i, x) for i, x in enumerate(it)]
+
+        for _ in range(_testinternalcapi.SPECIALIZATION_THRESHOLD):
+            self.assertEqual(iterate_enumerate(StopAfter(3)),
+                             [(0, 2), (1, 1), (2, 0)])
+        self.assert_specialized(iterate_enumerate, "FOR_ITER_ENUMERATE")
+        with self.assertRaises(Boom):
+            iterate_enumerate(RaiseAfter(3))
+
 
 if __name__ == "__main__":
     unittest.main()
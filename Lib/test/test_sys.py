@@ -1786,7 +1786,7 @@ def delx(self): del self.__x
                   '10P'                 # PySequenceMethods
                   '2P'                  # PyBufferProcs
                   '7P'
-                  '1PIP'                # Specializer cache
+                  '1PI4P'               # Specializer cache
                   + typeid              # heap type id (free-threaded only)
                   )
         class newstyleclass(object): pass
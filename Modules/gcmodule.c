@@ -8,6 +8,7 @@
 #include "pycore_gc.h"
 #include "pycore_object.h"      // _PyObject_IS_GC()
 #include "pycore_pystate.h"     // _PyInterpreterState_GET()
+#include "pycore_time.h"        // _PyTime_FromSecondsDouble()
 #include "pycore_tuple.h"       // _PyTuple_FromArray()
 
 typedef struct _gc_runtime_state GCState;
@@ -105,6 +106,8 @@ gc.set_debug
             found.
           DEBUG_SAVEALL - Save objects to gc.garbage rather than freeing them.
           DEBUG_LEAK - Debug leaking programs (everything but STATS).
+          DEBUG_TYPE_STATS - Report the number of collected and surviving
+            objects per type to gc.callbacks.
     /
 
 Set the garbage collection debugging flags.
@@ -114,7 +117,7 @@ Debugging information is written to sys.stderr.
 
 static PyObject *
 gc_set_debug_impl(PyObject *module, int flags)
-/*[clinic end generated code: output=7c8366575486b228 input=5e5ce15e84fbed15]*/
+/*[clinic end generated code: output=7c8366575486b228 input=75c3826c8823f76d]*/
 {
     GCState *gcstate = get_gc_state();
     gcstate->debug = flags;
@@ -186,6 +189,50 @@ gc_get_threshold_impl(PyObject *module)
                          0);
 }
 
+/*[clinic input]
+gc.set_pause_budget
+
+    budget: double
+    /
+
+Set the target maximum duration of an automatic collection, in seconds.
+
+Increments of the incremental collector are sized to fit in the budget,
+based on the measured cost of previous increments.  Setting 'budget' to
+zero removes the limit.
+[clinic start generated code]*/
+
+static PyObject *
+gc_set_pause_budget_impl(PyObject *module, double budget)
+/*[clinic end generated code: output=6f7f7b925973a47a input=b82654959c43b331]*/
+{
+    if (!(budget >= 0)) {
+        PyErr_SetString(PyExc_ValueError, "budget must be non-negative");
+        return NULL;
+    }
+    PyTime_t t;
+    if (_PyTime_FromSecondsDouble(budget, _PyTime_ROUND_CEILING, &t) < 0) {
+        return NULL;
+    }
+    GCState *gcstate = get_gc_state();
+    gcstate->pause_budget = t;
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+gc.get_pause_budget -> double
+
+Return the target maximum duration of an automatic collection, in seconds.
+[clinic start generated code]*/
+
+static double
+gc_get_pause_budget_impl(PyObject *module)
+/*[clinic end generated code: output=0ac6600c52706fdb input=5860b86cf2e7ac51]*/
+{
+    GCState *gcstate = get_gc_state();
+    return PyTime_AsSecondsDouble(gcstate->pause_budget);
+}
+
 /*[clinic input]
 gc.get_count
 
@@ -416,19 +463,29 @@ gc_is_finalized_impl(PyObject *module, PyObject *obj)
 /*[clinic input]
 gc.freeze
 
+    *
+    immortalize: bool = False
+
 Freeze all current tracked objects and ignore them for future collections.
 
 This can be used before a POSIX fork() call to make the gc copy-on-write friendly.
 Note: collection before a POSIX fork() call may free pages for future allocation
 which can cause copy-on-write.
+
+If immortalize is true, the frozen objects and the objects they refer to
+are also made immortal, so that reference counting no longer writes to
+them.  They are never freed, even by unfreeze().
 [clinic start generated code]*/
 
 static PyObject *
-gc_freeze_impl(PyObject *module)
-/*[clinic end generated code: output=502159d9cdc4c139 input=b602b16ac5febbe5]*/
+gc_freeze_impl(PyObject *module, int immortalize)
+/*[clinic end generated code: output=db32b5465626796f input=4734e0ccfe646623]*/
 {
     PyInterpreterState *interp = _PyInterpreterState_GET();
     _PyGC_Freeze(interp);
+    if (immortalize && _PyGC_Immortalize(interp) < 0) {
+        return NULL;
+    }
     Py_RETURN_NONE;
 }
 
@@ -477,6 +534,8 @@ PyDoc_STRVAR(gc__doc__,
 "get_debug() -- Get debugging flags.\n"
 "set_threshold() -- Set the collection thresholds.\n"
 "get_threshold() -- Return the current the collection thresholds.\n"
+"set_pause_budget() -- Set the target maximum duration of a collection.\n"
+"get_pause_budget() -- Return the target maximum duration of a collection.\n"
 "get_objects() -- Return a list of all objects tracked by the collector.\n"
 "is_tracked() -- Returns true if a given object is tracked.\n"
 "is_finalized() -- Returns true if a given object has been already finalized.\n"
@@ -495,6 +554,8 @@ static PyMethodDef GcMethods[] = {
     GC_GET_COUNT_METHODDEF
     GC_SET_THRESHOLD_METHODDEF
     GC_GET_THRESHOLD_METHODDEF
+    GC_SET_PAUSE_BUDGET_METHODDEF
+    GC_GET_PAUSE_BUDGET_METHODDEF
     GC_COLLECT_METHODDEF
     GC_GET_OBJECTS_METHODDEF
     GC_GET_STATS_METHODDEF
@@ -530,6 +591,7 @@ gcmodule_exec(PyObject *module)
     ADD_INT(DEBUG_UNCOLLECTABLE);
     ADD_INT(DEBUG_SAVEALL);
     ADD_INT(DEBUG_LEAK);
+    ADD_INT(DEBUG_TYPE_STATS);
 #undef ADD_INT
     return 0;
 }
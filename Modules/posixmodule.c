@@ -18,8 +18,10 @@
 #include "pycore_call.h"          // _PyObject_CallNoArgs()
 #include "pycore_ceval.h"         // _PyEval_ReInitThreads()
 #include "pycore_fileutils.h"     // _Py_closerange()
+#include "pycore_gc.h"            // _PyGC_AfterFork_Child()
 #include "pycore_import.h"        // _PyImport_AcquireLock()
 #include "pycore_initconfig.h"    // _PyStatus_EXCEPTION()
+#include "pycore_jit.h"           // _PyJIT_BeforeFork()
 #include "pycore_long.h"          // _PyLong_IsNegative()
 #include "pycore_moduleobject.h"  // _PyModule_GetState()
 #include "pycore_object.h"        // _PyObject_LookupSpecial()
@@ -661,6 +663,9 @@ PyOS_BeforeFork(void)
     PyInterpreterState *interp = _PyInterpreterState_GET();
     run_at_forkers(interp->before_forkers, 1);
 
+#ifdef _Py_JIT
+    _PyJIT_BeforeFork(interp);
+#endif
     _PyImport_AcquireLock(interp);
     _PyEval_StopTheWorldAll(&_PyRuntime);
     HEAD_LOCK(&_PyRuntime);
@@ -674,6 +679,9 @@ PyOS_AfterFork_Parent(void)
 
     PyInterpreterState *interp = _PyInterpreterState_GET();
     _PyImport_ReleaseLock(interp);
+#ifdef _Py_JIT
+    _PyJIT_AfterFork_Parent(interp);
+#endif
     run_at_forkers(interp->after_forkers_parent, 0);
 }
 
@@ -700,6 +708,7 @@ PyOS_AfterFork_Child(void)
 #ifdef Py_GIL_DISABLED
     _Py_brc_after_fork(tstate->interp);
     _Py_qsbr_after_fork((_PyThreadStateImpl *)tstate);
+    _PyGC_AfterFork_Child(runtime);
 #endif
 
     // Ideally we could guarantee tstate is running main.
@@ -723,6 +732,10 @@ PyOS_AfterFork_Child(void)
 
     _PySignal_AfterFork();
 
+#ifdef _Py_JIT
+    _PyJIT_AfterFork_Child(tstate->interp);
+#endif
+
     status = _PyInterpreterState_DeleteExceptMain(runtime);
     if (_PyStatus_EXCEPTION(status)) {
         goto fatal_error;
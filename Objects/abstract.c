@@ -5,6 +5,7 @@
 #include "pycore_call.h"          // _PyObject_CallNoArgs()
 #include "pycore_ceval.h"         // _Py_EnterRecursiveCallTstate()
 #include "pycore_crossinterp.h"   // _Py_CallInInterpreter()
+#include "pycore_floatobject.h"   // _PyFloat_FormatAdvancedWriter()
 #include "pycore_genobject.h"     // _PyGen_FetchStopIterationValue()
 #include "pycore_list.h"          // _PyList_AppendTakeRef()
 #include "pycore_long.h"          // _PyLong_IsNegative()
@@ -13,6 +14,7 @@
 #include "pycore_pyerrors.h"      // _PyErr_Occurred()
 #include "pycore_pystate.h"       // _PyThreadState_GET()
 #include "pycore_tuple.h"         // _PyTuple_FromArraySteal()
+#include "pycore_unicodeobject.h" // _PyUnicode_FormatAdvancedWriter()
 #include "pycore_unionobject.h"   // _PyUnion_Check()
 
 #include <stddef.h>               // offsetof()
@@ -839,6 +841,21 @@ _PyBuffer_ReleaseInInterpreterAndRawFree(PyInterpreterState *interp,
     return _Py_CallInInterpreterAndRawFree(interp, _buffer_release_call, view);
 }
 
+PyObject *
+_PyObject_FormatAdvanced(PyObject *obj, PyObject *format_spec,
+                         _PyFormatAdvancedWriterFunc format)
+{
+    _PyUnicodeWriter writer;
+    _PyUnicodeWriter_Init(&writer);
+    if (format(&writer, obj, format_spec, 0,
+               PyUnicode_GET_LENGTH(format_spec)) < 0)
+    {
+        _PyUnicodeWriter_Dealloc(&writer);
+        return NULL;
+    }
+    return _PyUnicodeWriter_Finish(&writer);
+}
+
 PyObject *
 PyObject_Format(PyObject *obj, PyObject *format_spec)
 {
@@ -858,10 +875,26 @@ PyObject_Format(PyObject *obj, PyObject *format_spec)
         if (PyUnicode_CheckExact(obj)) {
             return Py_NewRef(obj);
         }
-        if (PyLong_CheckExact(obj)) {
+        if (PyLong_CheckExact(obj) || PyFloat_CheckExact(obj)) {
             return PyObject_Str(obj);
         }
     }
+    else {
+        /* Same as calling __format__, without the lookup and the call. */
+        _PyFormatAdvancedWriterFunc format = NULL;
+        if (PyUnicode_CheckExact(obj)) {
+            format = _PyUnicode_FormatAdvancedWriter;
+        }
+        else if (PyLong_CheckExact(obj)) {
+            format = _PyLong_FormatAdvancedWriter;
+        }
+        else if (PyFloat_CheckExact(obj)) {
+            format = _PyFloat_FormatAdvancedWriter;
+        }
+        if (format != NULL) {
+            return _PyObject_FormatAdvanced(obj, format_spec, format);
+        }
+    }
 
     /* If no format_spec is provided, use an empty string */
     if (format_spec == NULL) {
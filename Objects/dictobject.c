@@ -5645,6 +5645,26 @@ dictiter_iternextitem(PyObject *self)
     return NULL;
 }
 
+int
+_PyDictIter_NextItem(PyObject *self, PyObject **out_key, PyObject **out_value)
+{
+    assert(Py_IS_TYPE(self, &PyDictIterItem_Type));
+    dictiterobject *di = (dictiterobject *)self;
+    PyDictObject *d = di->di_dict;
+
+    if (d == NULL) {
+        return 0;
+    }
+#ifdef Py_GIL_DISABLED
+    if (dictiter_iternext_threadsafe(d, self, out_key, out_value) == 0) {
+#else
+    if (dictiter_iternextitem_lock_held(d, self, out_key, out_value) == 0) {
+#endif
+        return 1;
+    }
+    return PyErr_Occurred() ? -1 : 0;
+}
+
 PyTypeObject PyDictIterItem_Type = {
     PyVarObject_HEAD_INIT(&PyType_Type, 0)
     "dict_itemiterator",                        /* tp_name */
@@ -2,6 +2,7 @@
 
 #include "Python.h"
 #include "pycore_call.h"          // _PyObject_CallNoArgs()
+#include "pycore_enum.h"          // _PyEnum_NextItem()
 #include "pycore_long.h"          // _PyLong_GetOne()
 #include "pycore_modsupport.h"    // _PyArg_NoKwnames()
 #include "pycore_object.h"        // _PyObject_GC_TRACK()
@@ -285,6 +286,39 @@ enum_next(PyObject *op)
     return result;
 }
 
+int
+_PyEnum_NextItem(PyObject *op, PyObject **out_index, PyObject **out_item)
+{
+    assert(Py_IS_TYPE(op, &PyEnum_Type));
+    enumobject *en = _enumobject_CAST(op);
+    PyObject *it = en->en_sit;
+    PyObject *next_index;
+
+    PyObject *next_item = (*Py_TYPE(it)->tp_iternext)(it);
+    if (next_item == NULL) {
+        return PyErr_Occurred() ? -1 : 0;
+    }
+    Py_ssize_t en_index = FT_ATOMIC_LOAD_SSIZE_RELAXED(en->en_index);
+    if (en_index == PY_SSIZE_T_MAX) {
+        Py_BEGIN_CRITICAL_SECTION(en);
+        next_index = increment_longindex_lock_held(en);
+        Py_END_CRITICAL_SECTION();
+    }
+    else {
+        next_index = PyLong_FromSsize_t(en_index);
+        if (next_index != NULL) {
+            FT_ATOMIC_STORE_SSIZE_RELAXED(en->en_index, en_index + 1);
+        }
+    }
+    if (next_index == NULL) {
+        Py_DECREF(next_item);
+        return -1;
+    }
+    *out_index = next_index;
+    *out_item = next_item;
+    return 1;
+}
+
 static PyObject *
 enum_reduce(PyObject *op, PyObject *Py_UNUSED(ignored))
 {
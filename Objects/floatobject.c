@@ -135,8 +135,45 @@ PyFloat_FromDouble(double fval)
     return (PyObject *) op;
 }
 
+/* Can the float referenced by ref be overwritten with a new value?
+ * Only if ref owns the sole reference to it. */
+static inline int
+float_stackref_is_unique(_PyStackRef ref)
+{
+#ifdef Py_GIL_DISABLED
+    if (PyStackRef_IsDeferred(ref)) {
+        return 0;
+    }
+#else
+    if (!PyStackRef_RefcountOnObject(ref)) {
+        return 0;
+    }
+#endif
+    return _PyObject_IsUniquelyReferenced(PyStackRef_AsPyObjectBorrow(ref));
+}
+
+static _PyStackRef
+float_reuse(_PyStackRef ref, double value)
+{
+    PyObject *op = PyStackRef_AsPyObjectSteal(ref);
+    assert(PyFloat_CheckExact(op));
+    ((PyFloatObject *)op)->ob_fval = value;
+    return PyStackRef_FromPyObjectSteal(op);
+}
+
 _PyStackRef _PyFloat_FromDouble_ConsumeInputs(_PyStackRef left, _PyStackRef right, double value)
 {
+    /* Intermediate results are usually only referenced from the stack.
+     * Store the result in one of them rather than freeing it and
+     * immediately allocating a new float. */
+    if (float_stackref_is_unique(left)) {
+        PyStackRef_CLOSE_SPECIALIZED(right, _PyFloat_ExactDealloc);
+        return float_reuse(left, value);
+    }
+    if (float_stackref_is_unique(right)) {
+        PyStackRef_CLOSE_SPECIALIZED(left, _PyFloat_ExactDealloc);
+        return float_reuse(right, value);
+    }
     PyStackRef_CLOSE_SPECIALIZED(left, _PyFloat_ExactDealloc);
     PyStackRef_CLOSE_SPECIALIZED(right, _PyFloat_ExactDealloc);
     return PyStackRef_FromPyObjectSteal(PyFloat_FromDouble(value));
@@ -4036,11 +4036,8 @@ listiter_setstate(PyObject *self, PyObject *state)
 
 /*********************** List Reverse Iterator **************************/
 
-typedef struct {
-    PyObject_HEAD
-    Py_ssize_t it_index;
-    PyListObject *it_seq; /* Set to NULL when iterator is exhausted */
-} listreviterobject;
+// Shares its layout with the forward iterator (see FOR_ITER_REVERSED_LIST)
+typedef _PyListIterObject listreviterobject;
 
 static void listreviter_dealloc(PyObject *);
 static int listreviter_traverse(PyObject *, visitproc, void *);
@@ -103,9 +103,6 @@ releasebuffer_call_python(PyObject *self, Py_buffer *buffer);
 static PyObject *
 slot_tp_new(PyTypeObject *type, PyObject *args, PyObject *kwds);
 
-static int
-slot_tp_setattro(PyObject *self, PyObject *name, PyObject *value);
-
 static inline PyTypeObject *
 type_from_ref(PyObject *ref)
 {
@@ -2447,6 +2444,19 @@ subtype_traverse(PyObject *self, visitproc visit, void *arg)
     return 0;
 }
 
+/* Return 1 if the tp_traverse of instances of `type` only comes from static
+   types and subtype_traverse(), which call nothing but the visit function.
+   The tp_traverse of heap types defined in C may call into the C API. */
+int
+_PyType_HasStaticTraverse(PyTypeObject *type)
+{
+    while (type->tp_traverse == subtype_traverse) {
+        type = type->tp_base;
+        assert(type);
+    }
+    return !(type->tp_flags & Py_TPFLAGS_HEAPTYPE);
+}
+
 static void
 clear_slots(PyTypeObject *type, PyObject *self)
 {
@@ -5882,6 +5892,67 @@ _PyType_CacheInitForSpecialization(PyHeapTypeObject *type, PyObject *init,
     return can_cache;
 }
 
+int
+_PyType_CacheCallForSpecialization(PyHeapTypeObject *type, PyObject *call,
+                                   unsigned int tp_version)
+{
+    if (!call || !tp_version) {
+        return 0;
+    }
+    int can_cache;
+    BEGIN_TYPE_LOCK();
+    can_cache = ((PyTypeObject*)type)->tp_version_tag == tp_version;
+    #ifdef Py_GIL_DISABLED
+    can_cache = can_cache && _PyObject_HasDeferredRefcount(call);
+    #endif
+    if (can_cache) {
+        FT_ATOMIC_STORE_PTR_RELEASE(type->_spec_cache.call, call);
+    }
+    END_TYPE_LOCK();
+    return can_cache;
+}
+
+int
+_PyType_CacheSetattrForSpecialization(PyHeapTypeObject *type, PyObject *setattr,
+                                      unsigned int tp_version)
+{
+    if (!setattr || !tp_version) {
+        return 0;
+    }
+    int can_cache;
+    BEGIN_TYPE_LOCK();
+    can_cache = ((PyTypeObject*)type)->tp_version_tag == tp_version;
+    #ifdef Py_GIL_DISABLED
+    can_cache = can_cache && _PyObject_HasDeferredRefcount(setattr);
+    #endif
+    if (can_cache) {
+        FT_ATOMIC_STORE_PTR_RELEASE(type->_spec_cache.setattr, setattr);
+    }
+    END_TYPE_LOCK();
+    return can_cache;
+}
+
+int
+_PyType_CachePropertyForSpecialization(PyHeapTypeObject *type,
+                                       PyObject *property,
+                                       unsigned int tp_version)
+{
+    if (!property || !tp_version) {
+        return 0;
+    }
+    int can_cache;
+    BEGIN_TYPE_LOCK();
+    can_cache = ((PyTypeObject*)type)->tp_version_tag == tp_version;
+    #ifdef Py_GIL_DISABLED
+    can_cache = can_cache && _PyObject_HasDeferredRefcount(property);
+    #endif
+    if (can_cache) {
+        FT_ATOMIC_STORE_PTR_RELEASE(type->_spec_cache.property, property);
+    }
+    END_TYPE_LOCK();
+    return can_cache;
+}
+
 int
 _PyType_CacheGetItemForSpecialization(PyHeapTypeObject *ht, PyObject *descriptor, uint32_t tp_version)
 {
@@ -9391,7 +9462,7 @@ hackcheck_unlocked(PyObject *self, setattrofunc func, const char *what)
     Py_ssize_t i;
     for (i = PyTuple_GET_SIZE(mro) - 1; i >= 0; i--) {
         PyTypeObject *base = _PyType_CAST(PyTuple_GET_ITEM(mro, i));
-        if (base->tp_setattro == slot_tp_setattro) {
+        if (base->tp_setattro == _Py_slot_tp_setattro) {
             /* Ignore Python classes:
                they never define their own C-level setattro. */
         }
@@ -9407,7 +9478,7 @@ hackcheck_unlocked(PyObject *self, setattrofunc func, const char *what)
             /* 'func' is the right slot function to call. */
             break;
         }
-        else if (base->tp_setattro != slot_tp_setattro) {
+        else if (base->tp_setattro != _Py_slot_tp_setattro) {
             /* 'base' is not a Python class and overrides 'func'.
                Its tp_setattro should be called instead. */
             PyErr_Format(PyExc_TypeError,
@@ -10144,8 +10215,8 @@ slot_tp_hash(PyObject *self)
     return h;
 }
 
-static PyObject *
-slot_tp_call(PyObject *self, PyObject *args, PyObject *kwds)
+PyObject *
+_Py_slot_tp_call(PyObject *self, PyObject *args, PyObject *kwds)
 {
     return call_method(self, &_Py_ID(__call__), args, kwds);
 }
@@ -10241,8 +10312,8 @@ _Py_slot_tp_getattr_hook(PyObject *self, PyObject *name)
     return res;
 }
 
-static int
-slot_tp_setattro(PyObject *self, PyObject *name, PyObject *value)
+int
+_Py_slot_tp_setattro(PyObject *self, PyObject *name, PyObject *value)
 {
     PyObject *stack[3];
     PyObject *res;
@@ -10777,7 +10848,7 @@ static pytype_slotdef slotdefs[] = {
            "__repr__($self, /)\n--\n\nReturn repr(self)."),
     TPSLOT(__hash__, tp_hash, slot_tp_hash, wrap_hashfunc,
            "__hash__($self, /)\n--\n\nReturn hash(self)."),
-    FLSLOT(__call__, tp_call, slot_tp_call, (wrapperfunc)(void(*)(void))wrap_call,
+    FLSLOT(__call__, tp_call, _Py_slot_tp_call, (wrapperfunc)(void(*)(void))wrap_call,
            "__call__($self, /, *args, **kwargs)\n--\n\nCall self as a function.",
            PyWrapperFlag_KEYWORDS),
     TPSLOT(__str__, tp_str, slot_tp_str, wrap_unaryfunc,
@@ -10787,9 +10858,9 @@ static pytype_slotdef slotdefs[] = {
            "__getattribute__($self, name, /)\n--\n\nReturn getattr(self, name)."),
     TPSLOT(__getattr__, tp_getattro, _Py_slot_tp_getattr_hook, NULL,
            "__getattr__($self, name, /)\n--\n\nImplement getattr(self, name)."),
-    TPSLOT(__setattr__, tp_setattro, slot_tp_setattro, wrap_setattr,
+    TPSLOT(__setattr__, tp_setattro, _Py_slot_tp_setattro, wrap_setattr,
            "__setattr__($self, name, value, /)\n--\n\nImplement setattr(self, name, value)."),
-    TPSLOT(__delattr__, tp_setattro, slot_tp_setattro, wrap_delattr,
+    TPSLOT(__delattr__, tp_setattro, _Py_slot_tp_setattro, wrap_delattr,
            "__delattr__($self, name, /)\n--\n\nImplement delattr(self, name)."),
     TPSLOT(__lt__, tp_richcompare, slot_tp_richcompare, richcmp_lt,
            "__lt__($self, value, /)\n--\n\nReturn self<value."),
@@ -11204,7 +11275,7 @@ update_one_slot(PyTypeObject *type, pytype_slotdef *p)
         else {
             use_generic = 1;
             generic = p->function;
-            if (p->function == slot_tp_call) {
+            if (p->function == _Py_slot_tp_call) {
                 /* A generic __call__ is incompatible with vectorcall */
                 type_clear_flags(type, Py_TPFLAGS_HAVE_VECTORCALL);
             }
@@ -827,17 +827,27 @@ dummy_func(
         }
 
         op(_BINARY_SLICE, (container, start, stop -- res)) {
-            PyObject *slice = _PyBuildSlice_ConsumeRefs(PyStackRef_AsPyObjectSteal(start),
-                                                        PyStackRef_AsPyObjectSteal(stop));
+            PyObject *start_o = PyStackRef_AsPyObjectSteal(start);
+            PyObject *stop_o = PyStackRef_AsPyObjectSteal(stop);
             PyObject *res_o;
-            // Can't use ERROR_IF() here, because we haven't
-            // DECREF'ed container yet, and we still own slice.
-            if (slice == NULL) {
-                res_o = NULL;
+            // Exact sequences sliced by ints or None don't need a slice object.
+            int handled = _PyEval_SliceSequence(PyStackRef_AsPyObjectBorrow(container),
+                                                start_o, stop_o, &res_o);
+            if (handled) {
+                Py_DECREF(start_o);
+                Py_DECREF(stop_o);
             }
             else {
-                res_o = PyObject_GetItem(PyStackRef_AsPyObjectBorrow(container), slice);
-                Py_DECREF(slice);
+                PyObject *slice = _PyBuildSlice_ConsumeRefs(start_o, stop_o);
+                // Can't use ERROR_IF() here, because we haven't
+                // DECREF'ed container yet, and we still own slice.
+                if (slice == NULL) {
+                    res_o = NULL;
+                }
+                else {
+                    res_o = PyObject_GetItem(PyStackRef_AsPyObjectBorrow(container), slice);
+                    Py_DECREF(slice);
+                }
             }
             PyStackRef_CLOSE(container);
             ERROR_IF(res_o == NULL, error);
@@ -911,15 +921,22 @@ dummy_func(
             DEOPT_IF(!_PyLong_IsNonNegativeCompact((PyLongObject *)sub));
             Py_ssize_t index = ((PyLongObject*)sub)->long_value.ob_digit[0];
             DEOPT_IF(PyUnicode_GET_LENGTH(str) <= index);
-            // Specialize for reading an ASCII character from any string:
+            // Latin-1 characters are cached singletons; anything wider
+            // needs a new one-character string.
             Py_UCS4 c = PyUnicode_READ_CHAR(str, index);
-            DEOPT_IF(Py_ARRAY_LENGTH(_Py_SINGLETON(strings).ascii) <= c);
             STAT_INC(BINARY_OP, hit);
-            PyObject *res_o = (PyObject*)&_Py_SINGLETON(strings).ascii[c];
+            PyObject *res_o;
+            if (c < 256) {
+                res_o = (PyObject *)_Py_LATIN1_CHR(c);
+            }
+            else {
+                res_o = PyUnicode_FromOrdinal(c);
+            }
             PyStackRef_CLOSE_SPECIALIZED(sub_st, _PyLong_ExactDealloc);
             DEAD(sub_st);
             PyStackRef_CLOSE(str_st);
-            res = PyStackRef_FromPyObjectImmortal(res_o);
+            ERROR_IF(res_o == NULL, error);
+            res = PyStackRef_FromPyObjectSteal(res_o);
         }
 
         op(_GUARD_NOS_TUPLE, (nos, unused -- nos, unused)) {
@@ -1597,6 +1614,8 @@ dummy_func(
             STORE_ATTR_INSTANCE_VALUE,
             STORE_ATTR_SLOT,
             STORE_ATTR_WITH_HINT,
+            STORE_ATTR_PROPERTY,
+            STORE_ATTR_SETATTR_OVERRIDDEN,
         };
 
         specializing op(_SPECIALIZE_STORE_ATTR, (counter/1, owner -- owner)) {
@@ -2191,6 +2210,7 @@ dummy_func(
 
         family(LOAD_ATTR, INLINE_CACHE_ENTRIES_LOAD_ATTR) = {
             LOAD_ATTR_INSTANCE_VALUE,
+            LOAD_ATTR_INSTANCE_VALUE_POLY,
             LOAD_ATTR_MODULE,
             LOAD_ATTR_WITH_HINT,
             LOAD_ATTR_SLOT,
@@ -2309,6 +2329,41 @@ dummy_func(
             unused/5 +
             _PUSH_NULL_CONDITIONAL;
 
+        op(_GUARD_TYPE_VERSION_POLY, (type_version/2, type_version2/2, owner -- owner)) {
+            PyTypeObject *tp = Py_TYPE(PyStackRef_AsPyObjectBorrow(owner));
+            assert(type_version != 0 && type_version2 != 0);
+            unsigned int tp_version = FT_ATOMIC_LOAD_UINT_RELAXED(tp->tp_version_tag);
+            EXIT_IF(tp_version != type_version && tp_version != type_version2);
+        }
+
+        /* Unlike _LOAD_ATTR_INSTANCE_VALUE, this caches the index into the
+         * inline values rather than the byte offset, which depends on the
+         * basic size of the type. */
+        op(_LOAD_ATTR_INSTANCE_VALUE_INDEX, (index/1, owner -- attr)) {
+            PyObject *owner_o = PyStackRef_AsPyObjectBorrow(owner);
+            PyObject **value_ptr = &_PyObject_InlineValues(owner_o)->values[index];
+            PyObject *attr_o = FT_ATOMIC_LOAD_PTR_ACQUIRE(*value_ptr);
+            DEOPT_IF(attr_o == NULL);
+            #ifdef Py_GIL_DISABLED
+            int increfed = _Py_TryIncrefCompareStackRef(value_ptr, attr_o, &attr);
+            if (!increfed) {
+                DEOPT_IF(true);
+            }
+            #else
+            attr = PyStackRef_FromPyObjectNew(attr_o);
+            #endif
+            STAT_INC(LOAD_ATTR, hit);
+            PyStackRef_CLOSE(owner);
+        }
+
+        macro(LOAD_ATTR_INSTANCE_VALUE_POLY) =
+            unused/1 + // Skip over the counter
+            _GUARD_TYPE_VERSION_POLY +
+            _CHECK_MANAGED_OBJECT_HAS_VALUES +
+            _LOAD_ATTR_INSTANCE_VALUE_INDEX +
+            unused/3 +
+            _PUSH_NULL_CONDITIONAL;
+
         op(_LOAD_ATTR_MODULE, (dict_version/2, index/1, owner -- attr)) {
             PyObject *owner_o = PyStackRef_AsPyObjectBorrow(owner);
             DEOPT_IF(Py_TYPE(owner_o)->tp_getattro != PyModule_Type.tp_getattro);
@@ -2589,9 +2644,63 @@ dummy_func(
             _GUARD_TYPE_VERSION +
             _STORE_ATTR_SLOT;
 
+        /* The property and __setattr__ function are borrowed from the type's
+         * specialization cache: the type version guard keeps them alive.
+         * The property's setter is read each time, as property.__init__ can
+         * replace it. Unlike LOAD_ATTR_PROPERTY this calls the setter rather
+         * than pushing a frame, since its return value has to be discarded. */
+        op(_STORE_ATTR_PROPERTY, (value, owner --)) {
+            PyHeapTypeObject *ht = (PyHeapTypeObject *)PyStackRef_TYPE(owner);
+            PyObject *descr = FT_ATOMIC_LOAD_PTR_ACQUIRE(ht->_spec_cache.property);
+            assert(Py_IS_TYPE(descr, &PyProperty_Type));
+            PyObject *name = GETITEM(FRAME_CO_NAMES, oparg);
+            DEOPT_IF(((_PyPropertyObject *)descr)->prop_name != name);
+            PyObject *fset = ((_PyPropertyObject *)descr)->prop_set;
+            DEOPT_IF(fset == NULL);
+            STAT_INC(STORE_ATTR, hit);
+            PyObject *args[2] = {
+                PyStackRef_AsPyObjectBorrow(owner),
+                PyStackRef_AsPyObjectBorrow(value),
+            };
+            PyObject *res = PyObject_Vectorcall(fset, args, 2, NULL);
+            DECREF_INPUTS();
+            ERROR_IF(res == NULL, error);
+            Py_DECREF(res);
+        }
+
+        macro(STORE_ATTR_PROPERTY) =
+            unused/1 +
+            _GUARD_TYPE_VERSION +
+            unused/1 +
+            _STORE_ATTR_PROPERTY;
+
+        op(_STORE_ATTR_SETATTR_OVERRIDDEN, (value, owner --)) {
+            PyHeapTypeObject *ht = (PyHeapTypeObject *)PyStackRef_TYPE(owner);
+            PyObject *setattr = FT_ATOMIC_LOAD_PTR_ACQUIRE(ht->_spec_cache.setattr);
+            assert(Py_IS_TYPE(setattr, &PyFunction_Type));
+            STAT_INC(STORE_ATTR, hit);
+            PyObject *args[3] = {
+                PyStackRef_AsPyObjectBorrow(owner),
+                GETITEM(FRAME_CO_NAMES, oparg),
+                PyStackRef_AsPyObjectBorrow(value),
+            };
+            PyObject *res = PyObject_Vectorcall(setattr, args, 3, NULL);
+            DECREF_INPUTS();
+            ERROR_IF(res == NULL, error);
+            Py_DECREF(res);
+        }
+
+        macro(STORE_ATTR_SETATTR_OVERRIDDEN) =
+            unused/1 +
+            _GUARD_TYPE_VERSION +
+            unused/1 +
+            _STORE_ATTR_SETATTR_OVERRIDDEN;
+
         family(COMPARE_OP, INLINE_CACHE_ENTRIES_COMPARE_OP) = {
             COMPARE_OP_FLOAT,
+            COMPARE_OP_FLOAT_INT,
             COMPARE_OP_INT,
+            COMPARE_OP_INT_FLOAT,
             COMPARE_OP_STR,
         };
 
@@ -2634,6 +2743,12 @@ dummy_func(
         macro(COMPARE_OP_INT) =
             _GUARD_TOS_INT + _GUARD_NOS_INT + unused/1 + _COMPARE_OP_INT;
 
+        macro(COMPARE_OP_FLOAT_INT) =
+            _GUARD_TOS_INT + _GUARD_NOS_FLOAT + unused/1 + _COMPARE_OP_FLOAT_INT;
+
+        macro(COMPARE_OP_INT_FLOAT) =
+            _GUARD_TOS_FLOAT + _GUARD_NOS_INT + unused/1 + _COMPARE_OP_INT_FLOAT;
+
         macro(COMPARE_OP_STR) =
             _GUARD_TOS_UNICODE + _GUARD_NOS_UNICODE + unused/1 + _COMPARE_OP_STR;
 
@@ -2676,6 +2791,45 @@ dummy_func(
             // It's always a bool, so we don't care about oparg & 16.
         }
 
+        // Similar to COMPARE_OP_FLOAT. A compact int has at most one digit,
+        // so it converts to a double exactly.
+        op(_COMPARE_OP_FLOAT_INT, (left, right -- res)) {
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+
+            DEOPT_IF(!_PyLong_IsCompact((PyLongObject *)right_o));
+            STAT_INC(COMPARE_OP, hit);
+            double dleft = PyFloat_AS_DOUBLE(left_o);
+            double dright = (double)_PyLong_CompactValue((PyLongObject *)right_o);
+            // 1 if NaN, 2 if <, 4 if >, 8 if ==; this matches low four bits of the oparg
+            int sign_ish = COMPARISON_BIT(dleft, dright);
+            PyStackRef_CLOSE_SPECIALIZED(left, _PyFloat_ExactDealloc);
+            DEAD(left);
+            PyStackRef_CLOSE_SPECIALIZED(right, _PyLong_ExactDealloc);
+            DEAD(right);
+            res = (sign_ish & oparg) ? PyStackRef_True : PyStackRef_False;
+            // It's always a bool, so we don't care about oparg & 16.
+        }
+
+        // Similar to COMPARE_OP_FLOAT_INT, with the operands swapped
+        op(_COMPARE_OP_INT_FLOAT, (left, right -- res)) {
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+
+            DEOPT_IF(!_PyLong_IsCompact((PyLongObject *)left_o));
+            STAT_INC(COMPARE_OP, hit);
+            double dleft = (double)_PyLong_CompactValue((PyLongObject *)left_o);
+            double dright = PyFloat_AS_DOUBLE(right_o);
+            // 1 if NaN, 2 if <, 4 if >, 8 if ==; this matches low four bits of the oparg
+            int sign_ish = COMPARISON_BIT(dleft, dright);
+            PyStackRef_CLOSE_SPECIALIZED(left, _PyLong_ExactDealloc);
+            DEAD(left);
+            PyStackRef_CLOSE_SPECIALIZED(right, _PyFloat_ExactDealloc);
+            DEAD(right);
+            res = (sign_ish & oparg) ? PyStackRef_True : PyStackRef_False;
+            // It's always a bool, so we don't care about oparg & 16.
+        }
+
         // Similar to COMPARE_OP_FLOAT, but for ==, != only
         op(_COMPARE_OP_STR, (left, right -- res)) {
             PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
@@ -2704,6 +2858,7 @@ dummy_func(
         family(CONTAINS_OP, INLINE_CACHE_ENTRIES_CONTAINS_OP) = {
             CONTAINS_OP_SET,
             CONTAINS_OP_DICT,
+            CONTAINS_OP_STR_TUPLE,
         };
 
         op(_CONTAINS_OP, (left, right -- b)) {
@@ -2720,7 +2875,7 @@ dummy_func(
             #if ENABLE_SPECIALIZATION_FT
             if (ADAPTIVE_COUNTER_TRIGGERS(counter)) {
                 next_instr = this_instr;
-                _Py_Specialize_ContainsOp(right, next_instr);
+                _Py_Specialize_ContainsOp(left, right, next_instr);
                 DISPATCH_SAME_OPARG();
             }
             OPCODE_DEFERRED_INC(CONTAINS_OP);
@@ -2764,6 +2919,35 @@ dummy_func(
             b = (res ^ oparg) ? PyStackRef_True : PyStackRef_False;
         }
 
+        macro(CONTAINS_OP_STR_TUPLE) = _GUARD_TOS_TUPLE + _GUARD_NOS_UNICODE + unused/1 + _CONTAINS_OP_STR_TUPLE;
+
+        op(_CONTAINS_OP_STR_TUPLE, (left, right -- b)) {
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+
+            assert(PyUnicode_CheckExact(left_o));
+            assert(PyTuple_CheckExact(right_o));
+            // An exact str only compares equal to another str, so the scan
+            // needs no rich comparisons as long as every item is an exact str.
+            int res = 0;
+            Py_ssize_t n = PyTuple_GET_SIZE(right_o);
+            for (Py_ssize_t i = 0; i < n; i++) {
+                PyObject *item = PyTuple_GET_ITEM(right_o, i);
+                if (item == left_o) {
+                    res = 1;
+                    break;
+                }
+                DEOPT_IF(!PyUnicode_CheckExact(item));
+                if (_PyUnicode_Equal(item, left_o)) {
+                    res = 1;
+                    break;
+                }
+            }
+            STAT_INC(CONTAINS_OP, hit);
+            DECREF_INPUTS();
+            b = (res ^ oparg) ? PyStackRef_True : PyStackRef_False;
+        }
+
         inst(CHECK_EG_MATCH, (exc_value_st, match_type_st -- rest, match)) {
             PyObject *exc_value = PyStackRef_AsPyObjectBorrow(exc_value_st);
             PyObject *match_type = PyStackRef_AsPyObjectBorrow(match_type_st);
@@ -2859,10 +3043,16 @@ dummy_func(
                     ERROR_IF(optimized < 0, error);
                 }
                 else {
-                    this_instr[1].counter = initial_jump_backoff_counter();
-                    assert(tstate->previous_executor == NULL);
-                    tstate->previous_executor = Py_None;
-                    GOTO_TIER_TWO(executor);
+                    this_instr[1].counter = rearm_backoff_counter(counter);
+                    if (!_PyExecutor_IsReady(executor)) {
+                        // ENTER_EXECUTOR will use it once it is ready
+                        Py_DECREF(executor);
+                    }
+                    else {
+                        assert(tstate->previous_executor == NULL);
+                        tstate->previous_executor = Py_None;
+                        GOTO_TIER_TWO(executor);
+                    }
                 }
             }
             else {
@@ -2916,8 +3106,11 @@ dummy_func(
             assert(tstate->previous_executor == NULL);
             /* If the eval breaker is set then stay in tier 1.
              * This avoids any potentially infinite loops
-             * involving _RESUME_CHECK */
-            if (_Py_atomic_load_uintptr_relaxed(&tstate->eval_breaker) & _PY_EVAL_EVENTS_MASK) {
+             * involving _RESUME_CHECK. Also stay in tier 1 until the
+             * executor's machine code is ready. */
+            if ((_Py_atomic_load_uintptr_relaxed(&tstate->eval_breaker) & _PY_EVAL_EVENTS_MASK) ||
+                !_PyExecutor_IsReady(executor))
+            {
                 opcode = executor->vm_data.opcode;
                 oparg = (oparg & ~255) | executor->vm_data.oparg;
                 next_instr = this_instr;
@@ -3075,6 +3268,9 @@ dummy_func(
             FOR_ITER_TUPLE,
             FOR_ITER_RANGE,
             FOR_ITER_GEN,
+            FOR_ITER_DICT_ITEMS,
+            FOR_ITER_ENUMERATE,
+            FOR_ITER_REVERSED_LIST,
         };
 
         specializing op(_SPECIALIZE_FOR_ITER, (counter/1, iter -- iter)) {
@@ -3418,6 +3614,206 @@ dummy_func(
             _FOR_ITER_GEN_FRAME +
             _PUSH_FRAME;
 
+        op(_ITER_CHECK_DICT_ITEMS, (iter -- iter)) {
+            PyObject *iter_o = PyStackRef_AsPyObjectBorrow(iter);
+            EXIT_IF(Py_TYPE(iter_o) != &PyDictIterItem_Type);
+#ifdef Py_GIL_DISABLED
+            EXIT_IF(!_PyObject_IsUniquelyReferenced(iter_o));
+#endif
+        }
+
+        replaced op(_ITER_NEXT_DICT_ITEMS, (iter -- iter, next)) {
+            PyObject *iter_o = PyStackRef_AsPyObjectBorrow(iter);
+            assert(Py_TYPE(iter_o) == &PyDictIterItem_Type);
+            STAT_INC(FOR_ITER, hit);
+            PyObject *next_o = PyDictIterItem_Type.tp_iternext(iter_o);
+            if (next_o == NULL) {
+                if (_PyErr_Occurred(tstate)) {
+                    ERROR_NO_POP();
+                }
+                /* Jump forward oparg, then skip following END_FOR instruction */
+                JUMPBY(oparg + 1);
+                DISPATCH();
+            }
+            next = PyStackRef_FromPyObjectSteal(next_o);
+        }
+
+        // Only used by Tier 2
+        op(_ITER_NEXT_DICT_ITEMS_TIER_TWO, (iter -- iter, next)) {
+            PyObject *iter_o = PyStackRef_AsPyObjectBorrow(iter);
+            assert(Py_TYPE(iter_o) == &PyDictIterItem_Type);
+            PyObject *next_o = PyDictIterItem_Type.tp_iternext(iter_o);
+            if (next_o == NULL) {
+                if (_PyErr_Occurred(tstate)) {
+                    ERROR_NO_POP();
+                }
+                /* The translator sets the deopt target just past the matching END_FOR */
+                EXIT_IF(true);
+            }
+            next = PyStackRef_FromPyObjectSteal(next_o);
+        }
+
+        // Only used by Tier 2, for FOR_ITER_DICT_ITEMS followed by
+        // UNPACK_SEQUENCE 2: pushes the key and value without a tuple.
+        op(_ITER_NEXT_DICT_ITEMS_UNPACK, (iter -- iter, value, key)) {
+            PyObject *iter_o = PyStackRef_AsPyObjectBorrow(iter);
+            assert(Py_TYPE(iter_o) == &PyDictIterItem_Type);
+            PyObject *key_o, *value_o;
+            int res = _PyDictIter_NextItem(iter_o, &key_o, &value_o);
+            if (res < 0) {
+                ERROR_NO_POP();
+            }
+            /* The translator sets the deopt target just past the matching END_FOR */
+            EXIT_IF(res == 0);
+            key = PyStackRef_FromPyObjectSteal(key_o);
+            value = PyStackRef_FromPyObjectSteal(value_o);
+        }
+
+        macro(FOR_ITER_DICT_ITEMS) =
+            unused/1 +  // Skip over the counter
+            _ITER_CHECK_DICT_ITEMS +
+            _ITER_NEXT_DICT_ITEMS;
+
+        op(_ITER_CHECK_ENUMERATE, (iter -- iter)) {
+            PyObject *iter_o = PyStackRef_AsPyObjectBorrow(iter);
+            EXIT_IF(Py_TYPE(iter_o) != &PyEnum_Type);
+#ifdef Py_GIL_DISABLED
+            EXIT_IF(!_PyObject_IsUniquelyReferenced(iter_o));
+#endif
+        }
+
+        replaced op(_ITER_NEXT_ENUMERATE, (iter -- iter, next)) {
+            PyObject *iter_o = PyStackRef_AsPyObjectBorrow(iter);
+            assert(Py_TYPE(iter_o) == &PyEnum_Type);
+            STAT_INC(FOR_ITER, hit);
+            PyObject *next_o = PyEnum_Type.tp_iternext(iter_o);
+            if (next_o == NULL) {
+                if (_PyErr_Occurred(tstate)) {
+                    int matches = _PyErr_ExceptionMatches(tstate, PyExc_StopIteration);
+                    if (!matches) {
+                        ERROR_NO_POP();
+                    }
+                    _PyEval_MonitorRaise(tstate, frame, this_instr);
+                    _PyErr_Clear(tstate);
+                }
+                /* Jump forward oparg, then skip following END_FOR instruction */
+                JUMPBY(oparg + 1);
+                DISPATCH();
+            }
+            next = PyStackRef_FromPyObjectSteal(next_o);
+        }
+
+        // Only used by Tier 2
+        op(_ITER_NEXT_ENUMERATE_TIER_TWO, (iter -- iter, next)) {
+            PyObject *iter_o = PyStackRef_AsPyObjectBorrow(iter);
+            assert(Py_TYPE(iter_o) == &PyEnum_Type);
+            PyObject *next_o = PyEnum_Type.tp_iternext(iter_o);
+            if (next_o == NULL) {
+                if (_PyErr_Occurred(tstate)) {
+                    int matches = _PyErr_ExceptionMatches(tstate, PyExc_StopIteration);
+                    if (!matches) {
+                        ERROR_NO_POP();
+                    }
+                    _PyEval_MonitorRaise(tstate, frame, frame->instr_ptr);
+                    _PyErr_Clear(tstate);
+                }
+                /* The translator sets the deopt target just past the matching END_FOR */
+                EXIT_IF(true);
+            }
+            next = PyStackRef_FromPyObjectSteal(next_o);
+        }
+
+        // Only used by Tier 2, for FOR_ITER_ENUMERATE followed by
+        // UNPACK_SEQUENCE 2: pushes the index and item without a tuple.
+        op(_ITER_NEXT_ENUMERATE_UNPACK, (iter -- iter, item, index)) {
+            PyObject *iter_o = PyStackRef_AsPyObjectBorrow(iter);
+            assert(Py_TYPE(iter_o) == &PyEnum_Type);
+            PyObject *index_o, *item_o;
+            int res = _PyEnum_NextItem(iter_o, &index_o, &item_o);
+            if (res < 0) {
+                int matches = _PyErr_ExceptionMatches(tstate, PyExc_StopIteration);
+                if (!matches) {
+                    ERROR_NO_POP();
+                }
+                _PyEval_MonitorRaise(tstate, frame, frame->instr_ptr);
+                _PyErr_Clear(tstate);
+            }
+            /* The translator sets the deopt target just past the matching END_FOR */
+            EXIT_IF(res <= 0);
+            index = PyStackRef_FromPyObjectSteal(index_o);
+            item = PyStackRef_FromPyObjectSteal(item_o);
+        }
+
+        macro(FOR_ITER_ENUMERATE) =
+            unused/1 +  // Skip over the counter
+            _ITER_CHECK_ENUMERATE +
+            _ITER_NEXT_ENUMERATE;
+
+        op(_ITER_CHECK_REVERSED_LIST, (iter -- iter)) {
+            PyObject *iter_o = PyStackRef_AsPyObjectBorrow(iter);
+            EXIT_IF(Py_TYPE(iter_o) != &PyListRevIter_Type);
+#ifdef Py_GIL_DISABLED
+            // Only specialized in the default build
+            EXIT_IF(true);
+#endif
+        }
+
+        replaced op(_ITER_JUMP_REVERSED_LIST, (iter -- iter)) {
+            PyObject *iter_o = PyStackRef_AsPyObjectBorrow(iter);
+            assert(Py_TYPE(iter_o) == &PyListRevIter_Type);
+#ifndef Py_GIL_DISABLED
+            // list_reverseiterator shares the layout of list_iterator:
+            _PyListIterObject *it = (_PyListIterObject *)iter_o;
+            STAT_INC(FOR_ITER, hit);
+            PyListObject *seq = it->it_seq;
+            if (seq == NULL || it->it_index < 0 ||
+                it->it_index >= PyList_GET_SIZE(seq))
+            {
+                it->it_index = -1;
+                if (seq != NULL) {
+                    it->it_seq = NULL;
+                    Py_DECREF(seq);
+                }
+                /* Jump forward oparg, then skip following END_FOR instruction */
+                JUMPBY(oparg + 1);
+                DISPATCH();
+            }
+#else
+            (void)iter_o;
+#endif
+        }
+
+        // Only used by Tier 2
+        op(_GUARD_NOT_EXHAUSTED_REVERSED_LIST, (iter -- iter)) {
+#ifndef Py_GIL_DISABLED
+            PyObject *iter_o = PyStackRef_AsPyObjectBorrow(iter);
+            _PyListIterObject *it = (_PyListIterObject *)iter_o;
+            assert(Py_TYPE(iter_o) == &PyListRevIter_Type);
+            PyListObject *seq = it->it_seq;
+            EXIT_IF(seq == NULL);
+            if (it->it_index < 0 || it->it_index >= PyList_GET_SIZE(seq)) {
+                it->it_index = -1;
+                EXIT_IF(1);
+            }
+#endif
+        }
+
+        op(_ITER_NEXT_REVERSED_LIST, (iter -- iter, next)) {
+            PyObject *iter_o = PyStackRef_AsPyObjectBorrow(iter);
+            _PyListIterObject *it = (_PyListIterObject *)iter_o;
+            assert(Py_TYPE(iter_o) == &PyListRevIter_Type);
+            PyListObject *seq = it->it_seq;
+            assert(seq);
+            assert(it->it_index >= 0 && it->it_index < PyList_GET_SIZE(seq));
+            next = PyStackRef_FromPyObjectNew(PyList_GET_ITEM(seq, it->it_index--));
+        }
+
+        macro(FOR_ITER_REVERSED_LIST) =
+            unused/1 +  // Skip over the counter
+            _ITER_CHECK_REVERSED_LIST +
+            _ITER_JUMP_REVERSED_LIST +
+            _ITER_NEXT_REVERSED_LIST;
+
         inst(LOAD_SPECIAL, (owner -- attr, self_or_null)) {
             assert(oparg <= SPECIAL_MAX);
             PyObject *owner_o = PyStackRef_AsPyObjectSteal(owner);
@@ -3633,6 +4029,7 @@ dummy_func(
             CALL_ALLOC_AND_ENTER_INIT,
             CALL_PY_GENERAL,
             CALL_BOUND_METHOD_GENERAL,
+            CALL_DUNDER_CALL,
             CALL_NON_PY_GENERAL,
         };
 
@@ -3831,6 +4228,35 @@ dummy_func(
             _SAVE_RETURN_OFFSET +
             _PUSH_FRAME;
 
+        op(_CHECK_DUNDER_CALL, (type_version/2, callable[1], null[1], unused[oparg] -- callable[1], null[1], unused[oparg])) {
+            PyTypeObject *tp = PyStackRef_TYPE(callable[0]);
+            EXIT_IF(FT_ATOMIC_LOAD_UINT32_RELAXED(tp->tp_version_tag) != type_version);
+            EXIT_IF(!PyStackRef_IsNull(null[0]));
+            assert(tp->tp_flags & Py_TPFLAGS_HEAPTYPE);
+            assert(tp->tp_call == _Py_slot_tp_call);
+        }
+
+        op(_EXPAND_DUNDER_CALL, (callable[1], self_or_null[1], unused[oparg] -- callable[1], self_or_null[1], unused[oparg])) {
+            assert(PyStackRef_IsNull(self_or_null[0]));
+            PyHeapTypeObject *cls = (PyHeapTypeObject *)PyStackRef_TYPE(callable[0]);
+            PyObject *call = FT_ATOMIC_LOAD_PTR_ACQUIRE(cls->_spec_cache.call);
+            assert(PyFunction_Check(call));
+            STAT_INC(CALL, hit);
+            // The instance becomes self; __call__ takes its place:
+            self_or_null[0] = callable[0];
+            callable[0] = PyStackRef_FromPyObjectNew(call);
+        }
+
+        macro(CALL_DUNDER_CALL) =
+            unused/1 + // Skip over the counter
+            _CHECK_PEP_523 +
+            _CHECK_DUNDER_CALL +
+            _EXPAND_DUNDER_CALL +
+            flush + // so that self is in the argument array
+            _PY_FRAME_GENERAL +
+            _SAVE_RETURN_OFFSET +
+            _PUSH_FRAME;
+
         op(_CHECK_IS_NOT_PY_CALLABLE, (callable[1], unused[1], unused[oparg] -- callable[1], unused[1], unused[oparg])) {
             PyObject *callable_o = PyStackRef_AsPyObjectBorrow(callable[0]);
             EXIT_IF(PyFunction_Check(callable_o));
@@ -4901,7 +5327,25 @@ dummy_func(
             result = PyStackRef_FromPyObjectSteal(result_o);
         }
 
-        inst(FORMAT_SIMPLE, (value -- res)) {
+        family(FORMAT_SIMPLE, INLINE_CACHE_ENTRIES_FORMAT_SIMPLE) = {
+            FORMAT_SIMPLE_STR,
+            FORMAT_SIMPLE_INT,
+            FORMAT_SIMPLE_FLOAT,
+        };
+
+        specializing op(_SPECIALIZE_FORMAT_SIMPLE, (counter/1, value -- value)) {
+            #if ENABLE_SPECIALIZATION_FT
+            if (ADAPTIVE_COUNTER_TRIGGERS(counter)) {
+                next_instr = this_instr;
+                _Py_Specialize_FormatSimple(value, next_instr);
+                DISPATCH_SAME_OPARG();
+            }
+            OPCODE_DEFERRED_INC(FORMAT_SIMPLE);
+            ADVANCE_ADAPTIVE_COUNTER(this_instr[1].counter);
+            #endif  /* ENABLE_SPECIALIZATION_FT */
+        }
+
+        op(_FORMAT_SIMPLE, (value -- res)) {
             PyObject *value_o = PyStackRef_AsPyObjectBorrow(value);
             /* If value is a unicode object, then we know the result
              * of format(value) is value itself. */
@@ -4917,13 +5361,117 @@ dummy_func(
             }
         }
 
-        inst(FORMAT_WITH_SPEC, (value, fmt_spec -- res)) {
+        macro(FORMAT_SIMPLE) = _SPECIALIZE_FORMAT_SIMPLE + _FORMAT_SIMPLE;
+
+        macro(FORMAT_SIMPLE_STR) = _GUARD_TOS_UNICODE + unused/1 + _FORMAT_SIMPLE_STR;
+
+        op(_FORMAT_SIMPLE_STR, (value -- res)) {
+            assert(PyUnicode_CheckExact(PyStackRef_AsPyObjectBorrow(value)));
+            STAT_INC(FORMAT_SIMPLE, hit);
+            res = value;
+            DEAD(value);
+        }
+
+        macro(FORMAT_SIMPLE_INT) = _GUARD_TOS_INT + unused/1 + _FORMAT_SIMPLE_INT;
+
+        op(_FORMAT_SIMPLE_INT, (value -- res)) {
+            PyObject *value_o = PyStackRef_AsPyObjectBorrow(value);
+            assert(PyLong_CheckExact(value_o));
+            STAT_INC(FORMAT_SIMPLE, hit);
+            PyObject *res_o = _PyLong_Format(value_o, 10);
+            PyStackRef_CLOSE(value);
+            ERROR_IF(res_o == NULL, error);
+            res = PyStackRef_FromPyObjectSteal(res_o);
+        }
+
+        macro(FORMAT_SIMPLE_FLOAT) = _GUARD_TOS_FLOAT + unused/1 + _FORMAT_SIMPLE_FLOAT;
+
+        op(_FORMAT_SIMPLE_FLOAT, (value -- res)) {
+            PyObject *value_o = PyStackRef_AsPyObjectBorrow(value);
+            assert(PyFloat_CheckExact(value_o));
+            STAT_INC(FORMAT_SIMPLE, hit);
+            // str() and repr() are the same for floats
+            PyObject *res_o = PyFloat_Type.tp_repr(value_o);
+            PyStackRef_CLOSE(value);
+            ERROR_IF(res_o == NULL, error);
+            res = PyStackRef_FromPyObjectSteal(res_o);
+        }
+
+        family(FORMAT_WITH_SPEC, INLINE_CACHE_ENTRIES_FORMAT_WITH_SPEC) = {
+            FORMAT_WITH_SPEC_STR,
+            FORMAT_WITH_SPEC_INT,
+            FORMAT_WITH_SPEC_FLOAT,
+        };
+
+        specializing op(_SPECIALIZE_FORMAT_WITH_SPEC, (counter/1, value, fmt_spec -- value, fmt_spec)) {
+            #if ENABLE_SPECIALIZATION_FT
+            if (ADAPTIVE_COUNTER_TRIGGERS(counter)) {
+                next_instr = this_instr;
+                _Py_Specialize_FormatWithSpec(value, next_instr);
+                DISPATCH_SAME_OPARG();
+            }
+            OPCODE_DEFERRED_INC(FORMAT_WITH_SPEC);
+            ADVANCE_ADAPTIVE_COUNTER(this_instr[1].counter);
+            #endif  /* ENABLE_SPECIALIZATION_FT */
+        }
+
+        op(_FORMAT_WITH_SPEC, (value, fmt_spec -- res)) {
             PyObject *res_o = PyObject_Format(PyStackRef_AsPyObjectBorrow(value), PyStackRef_AsPyObjectBorrow(fmt_spec));
             DECREF_INPUTS();
             ERROR_IF(res_o == NULL, error);
             res = PyStackRef_FromPyObjectSteal(res_o);
         }
 
+        macro(FORMAT_WITH_SPEC) = _SPECIALIZE_FORMAT_WITH_SPEC + _FORMAT_WITH_SPEC;
+
+        /* The compiler only emits str format specs, so only the value needs
+         * a guard. These call the type's formatter directly instead of
+         * looking up and calling its __format__ method. */
+        macro(FORMAT_WITH_SPEC_STR) = _GUARD_NOS_UNICODE + unused/1 + _FORMAT_WITH_SPEC_STR;
+
+        op(_FORMAT_WITH_SPEC_STR, (value, fmt_spec -- res)) {
+            PyObject *value_o = PyStackRef_AsPyObjectBorrow(value);
+            PyObject *spec_o = PyStackRef_AsPyObjectBorrow(fmt_spec);
+            assert(PyUnicode_CheckExact(value_o));
+            assert(PyUnicode_Check(spec_o));
+            STAT_INC(FORMAT_WITH_SPEC, hit);
+            PyObject *res_o = _PyObject_FormatAdvanced(
+                value_o, spec_o, _PyUnicode_FormatAdvancedWriter);
+            DECREF_INPUTS();
+            ERROR_IF(res_o == NULL, error);
+            res = PyStackRef_FromPyObjectSteal(res_o);
+        }
+
+        macro(FORMAT_WITH_SPEC_INT) = _GUARD_NOS_INT + unused/1 + _FORMAT_WITH_SPEC_INT;
+
+        op(_FORMAT_WITH_SPEC_INT, (value, fmt_spec -- res)) {
+            PyObject *value_o = PyStackRef_AsPyObjectBorrow(value);
+            PyObject *spec_o = PyStackRef_AsPyObjectBorrow(fmt_spec);
+            assert(PyLong_CheckExact(value_o));
+            assert(PyUnicode_Check(spec_o));
+            STAT_INC(FORMAT_WITH_SPEC, hit);
+            PyObject *res_o = _PyObject_FormatAdvanced(
+                value_o, spec_o, _PyLong_FormatAdvancedWriter);
+            DECREF_INPUTS();
+            ERROR_IF(res_o == NULL, error);
+            res = PyStackRef_FromPyObjectSteal(res_o);
+        }
+
+        macro(FORMAT_WITH_SPEC_FLOAT) = _GUARD_NOS_FLOAT + unused/1 + _FORMAT_WITH_SPEC_FLOAT;
+
+        op(_FORMAT_WITH_SPEC_FLOAT, (value, fmt_spec -- res)) {
+            PyObject *value_o = PyStackRef_AsPyObjectBorrow(value);
+            PyObject *spec_o = PyStackRef_AsPyObjectBorrow(fmt_spec);
+            assert(PyFloat_CheckExact(value_o));
+            assert(PyUnicode_Check(spec_o));
+            STAT_INC(FORMAT_WITH_SPEC, hit);
+            PyObject *res_o = _PyObject_FormatAdvanced(
+                value_o, spec_o, _PyFloat_FormatAdvancedWriter);
+            DECREF_INPUTS();
+            ERROR_IF(res_o == NULL, error);
+            res = PyStackRef_FromPyObjectSteal(res_o);
+        }
+
         pure inst(COPY, (bottom, unused[oparg-1] -- bottom, unused[oparg-1], top)) {
             assert(oparg > 0);
             top = PyStackRef_DUP(bottom);
@@ -5149,6 +5697,7 @@ dummy_func(
             _PyExitData *exit = (_PyExitData *)exit_p;
             PyCodeObject *code = _PyFrame_GetCode(frame);
             _Py_CODEUNIT *target = _PyFrame_GetBytecode(frame) + exit->target;
+            exit->hit_count++;
         #if defined(Py_DEBUG) && !defined(_Py_JIT)
             OPT_HIST(trace_uop_execution_counter, trace_run_length_hist);
             if (frame->lltrace >= 2) {
@@ -5161,7 +5710,8 @@ dummy_func(
             }
         #endif
             if (exit->executor && !exit->executor->vm_data.valid) {
-                exit->temperature = initial_temperature_backoff_counter();
+                // Each invalidation doubles the wait before retracing:
+                exit->temperature = restart_backoff_counter(exit->temperature);
                 Py_CLEAR(exit->executor);
             }
             tstate->previous_executor = (PyObject *)current_executor;
@@ -5183,10 +5733,13 @@ dummy_func(
                         exit->temperature = restart_backoff_counter(temperature);
                         GOTO_TIER_ONE(optimized < 0 ? NULL : target);
                     }
-                    exit->temperature = initial_temperature_backoff_counter();
+                    exit->temperature = rearm_backoff_counter(temperature);
                 }
                 exit->executor = executor;
             }
+            if (!_PyExecutor_IsReady((_PyExecutorObject *)exit->executor)) {
+                GOTO_TIER_ONE(target);
+            }
             Py_INCREF(exit->executor);
             GOTO_TIER_TWO(exit->executor);
         }
@@ -5219,6 +5772,50 @@ dummy_func(
             value = PyStackRef_FromPyObjectImmortal(ptr);
         }
 
+        /* Replaces a tuple that is built and then immediately unpacked */
+        tier2 pure op(_REVERSE, (values[oparg] -- values[oparg])) {
+            for (int lo = 0, hi = oparg - 1; lo < hi; lo++, hi--) {
+                _PyStackRef temp = values[lo];
+                values[lo] = values[hi];
+                values[hi] = temp;
+            }
+        }
+
+        /* Replace a call to a function that only returns a constant */
+        tier2 op(_POP_CALL_LOAD_CONST_INLINE, (ptr/4, callable[1], self_or_null[1], args[oparg] -- value)) {
+            for (int i = oparg - 1; i >= 0; i--) {
+                _PyStackRef arg = args[i];
+                args[i] = PyStackRef_NULL;
+                PyStackRef_CLOSE(arg);
+            }
+            DEAD(args);
+            PyStackRef_XCLOSE(self_or_null[0]);
+            PyStackRef_CLOSE(callable[0]);
+            value = PyStackRef_FromPyObjectNew(ptr);
+        }
+
+        /* Replace a call to a function that only returns one of its
+         * arguments. The index counts self, if present. */
+        tier2 op(_POP_CALL_LOAD_ARG, (index/1, callable[1], self_or_null[1], args[oparg] -- value)) {
+            _PyStackRef *first = args;
+            int total_args = oparg;
+            if (!PyStackRef_IsNull(self_or_null[0])) {
+                first--;
+                total_args++;
+            }
+            assert((int)index < total_args);
+            PyObject *value_o = PyStackRef_AsPyObjectNew(first[index]);
+            for (int i = oparg - 1; i >= 0; i--) {
+                _PyStackRef arg = args[i];
+                args[i] = PyStackRef_NULL;
+                PyStackRef_CLOSE(arg);
+            }
+            DEAD(args);
+            PyStackRef_XCLOSE(self_or_null[0]);
+            PyStackRef_CLOSE(callable[0]);
+            value = PyStackRef_FromPyObjectSteal(value_o);
+        }
+
         tier2 op(_CHECK_FUNCTION, (func_version/2 -- )) {
             assert(PyStackRef_FunctionCheck(frame->f_funcobj));
             PyFunctionObject *func = (PyFunctionObject *)PyStackRef_AsPyObjectBorrow(frame->f_funcobj);
@@ -5235,6 +5832,7 @@ dummy_func(
 
         tier2 op(_MAKE_WARM, (--)) {
             current_executor->vm_data.warm = true;
+            current_executor->run_count++;
             // It's okay if this ends up going negative.
             if (--tstate->interp->trace_run_counter == 0) {
                 _Py_set_eval_breaker_bit(tstate, _PY_EVAL_JIT_INVALIDATE_COLD_BIT);
@@ -5247,6 +5845,7 @@ dummy_func(
         }
 
         tier2 op(_DEOPT, (--)) {
+            current_executor->deopt_count++;
             tstate->previous_executor = (PyObject *)current_executor;
             GOTO_TIER_ONE(_PyFrame_GetBytecode(frame) + CURRENT_TARGET());
         }
@@ -10,8 +10,10 @@
 #include "pycore_cell.h"          // PyCell_GetRef()
 #include "pycore_ceval.h"
 #include "pycore_code.h"
+#include "pycore_descrobject.h"   // _PyPropertyObject
 #include "pycore_dict.h"
 #include "pycore_emscripten_signal.h"  // _Py_CHECK_EMSCRIPTEN_SIGNALS
+#include "pycore_enum.h"          // _PyEnum_NextItem()
 #include "pycore_floatobject.h"   // _PyFloat_ExactDealloc()
 #include "pycore_frame.h"
 #include "pycore_function.h"
@@ -38,6 +40,7 @@
 #include "pycore_sysmodule.h"     // _PySys_GetOptionalAttrString()
 #include "pycore_traceback.h"     // _PyTraceBack_FromFrame
 #include "pycore_tuple.h"         // _PyTuple_ITEMS()
+#include "pycore_unicodeobject.h" // _PyUnicode_FormatAdvancedWriter()
 #include "pycore_uop_ids.h"       // Uops
 
 #include "dictobject.h"
@@ -796,6 +799,83 @@ _PyEval_MatchClass(PyThreadState *tstate, PyObject *subject, PyObject *type,
     return NULL;
 }
 
+static inline int
+slice_bound(PyObject *v, Py_ssize_t len, Py_ssize_t dflt, Py_ssize_t *res)
+{
+    if (Py_IsNone(v)) {
+        *res = dflt;
+        return 1;
+    }
+    if (!PyLong_CheckExact(v) || !_PyLong_IsCompact((PyLongObject *)v)) {
+        return 0;
+    }
+    Py_ssize_t i = _PyLong_CompactValue((PyLongObject *)v);
+    if (i < 0) {
+        i += len;
+        if (i < 0) {
+            i = 0;
+        }
+    }
+    else if (i > len) {
+        i = len;
+    }
+    *res = i;
+    return 1;
+}
+
+// Fast path for BINARY_SLICE on exact bytes, str, list and tuple objects
+// with compact int or None bounds, which needs no slice object. Returns 0 if
+// it does not apply. Otherwise returns 1 and sets *res to a new reference,
+// or to NULL with an exception set.
+int
+_PyEval_SliceSequence(PyObject *container, PyObject *start, PyObject *stop,
+                      PyObject **res)
+{
+    PyTypeObject *type = Py_TYPE(container);
+    Py_ssize_t len;
+    if (type == &PyBytes_Type) {
+        len = PyBytes_GET_SIZE(container);
+    }
+    else if (type == &PyUnicode_Type) {
+        len = PyUnicode_GET_LENGTH(container);
+    }
+    else if (type == &PyList_Type) {
+        len = PyList_GET_SIZE(container);
+    }
+    else if (type == &PyTuple_Type) {
+        len = PyTuple_GET_SIZE(container);
+    }
+    else {
+        return 0;
+    }
+    Py_ssize_t lo, hi;
+    if (!slice_bound(start, len, 0, &lo) || !slice_bound(stop, len, len, &hi)) {
+        return 0;
+    }
+    if (hi < lo) {
+        hi = lo;
+    }
+    if (type == &PyBytes_Type) {
+        if (lo == 0 && hi == len) {
+            *res = Py_NewRef(container);
+        }
+        else {
+            *res = PyBytes_FromStringAndSize(PyBytes_AS_STRING(container) + lo,
+                                             hi - lo);
+        }
+    }
+    else if (type == &PyUnicode_Type) {
+        *res = PyUnicode_Substring(container, lo, hi);
+    }
+    else if (type == &PyList_Type) {
+        *res = PyList_GetSlice(container, lo, hi);
+    }
+    else {
+        *res = PyTuple_GetSlice(container, lo, hi);
+    }
+    return 1;
+}
+
 
 static int do_raise(PyThreadState *tstate, PyObject *exc, PyObject *cause);
 
@@ -1821,6 +1821,86 @@ exit:
     return return_value;
 }
 
+PyDoc_STRVAR(_jit_is_enabled__doc__,
+"is_enabled($module, /)\n"
+"--\n"
+"\n"
+"Return True if the tier 2 optimizer is enabled for this interpreter.");
+
+#define _JIT_IS_ENABLED_METHODDEF    \
+    {"is_enabled", (PyCFunction)_jit_is_enabled, METH_NOARGS, _jit_is_enabled__doc__},
+
+static int
+_jit_is_enabled_impl(PyObject *module);
+
+static PyObject *
+_jit_is_enabled(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    PyObject *return_value = NULL;
+    int _return_value;
+
+    _return_value = _jit_is_enabled_impl(module);
+    if ((_return_value == -1) && PyErr_Occurred()) {
+        goto exit;
+    }
+    return_value = PyBool_FromLong((long)_return_value);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_jit_get_executors__doc__,
+"get_executors($module, /)\n"
+"--\n"
+"\n"
+"Return a list describing every live tier 2 executor.\n"
+"\n"
+"Each item is a dict with the code object and bytecode offset the executor\n"
+"is attached to, the names of the uops in its trace, how many times the\n"
+"trace has run, the number of deoptimizations and the guards that can cause\n"
+"them, the size of its machine code, and a list of its side exits. Each side\n"
+"exit records the qualname, filename and first line number of the code\n"
+"object its target is in, its target offset in that code object, how often\n"
+"it was taken, whether it has been linked to another executor, and the guards\n"
+"that lead to it.");
+
+#define _JIT_GET_EXECUTORS_METHODDEF    \
+    {"get_executors", (PyCFunction)_jit_get_executors, METH_NOARGS, _jit_get_executors__doc__},
+
+static PyObject *
+_jit_get_executors_impl(PyObject *module);
+
+static PyObject *
+_jit_get_executors(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    return _jit_get_executors_impl(module);
+}
+
+PyDoc_STRVAR(_jit_get_abandoned__doc__,
+"get_abandoned($module, /)\n"
+"--\n"
+"\n"
+"Return a dict counting the traces the tier 2 optimizer gave up on, by reason.\n"
+"\n"
+"\"no_progress\" counts traces that ended before their first instruction,\n"
+"\"unsupported_opcode\" those that started at an instruction the optimizer\n"
+"cannot translate, \"unknown_callee\" those that called a function that could\n"
+"not be identified, \"trace_stack_overflow\" and \"trace_stack_underflow\" those\n"
+"that followed too many calls or returned out of the frame they started in,\n"
+"and \"optimizer\" those the optimizer could not optimize.");
+
+#define _JIT_GET_ABANDONED_METHODDEF    \
+    {"get_abandoned", (PyCFunction)_jit_get_abandoned, METH_NOARGS, _jit_get_abandoned__doc__},
+
+static PyObject *
+_jit_get_abandoned_impl(PyObject *module);
+
+static PyObject *
+_jit_get_abandoned(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    return _jit_get_abandoned_impl(module);
+}
+
 #ifndef SYS_GETWINDOWSVERSION_METHODDEF
     #define SYS_GETWINDOWSVERSION_METHODDEF
 #endif /* !defined(SYS_GETWINDOWSVERSION_METHODDEF) */
@@ -1864,4 +1944,4 @@ exit:
 #ifndef SYS_GETANDROIDAPILEVEL_METHODDEF
     #define SYS_GETANDROIDAPILEVEL_METHODDEF
 #endif /* !defined(SYS_GETANDROIDAPILEVEL_METHODDEF) */
-/*[clinic end generated code: output=1aca52cefbeb800f input=a9049054013a1b77]*/
+/*[clinic end generated code: output=931fef929b912330 input=a9049054013a1b77]*/
@@ -1198,24 +1198,36 @@
             stop = stack_pointer[-1];
             start = stack_pointer[-2];
             container = stack_pointer[-3];
+            PyObject *start_o = PyStackRef_AsPyObjectSteal(start);
+            PyObject *stop_o = PyStackRef_AsPyObjectSteal(stop);
+            PyObject *res_o;
+            stack_pointer += -2;
+            assert(WITHIN_STACK_BOUNDS());
             _PyFrame_SetStackPointer(frame, stack_pointer);
-            PyObject *slice = _PyBuildSlice_ConsumeRefs(PyStackRef_AsPyObjectSteal(start),
-                PyStackRef_AsPyObjectSteal(stop));
+            int handled = _PyEval_SliceSequence(PyStackRef_AsPyObjectBorrow(container),
+                start_o, stop_o, &res_o);
             stack_pointer = _PyFrame_GetStackPointer(frame);
-            PyObject *res_o;
-            if (slice == NULL) {
-                res_o = NULL;
+            if (handled) {
+                _PyFrame_SetStackPointer(frame, stack_pointer);
+                Py_DECREF(start_o);
+                Py_DECREF(stop_o);
+                stack_pointer = _PyFrame_GetStackPointer(frame);
             }
             else {
-                stack_pointer += -2;
-                assert(WITHIN_STACK_BOUNDS());
                 _PyFrame_SetStackPointer(frame, stack_pointer);
-                res_o = PyObject_GetItem(PyStackRef_AsPyObjectBorrow(container), slice);
-                Py_DECREF(slice);
+                PyObject *slice = _PyBuildSlice_ConsumeRefs(start_o, stop_o);
                 stack_pointer = _PyFrame_GetStackPointer(frame);
-                stack_pointer += 2;
+                if (slice == NULL) {
+                    res_o = NULL;
+                }
+                else {
+                    _PyFrame_SetStackPointer(frame, stack_pointer);
+                    res_o = PyObject_GetItem(PyStackRef_AsPyObjectBorrow(container), slice);
+                    Py_DECREF(slice);
+                    stack_pointer = _PyFrame_GetStackPointer(frame);
+                }
             }
-            stack_pointer += -3;
+            stack_pointer += -1;
             assert(WITHIN_STACK_BOUNDS());
             _PyFrame_SetStackPointer(frame, stack_pointer);
             PyStackRef_CLOSE(container);
@@ -1345,19 +1357,28 @@
                 JUMP_TO_JUMP_TARGET();
             }
             Py_UCS4 c = PyUnicode_READ_CHAR(str, index);
-            if (Py_ARRAY_LENGTH(_Py_SINGLETON(strings).ascii) <= c) {
-                UOP_STAT_INC(uopcode, miss);
-                JUMP_TO_JUMP_TARGET();
-            }
             STAT_INC(BINARY_OP, hit);
-            PyObject *res_o = (PyObject*)&_Py_SINGLETON(strings).ascii[c];
+            PyObject *res_o;
+            if (c < 256) {
+                _PyFrame_SetStackPointer(frame, stack_pointer);
+                res_o = (PyObject *)_Py_LATIN1_CHR(c);
+                stack_pointer = _PyFrame_GetStackPointer(frame);
+            }
+            else {
+                _PyFrame_SetStackPointer(frame, stack_pointer);
+                res_o = PyUnicode_FromOrdinal(c);
+                stack_pointer = _PyFrame_GetStackPointer(frame);
+            }
             PyStackRef_CLOSE_SPECIALIZED(sub_st, _PyLong_ExactDealloc);
             stack_pointer += -2;
             assert(WITHIN_STACK_BOUNDS());
             _PyFrame_SetStackPointer(frame, stack_pointer);
             PyStackRef_CLOSE(str_st);
             stack_pointer = _PyFrame_GetStackPointer(frame);
-            res = PyStackRef_FromPyObjectImmortal(res_o);
+            if (res_o == NULL) {
+                JUMP_TO_ERROR();
+            }
+            res = PyStackRef_FromPyObjectSteal(res_o);
             stack_pointer[0] = res;
             stack_pointer += 1;
             assert(WITHIN_STACK_BOUNDS());
@@ -3180,6 +3201,52 @@
             break;
         }
 
+        case _GUARD_TYPE_VERSION_POLY: {
+            _PyStackRef owner;
+            owner = stack_pointer[-1];
+            uint32_t type_version = (uint32_t)CURRENT_OPERAND0();
+            uint32_t type_version2 = (uint32_t)CURRENT_OPERAND1();
+            PyTypeObject *tp = Py_TYPE(PyStackRef_AsPyObjectBorrow(owner));
+            assert(type_version != 0 && type_version2 != 0);
+            unsigned int tp_version = FT_ATOMIC_LOAD_UINT_RELAXED(tp->tp_version_tag);
+            if (tp_version != type_version && tp_version != type_version2) {
+                UOP_STAT_INC(uopcode, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            break;
+        }
+
+        case _LOAD_ATTR_INSTANCE_VALUE_INDEX: {
+            _PyStackRef owner;
+            _PyStackRef attr;
+            owner = stack_pointer[-1];
+            uint16_t index = (uint16_t)CURRENT_OPERAND0();
+            PyObject *owner_o = PyStackRef_AsPyObjectBorrow(owner);
+            PyObject **value_ptr = &_PyObject_InlineValues(owner_o)->values[index];
+            PyObject *attr_o = FT_ATOMIC_LOAD_PTR_ACQUIRE(*value_ptr);
+            if (attr_o == NULL) {
+                UOP_STAT_INC(uopcode, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            #ifdef Py_GIL_DISABLED
+            int increfed = _Py_TryIncrefCompareStackRef(value_ptr, attr_o, &attr);
+            if (!increfed) {
+                if (true) {
+                    UOP_STAT_INC(uopcode, miss);
+                    JUMP_TO_JUMP_TARGET();
+                }
+            }
+            #else
+            attr = PyStackRef_FromPyObjectNew(attr_o);
+            #endif
+            STAT_INC(LOAD_ATTR, hit);
+            stack_pointer[-1] = attr;
+            _PyFrame_SetStackPointer(frame, stack_pointer);
+            PyStackRef_CLOSE(owner);
+            stack_pointer = _PyFrame_GetStackPointer(frame);
+            break;
+        }
+
         case _LOAD_ATTR_MODULE: {
             _PyStackRef owner;
             _PyStackRef attr;
@@ -3530,6 +3597,89 @@
             break;
         }
 
+        case _STORE_ATTR_PROPERTY: {
+            _PyStackRef owner;
+            _PyStackRef value;
+            oparg = CURRENT_OPARG();
+            owner = stack_pointer[-1];
+            value = stack_pointer[-2];
+            PyHeapTypeObject *ht = (PyHeapTypeObject *)PyStackRef_TYPE(owner);
+            PyObject *descr = FT_ATOMIC_LOAD_PTR_ACQUIRE(ht->_spec_cache.property);
+            assert(Py_IS_TYPE(descr, &PyProperty_Type));
+            PyObject *name = GETITEM(FRAME_CO_NAMES, oparg);
+            if (((_PyPropertyObject *)descr)->prop_name != name) {
+                UOP_STAT_INC(uopcode, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            PyObject *fset = ((_PyPropertyObject *)descr)->prop_set;
+            if (fset == NULL) {
+                UOP_STAT_INC(uopcode, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            STAT_INC(STORE_ATTR, hit);
+            PyObject *args[2] = {
+                PyStackRef_AsPyObjectBorrow(owner),
+                PyStackRef_AsPyObjectBorrow(value),
+            };
+            _PyFrame_SetStackPointer(frame, stack_pointer);
+            PyObject *res = PyObject_Vectorcall(fset, args, 2, NULL);
+            _PyStackRef tmp = owner;
+            owner = PyStackRef_NULL;
+            stack_pointer[-1] = owner;
+            PyStackRef_CLOSE(tmp);
+            tmp = value;
+            value = PyStackRef_NULL;
+            stack_pointer[-2] = value;
+            PyStackRef_CLOSE(tmp);
+            stack_pointer = _PyFrame_GetStackPointer(frame);
+            stack_pointer += -2;
+            assert(WITHIN_STACK_BOUNDS());
+            if (res == NULL) {
+                JUMP_TO_ERROR();
+            }
+            _PyFrame_SetStackPointer(frame, stack_pointer);
+            Py_DECREF(res);
+            stack_pointer = _PyFrame_GetStackPointer(frame);
+            break;
+        }
+
+        case _STORE_ATTR_SETATTR_OVERRIDDEN: {
+            _PyStackRef owner;
+            _PyStackRef value;
+            oparg = CURRENT_OPARG();
+            owner = stack_pointer[-1];
+            value = stack_pointer[-2];
+            PyHeapTypeObject *ht = (PyHeapTypeObject *)PyStackRef_TYPE(owner);
+            PyObject *setattr = FT_ATOMIC_LOAD_PTR_ACQUIRE(ht->_spec_cache.setattr);
+            assert(Py_IS_TYPE(setattr, &PyFunction_Type));
+            STAT_INC(STORE_ATTR, hit);
+            PyObject *args[3] = {
+                PyStackRef_AsPyObjectBorrow(owner),
+                GETITEM(FRAME_CO_NAMES, oparg),
+                PyStackRef_AsPyObjectBorrow(value),
+            };
+            _PyFrame_SetStackPointer(frame, stack_pointer);
+            PyObject *res = PyObject_Vectorcall(setattr, args, 3, NULL);
+            _PyStackRef tmp = owner;
+            owner = PyStackRef_NULL;
+            stack_pointer[-1] = owner;
+            PyStackRef_CLOSE(tmp);
+            tmp = value;
+            value = PyStackRef_NULL;
+            stack_pointer[-2] = value;
+            PyStackRef_CLOSE(tmp);
+            stack_pointer = _PyFrame_GetStackPointer(frame);
+            stack_pointer += -2;
+            assert(WITHIN_STACK_BOUNDS());
+            if (res == NULL) {
+                JUMP_TO_ERROR();
+            }
+            _PyFrame_SetStackPointer(frame, stack_pointer);
+            Py_DECREF(res);
+            stack_pointer = _PyFrame_GetStackPointer(frame);
+            break;
+        }
+
         case _COMPARE_OP: {
             _PyStackRef right;
             _PyStackRef left;
@@ -3629,6 +3779,58 @@
             break;
         }
 
+        case _COMPARE_OP_FLOAT_INT: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef res;
+            oparg = CURRENT_OPARG();
+            right = stack_pointer[-1];
+            left = stack_pointer[-2];
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            if (!_PyLong_IsCompact((PyLongObject *)right_o)) {
+                UOP_STAT_INC(uopcode, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            STAT_INC(COMPARE_OP, hit);
+            double dleft = PyFloat_AS_DOUBLE(left_o);
+            double dright = (double)_PyLong_CompactValue((PyLongObject *)right_o);
+            int sign_ish = COMPARISON_BIT(dleft, dright);
+            PyStackRef_CLOSE_SPECIALIZED(left, _PyFloat_ExactDealloc);
+            PyStackRef_CLOSE_SPECIALIZED(right, _PyLong_ExactDealloc);
+            res = (sign_ish & oparg) ? PyStackRef_True : PyStackRef_False;
+            stack_pointer[-2] = res;
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case _COMPARE_OP_INT_FLOAT: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef res;
+            oparg = CURRENT_OPARG();
+            right = stack_pointer[-1];
+            left = stack_pointer[-2];
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            if (!_PyLong_IsCompact((PyLongObject *)left_o)) {
+                UOP_STAT_INC(uopcode, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            STAT_INC(COMPARE_OP, hit);
+            double dleft = (double)_PyLong_CompactValue((PyLongObject *)left_o);
+            double dright = PyFloat_AS_DOUBLE(right_o);
+            int sign_ish = COMPARISON_BIT(dleft, dright);
+            PyStackRef_CLOSE_SPECIALIZED(left, _PyLong_ExactDealloc);
+            PyStackRef_CLOSE_SPECIALIZED(right, _PyFloat_ExactDealloc);
+            res = (sign_ish & oparg) ? PyStackRef_True : PyStackRef_False;
+            stack_pointer[-2] = res;
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
         case _COMPARE_OP_STR: {
             _PyStackRef right;
             _PyStackRef left;
@@ -3791,6 +3993,54 @@
             break;
         }
 
+        case _CONTAINS_OP_STR_TUPLE: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef b;
+            oparg = CURRENT_OPARG();
+            right = stack_pointer[-1];
+            left = stack_pointer[-2];
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            assert(PyUnicode_CheckExact(left_o));
+            assert(PyTuple_CheckExact(right_o));
+            int res = 0;
+            Py_ssize_t n = PyTuple_GET_SIZE(right_o);
+            for (Py_ssize_t i = 0; i < n; i++) {
+                PyObject *item = PyTuple_GET_ITEM(right_o, i);
+                if (item == left_o) {
+                    res = 1;
+                    break;
+                }
+                if (!PyUnicode_CheckExact(item)) {
+                    UOP_STAT_INC(uopcode, miss);
+                    JUMP_TO_JUMP_TARGET();
+                }
+                if (_PyUnicode_Equal(item, left_o)) {
+                    res = 1;
+                    break;
+                }
+            }
+            STAT_INC(CONTAINS_OP, hit);
+            _PyFrame_SetStackPointer(frame, stack_pointer);
+            _PyStackRef tmp = right;
+            right = PyStackRef_NULL;
+            stack_pointer[-1] = right;
+            PyStackRef_CLOSE(tmp);
+            tmp = left;
+            left = PyStackRef_NULL;
+            stack_pointer[-2] = left;
+            PyStackRef_CLOSE(tmp);
+            stack_pointer = _PyFrame_GetStackPointer(frame);
+            stack_pointer += -2;
+            assert(WITHIN_STACK_BOUNDS());
+            b = (res ^ oparg) ? PyStackRef_True : PyStackRef_False;
+            stack_pointer[0] = b;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
         case _CHECK_EG_MATCH: {
             _PyStackRef match_type_st;
             _PyStackRef exc_value_st;
@@ -4408,28 +4658,248 @@
             break;
         }
 
-        case _LOAD_SPECIAL: {
-            _PyStackRef owner;
-            _PyStackRef attr;
-            _PyStackRef self_or_null;
-            oparg = CURRENT_OPARG();
-            owner = stack_pointer[-1];
-            assert(oparg <= SPECIAL_MAX);
-            PyObject *owner_o = PyStackRef_AsPyObjectSteal(owner);
-            PyObject *name = _Py_SpecialMethods[oparg].name;
-            PyObject *self_or_null_o;
-            stack_pointer += -1;
-            assert(WITHIN_STACK_BOUNDS());
+        case _ITER_CHECK_DICT_ITEMS: {
+            _PyStackRef iter;
+            iter = stack_pointer[-1];
+            PyObject *iter_o = PyStackRef_AsPyObjectBorrow(iter);
+            if (Py_TYPE(iter_o) != &PyDictIterItem_Type) {
+                UOP_STAT_INC(uopcode, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            #ifdef Py_GIL_DISABLED
+            if (!_PyObject_IsUniquelyReferenced(iter_o)) {
+                UOP_STAT_INC(uopcode, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            #endif
+            break;
+        }
+
+        /* _ITER_NEXT_DICT_ITEMS is not a viable micro-op for tier 2 because it is replaced */
+
+        case _ITER_NEXT_DICT_ITEMS_TIER_TWO: {
+            _PyStackRef iter;
+            _PyStackRef next;
+            iter = stack_pointer[-1];
+            PyObject *iter_o = PyStackRef_AsPyObjectBorrow(iter);
+            assert(Py_TYPE(iter_o) == &PyDictIterItem_Type);
             _PyFrame_SetStackPointer(frame, stack_pointer);
-            PyObject *attr_o = _PyObject_LookupSpecialMethod(owner_o, name, &self_or_null_o);
+            PyObject *next_o = PyDictIterItem_Type.tp_iternext(iter_o);
             stack_pointer = _PyFrame_GetStackPointer(frame);
-            if (attr_o == NULL) {
-                if (!_PyErr_Occurred(tstate)) {
-                    _PyFrame_SetStackPointer(frame, stack_pointer);
-                    _PyErr_Format(tstate, PyExc_TypeError,
-                                  _Py_SpecialMethods[oparg].error,
-                                  Py_TYPE(owner_o)->tp_name);
-                    stack_pointer = _PyFrame_GetStackPointer(frame);
+            if (next_o == NULL) {
+                if (_PyErr_Occurred(tstate)) {
+                    JUMP_TO_ERROR();
+                }
+                if (true) {
+                    UOP_STAT_INC(uopcode, miss);
+                    JUMP_TO_JUMP_TARGET();
+                }
+            }
+            next = PyStackRef_FromPyObjectSteal(next_o);
+            stack_pointer[0] = next;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case _ITER_NEXT_DICT_ITEMS_UNPACK: {
+            _PyStackRef iter;
+            _PyStackRef value;
+            _PyStackRef key;
+            iter = stack_pointer[-1];
+            PyObject *iter_o = PyStackRef_AsPyObjectBorrow(iter);
+            assert(Py_TYPE(iter_o) == &PyDictIterItem_Type);
+            PyObject *key_o, *value_o;
+            _PyFrame_SetStackPointer(frame, stack_pointer);
+            int res = _PyDictIter_NextItem(iter_o, &key_o, &value_o);
+            stack_pointer = _PyFrame_GetStackPointer(frame);
+            if (res < 0) {
+                JUMP_TO_ERROR();
+            }
+            if (res == 0) {
+                UOP_STAT_INC(uopcode, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            key = PyStackRef_FromPyObjectSteal(key_o);
+            value = PyStackRef_FromPyObjectSteal(value_o);
+            stack_pointer[0] = value;
+            stack_pointer[1] = key;
+            stack_pointer += 2;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case _ITER_CHECK_ENUMERATE: {
+            _PyStackRef iter;
+            iter = stack_pointer[-1];
+            PyObject *iter_o = PyStackRef_AsPyObjectBorrow(iter);
+            if (Py_TYPE(iter_o) != &PyEnum_Type) {
+                UOP_STAT_INC(uopcode, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            #ifdef Py_GIL_DISABLED
+            if (!_PyObject_IsUniquelyReferenced(iter_o)) {
+                UOP_STAT_INC(uopcode, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            #endif
+            break;
+        }
+
+        /* _ITER_NEXT_ENUMERATE is not a viable micro-op for tier 2 because it is replaced */
+
+        case _ITER_NEXT_ENUMERATE_TIER_TWO: {
+            _PyStackRef iter;
+            _PyStackRef next;
+            iter = stack_pointer[-1];
+            PyObject *iter_o = PyStackRef_AsPyObjectBorrow(iter);
+            assert(Py_TYPE(iter_o) == &PyEnum_Type);
+            _PyFrame_SetStackPointer(frame, stack_pointer);
+            PyObject *next_o = PyEnum_Type.tp_iternext(iter_o);
+            stack_pointer = _PyFrame_GetStackPointer(frame);
+            if (next_o == NULL) {
+                if (_PyErr_Occurred(tstate)) {
+                    _PyFrame_SetStackPointer(frame, stack_pointer);
+                    int matches = _PyErr_ExceptionMatches(tstate, PyExc_StopIteration);
+                    stack_pointer = _PyFrame_GetStackPointer(frame);
+                    if (!matches) {
+                        JUMP_TO_ERROR();
+                    }
+                    _PyFrame_SetStackPointer(frame, stack_pointer);
+                    _PyEval_MonitorRaise(tstate, frame, frame->instr_ptr);
+                    _PyErr_Clear(tstate);
+                    stack_pointer = _PyFrame_GetStackPointer(frame);
+                }
+                if (true) {
+                    UOP_STAT_INC(uopcode, miss);
+                    JUMP_TO_JUMP_TARGET();
+                }
+            }
+            next = PyStackRef_FromPyObjectSteal(next_o);
+            stack_pointer[0] = next;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case _ITER_NEXT_ENUMERATE_UNPACK: {
+            _PyStackRef iter;
+            _PyStackRef item;
+            _PyStackRef index;
+            iter = stack_pointer[-1];
+            PyObject *iter_o = PyStackRef_AsPyObjectBorrow(iter);
+            assert(Py_TYPE(iter_o) == &PyEnum_Type);
+            PyObject *index_o, *item_o;
+            _PyFrame_SetStackPointer(frame, stack_pointer);
+            int res = _PyEnum_NextItem(iter_o, &index_o, &item_o);
+            stack_pointer = _PyFrame_GetStackPointer(frame);
+            if (res < 0) {
+                _PyFrame_SetStackPointer(frame, stack_pointer);
+                int matches = _PyErr_ExceptionMatches(tstate, PyExc_StopIteration);
+                stack_pointer = _PyFrame_GetStackPointer(frame);
+                if (!matches) {
+                    JUMP_TO_ERROR();
+                }
+                _PyFrame_SetStackPointer(frame, stack_pointer);
+                _PyEval_MonitorRaise(tstate, frame, frame->instr_ptr);
+                _PyErr_Clear(tstate);
+                stack_pointer = _PyFrame_GetStackPointer(frame);
+            }
+            if (res <= 0) {
+                UOP_STAT_INC(uopcode, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            index = PyStackRef_FromPyObjectSteal(index_o);
+            item = PyStackRef_FromPyObjectSteal(item_o);
+            stack_pointer[0] = item;
+            stack_pointer[1] = index;
+            stack_pointer += 2;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case _ITER_CHECK_REVERSED_LIST: {
+            _PyStackRef iter;
+            iter = stack_pointer[-1];
+            PyObject *iter_o = PyStackRef_AsPyObjectBorrow(iter);
+            if (Py_TYPE(iter_o) != &PyListRevIter_Type) {
+                UOP_STAT_INC(uopcode, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            #ifdef Py_GIL_DISABLED
+
+            if (true) {
+                UOP_STAT_INC(uopcode, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            #endif
+            break;
+        }
+
+        /* _ITER_JUMP_REVERSED_LIST is not a viable micro-op for tier 2 because it is replaced */
+
+        case _GUARD_NOT_EXHAUSTED_REVERSED_LIST: {
+            _PyStackRef iter;
+            iter = stack_pointer[-1];
+            #ifndef Py_GIL_DISABLED
+            PyObject *iter_o = PyStackRef_AsPyObjectBorrow(iter);
+            _PyListIterObject *it = (_PyListIterObject *)iter_o;
+            assert(Py_TYPE(iter_o) == &PyListRevIter_Type);
+            PyListObject *seq = it->it_seq;
+            if (seq == NULL) {
+                UOP_STAT_INC(uopcode, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            if (it->it_index < 0 || it->it_index >= PyList_GET_SIZE(seq)) {
+                it->it_index = -1;
+                if (1) {
+                    UOP_STAT_INC(uopcode, miss);
+                    JUMP_TO_JUMP_TARGET();
+                }
+            }
+            #endif
+            break;
+        }
+
+        case _ITER_NEXT_REVERSED_LIST: {
+            _PyStackRef iter;
+            _PyStackRef next;
+            iter = stack_pointer[-1];
+            PyObject *iter_o = PyStackRef_AsPyObjectBorrow(iter);
+            _PyListIterObject *it = (_PyListIterObject *)iter_o;
+            assert(Py_TYPE(iter_o) == &PyListRevIter_Type);
+            PyListObject *seq = it->it_seq;
+            assert(seq);
+            assert(it->it_index >= 0 && it->it_index < PyList_GET_SIZE(seq));
+            next = PyStackRef_FromPyObjectNew(PyList_GET_ITEM(seq, it->it_index--));
+            stack_pointer[0] = next;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case _LOAD_SPECIAL: {
+            _PyStackRef owner;
+            _PyStackRef attr;
+            _PyStackRef self_or_null;
+            oparg = CURRENT_OPARG();
+            owner = stack_pointer[-1];
+            assert(oparg <= SPECIAL_MAX);
+            PyObject *owner_o = PyStackRef_AsPyObjectSteal(owner);
+            PyObject *name = _Py_SpecialMethods[oparg].name;
+            PyObject *self_or_null_o;
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _PyFrame_SetStackPointer(frame, stack_pointer);
+            PyObject *attr_o = _PyObject_LookupSpecialMethod(owner_o, name, &self_or_null_o);
+            stack_pointer = _PyFrame_GetStackPointer(frame);
+            if (attr_o == NULL) {
+                if (!_PyErr_Occurred(tstate)) {
+                    _PyFrame_SetStackPointer(frame, stack_pointer);
+                    _PyErr_Format(tstate, PyExc_TypeError,
+                                  _Py_SpecialMethods[oparg].error,
+                                  Py_TYPE(owner_o)->tp_name);
+                    stack_pointer = _PyFrame_GetStackPointer(frame);
                 }
                 JUMP_TO_ERROR();
             }
@@ -4787,6 +5257,43 @@
             break;
         }
 
+        case _CHECK_DUNDER_CALL: {
+            _PyStackRef *null;
+            _PyStackRef *callable;
+            oparg = CURRENT_OPARG();
+            null = &stack_pointer[-1 - oparg];
+            callable = &stack_pointer[-2 - oparg];
+            uint32_t type_version = (uint32_t)CURRENT_OPERAND0();
+            PyTypeObject *tp = PyStackRef_TYPE(callable[0]);
+            if (FT_ATOMIC_LOAD_UINT32_RELAXED(tp->tp_version_tag) != type_version) {
+                UOP_STAT_INC(uopcode, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            if (!PyStackRef_IsNull(null[0])) {
+                UOP_STAT_INC(uopcode, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            assert(tp->tp_flags & Py_TPFLAGS_HEAPTYPE);
+            assert(tp->tp_call == _Py_slot_tp_call);
+            break;
+        }
+
+        case _EXPAND_DUNDER_CALL: {
+            _PyStackRef *self_or_null;
+            _PyStackRef *callable;
+            oparg = CURRENT_OPARG();
+            self_or_null = &stack_pointer[-1 - oparg];
+            callable = &stack_pointer[-2 - oparg];
+            assert(PyStackRef_IsNull(self_or_null[0]));
+            PyHeapTypeObject *cls = (PyHeapTypeObject *)PyStackRef_TYPE(callable[0]);
+            PyObject *call = FT_ATOMIC_LOAD_PTR_ACQUIRE(cls->_spec_cache.call);
+            assert(PyFunction_Check(call));
+            STAT_INC(CALL, hit);
+            self_or_null[0] = callable[0];
+            callable[0] = PyStackRef_FromPyObjectNew(call);
+            break;
+        }
+
         case _CHECK_IS_NOT_PY_CALLABLE: {
             _PyStackRef *callable;
             oparg = CURRENT_OPARG();
@@ -6545,6 +7052,67 @@
             break;
         }
 
+        case _FORMAT_SIMPLE_STR: {
+            _PyStackRef value;
+            _PyStackRef res;
+            value = stack_pointer[-1];
+            assert(PyUnicode_CheckExact(PyStackRef_AsPyObjectBorrow(value)));
+            STAT_INC(FORMAT_SIMPLE, hit);
+            res = value;
+            stack_pointer[-1] = res;
+            break;
+        }
+
+        case _FORMAT_SIMPLE_INT: {
+            _PyStackRef value;
+            _PyStackRef res;
+            value = stack_pointer[-1];
+            PyObject *value_o = PyStackRef_AsPyObjectBorrow(value);
+            assert(PyLong_CheckExact(value_o));
+            STAT_INC(FORMAT_SIMPLE, hit);
+            _PyFrame_SetStackPointer(frame, stack_pointer);
+            PyObject *res_o = _PyLong_Format(value_o, 10);
+            stack_pointer = _PyFrame_GetStackPointer(frame);
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _PyFrame_SetStackPointer(frame, stack_pointer);
+            PyStackRef_CLOSE(value);
+            stack_pointer = _PyFrame_GetStackPointer(frame);
+            if (res_o == NULL) {
+                JUMP_TO_ERROR();
+            }
+            res = PyStackRef_FromPyObjectSteal(res_o);
+            stack_pointer[0] = res;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case _FORMAT_SIMPLE_FLOAT: {
+            _PyStackRef value;
+            _PyStackRef res;
+            value = stack_pointer[-1];
+            PyObject *value_o = PyStackRef_AsPyObjectBorrow(value);
+            assert(PyFloat_CheckExact(value_o));
+            STAT_INC(FORMAT_SIMPLE, hit);
+            _PyFrame_SetStackPointer(frame, stack_pointer);
+            PyObject *res_o = PyFloat_Type.tp_repr(value_o);
+            stack_pointer = _PyFrame_GetStackPointer(frame);
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _PyFrame_SetStackPointer(frame, stack_pointer);
+            PyStackRef_CLOSE(value);
+            stack_pointer = _PyFrame_GetStackPointer(frame);
+            if (res_o == NULL) {
+                JUMP_TO_ERROR();
+            }
+            res = PyStackRef_FromPyObjectSteal(res_o);
+            stack_pointer[0] = res;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
         case _FORMAT_WITH_SPEC: {
             _PyStackRef fmt_spec;
             _PyStackRef value;
@@ -6574,6 +7142,111 @@
             break;
         }
 
+        case _FORMAT_WITH_SPEC_STR: {
+            _PyStackRef fmt_spec;
+            _PyStackRef value;
+            _PyStackRef res;
+            fmt_spec = stack_pointer[-1];
+            value = stack_pointer[-2];
+            PyObject *value_o = PyStackRef_AsPyObjectBorrow(value);
+            PyObject *spec_o = PyStackRef_AsPyObjectBorrow(fmt_spec);
+            assert(PyUnicode_CheckExact(value_o));
+            assert(PyUnicode_Check(spec_o));
+            STAT_INC(FORMAT_WITH_SPEC, hit);
+            _PyFrame_SetStackPointer(frame, stack_pointer);
+            PyObject *res_o = _PyObject_FormatAdvanced(
+                value_o, spec_o, _PyUnicode_FormatAdvancedWriter);
+            _PyStackRef tmp = fmt_spec;
+            fmt_spec = PyStackRef_NULL;
+            stack_pointer[-1] = fmt_spec;
+            PyStackRef_CLOSE(tmp);
+            tmp = value;
+            value = PyStackRef_NULL;
+            stack_pointer[-2] = value;
+            PyStackRef_CLOSE(tmp);
+            stack_pointer = _PyFrame_GetStackPointer(frame);
+            stack_pointer += -2;
+            assert(WITHIN_STACK_BOUNDS());
+            if (res_o == NULL) {
+                JUMP_TO_ERROR();
+            }
+            res = PyStackRef_FromPyObjectSteal(res_o);
+            stack_pointer[0] = res;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case _FORMAT_WITH_SPEC_INT: {
+            _PyStackRef fmt_spec;
+            _PyStackRef value;
+            _PyStackRef res;
+            fmt_spec = stack_pointer[-1];
+            value = stack_pointer[-2];
+            PyObject *value_o = PyStackRef_AsPyObjectBorrow(value);
+            PyObject *spec_o = PyStackRef_AsPyObjectBorrow(fmt_spec);
+            assert(PyLong_CheckExact(value_o));
+            assert(PyUnicode_Check(spec_o));
+            STAT_INC(FORMAT_WITH_SPEC, hit);
+            _PyFrame_SetStackPointer(frame, stack_pointer);
+            PyObject *res_o = _PyObject_FormatAdvanced(
+                value_o, spec_o, _PyLong_FormatAdvancedWriter);
+            _PyStackRef tmp = fmt_spec;
+            fmt_spec = PyStackRef_NULL;
+            stack_pointer[-1] = fmt_spec;
+            PyStackRef_CLOSE(tmp);
+            tmp = value;
+            value = PyStackRef_NULL;
+            stack_pointer[-2] = value;
+            PyStackRef_CLOSE(tmp);
+            stack_pointer = _PyFrame_GetStackPointer(frame);
+            stack_pointer += -2;
+            assert(WITHIN_STACK_BOUNDS());
+            if (res_o == NULL) {
+                JUMP_TO_ERROR();
+            }
+            res = PyStackRef_FromPyObjectSteal(res_o);
+            stack_pointer[0] = res;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case _FORMAT_WITH_SPEC_FLOAT: {
+            _PyStackRef fmt_spec;
+            _PyStackRef value;
+            _PyStackRef res;
+            fmt_spec = stack_pointer[-1];
+            value = stack_pointer[-2];
+            PyObject *value_o = PyStackRef_AsPyObjectBorrow(value);
+            PyObject *spec_o = PyStackRef_AsPyObjectBorrow(fmt_spec);
+            assert(PyFloat_CheckExact(value_o));
+            assert(PyUnicode_Check(spec_o));
+            STAT_INC(FORMAT_WITH_SPEC, hit);
+            _PyFrame_SetStackPointer(frame, stack_pointer);
+            PyObject *res_o = _PyObject_FormatAdvanced(
+                value_o, spec_o, _PyFloat_FormatAdvancedWriter);
+            _PyStackRef tmp = fmt_spec;
+            fmt_spec = PyStackRef_NULL;
+            stack_pointer[-1] = fmt_spec;
+            PyStackRef_CLOSE(tmp);
+            tmp = value;
+            value = PyStackRef_NULL;
+            stack_pointer[-2] = value;
+            PyStackRef_CLOSE(tmp);
+            stack_pointer = _PyFrame_GetStackPointer(frame);
+            stack_pointer += -2;
+            assert(WITHIN_STACK_BOUNDS());
+            if (res_o == NULL) {
+                JUMP_TO_ERROR();
+            }
+            res = PyStackRef_FromPyObjectSteal(res_o);
+            stack_pointer[0] = res;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
         case _COPY: {
             _PyStackRef bottom;
             _PyStackRef top;
@@ -6755,6 +7428,7 @@
             _PyExitData *exit = (_PyExitData *)exit_p;
             PyCodeObject *code = _PyFrame_GetCode(frame);
             _Py_CODEUNIT *target = _PyFrame_GetBytecode(frame) + exit->target;
+            exit->hit_count++;
             #if defined(Py_DEBUG) && !defined(_Py_JIT)
             OPT_HIST(trace_uop_execution_counter, trace_run_length_hist);
             if (frame->lltrace >= 2) {
@@ -6769,7 +7443,7 @@
             }
             #endif
             if (exit->executor && !exit->executor->vm_data.valid) {
-                exit->temperature = initial_temperature_backoff_counter();
+                exit->temperature = restart_backoff_counter(exit->temperature);
                 _PyFrame_SetStackPointer(frame, stack_pointer);
                 Py_CLEAR(exit->executor);
                 stack_pointer = _PyFrame_GetStackPointer(frame);
@@ -6795,10 +7469,13 @@
                         exit->temperature = restart_backoff_counter(temperature);
                         GOTO_TIER_ONE(optimized < 0 ? NULL : target);
                     }
-                    exit->temperature = initial_temperature_backoff_counter();
+                    exit->temperature = rearm_backoff_counter(temperature);
                 }
                 exit->executor = executor;
             }
+            if (!_PyExecutor_IsReady((_PyExecutorObject *)exit->executor)) {
+                GOTO_TIER_ONE(target);
+            }
             Py_INCREF(exit->executor);
             GOTO_TIER_TWO(exit->executor);
             break;
@@ -6890,6 +7567,94 @@
             break;
         }
 
+        case _REVERSE: {
+            _PyStackRef *values;
+            oparg = CURRENT_OPARG();
+            values = &stack_pointer[-oparg];
+            for (int lo = 0, hi = oparg - 1; lo < hi; lo++, hi--) {
+                _PyStackRef temp = values[lo];
+                values[lo] = values[hi];
+                values[hi] = temp;
+            }
+            break;
+        }
+
+        case _POP_CALL_LOAD_CONST_INLINE: {
+            _PyStackRef *args;
+            _PyStackRef *self_or_null;
+            _PyStackRef *callable;
+            _PyStackRef value;
+            oparg = CURRENT_OPARG();
+            args = &stack_pointer[-oparg];
+            self_or_null = &stack_pointer[-1 - oparg];
+            callable = &stack_pointer[-2 - oparg];
+            PyObject *ptr = (PyObject *)CURRENT_OPERAND0();
+            for (int i = oparg - 1; i >= 0; i--) {
+                _PyStackRef arg = args[i];
+                args[i] = PyStackRef_NULL;
+                _PyFrame_SetStackPointer(frame, stack_pointer);
+                PyStackRef_CLOSE(arg);
+                stack_pointer = _PyFrame_GetStackPointer(frame);
+            }
+            stack_pointer += -1 - oparg;
+            assert(WITHIN_STACK_BOUNDS());
+            _PyFrame_SetStackPointer(frame, stack_pointer);
+            PyStackRef_XCLOSE(self_or_null[0]);
+            stack_pointer = _PyFrame_GetStackPointer(frame);
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _PyFrame_SetStackPointer(frame, stack_pointer);
+            PyStackRef_CLOSE(callable[0]);
+            stack_pointer = _PyFrame_GetStackPointer(frame);
+            value = PyStackRef_FromPyObjectNew(ptr);
+            stack_pointer[0] = value;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case _POP_CALL_LOAD_ARG: {
+            _PyStackRef *args;
+            _PyStackRef *self_or_null;
+            _PyStackRef *callable;
+            _PyStackRef value;
+            oparg = CURRENT_OPARG();
+            args = &stack_pointer[-oparg];
+            self_or_null = &stack_pointer[-1 - oparg];
+            callable = &stack_pointer[-2 - oparg];
+            uint16_t index = (uint16_t)CURRENT_OPERAND0();
+            _PyStackRef *first = args;
+            int total_args = oparg;
+            if (!PyStackRef_IsNull(self_or_null[0])) {
+                first--;
+                total_args++;
+            }
+            assert((int)index < total_args);
+            PyObject *value_o = PyStackRef_AsPyObjectNew(first[index]);
+            for (int i = oparg - 1; i >= 0; i--) {
+                _PyStackRef arg = args[i];
+                args[i] = PyStackRef_NULL;
+                _PyFrame_SetStackPointer(frame, stack_pointer);
+                PyStackRef_CLOSE(arg);
+                stack_pointer = _PyFrame_GetStackPointer(frame);
+            }
+            stack_pointer += -1 - oparg;
+            assert(WITHIN_STACK_BOUNDS());
+            _PyFrame_SetStackPointer(frame, stack_pointer);
+            PyStackRef_XCLOSE(self_or_null[0]);
+            stack_pointer = _PyFrame_GetStackPointer(frame);
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _PyFrame_SetStackPointer(frame, stack_pointer);
+            PyStackRef_CLOSE(callable[0]);
+            stack_pointer = _PyFrame_GetStackPointer(frame);
+            value = PyStackRef_FromPyObjectSteal(value_o);
+            stack_pointer[0] = value;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
         case _CHECK_FUNCTION: {
             uint32_t func_version = (uint32_t)CURRENT_OPERAND0();
             assert(PyStackRef_FunctionCheck(frame->f_funcobj));
@@ -6915,6 +7680,7 @@
 
         case _MAKE_WARM: {
             current_executor->vm_data.warm = true;
+            current_executor->run_count++;
             if (--tstate->interp->trace_run_counter == 0) {
                 _Py_set_eval_breaker_bit(tstate, _PY_EVAL_JIT_INVALIDATE_COLD_BIT);
             }
@@ -6928,6 +7694,7 @@
         }
 
         case _DEOPT: {
+            current_executor->deopt_count++;
             tstate->previous_executor = (PyObject *)current_executor;
             GOTO_TIER_ONE(_PyFrame_GetBytecode(frame) + CURRENT_TARGET());
             break;
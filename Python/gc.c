@@ -5,10 +5,12 @@
 #include "Python.h"
 #include "pycore_ceval.h"         // _Py_set_eval_breaker_bit()
 #include "pycore_dict.h"          // _PyInlineValuesSize()
+#include "pycore_hashtable.h"     // _Py_hashtable_t
 #include "pycore_initconfig.h"    // _PyStatus_OK()
 #include "pycore_interp.h"        // PyInterpreterState.gc
 #include "pycore_interpframe.h"   // _PyFrame_GetLocalsArray()
 #include "pycore_object_alloc.h"  // _PyObject_MallocWithType()
+#include "pycore_object_stack.h"  // _PyObjectStack
 #include "pycore_pystate.h"       // _PyThreadState_GET()
 #include "pycore_tuple.h"         // _PyTuple_MaybeUntrack()
 #include "pycore_weakref.h"       // _PyWeakref_ClearRef()
@@ -483,11 +485,12 @@ validate_consistent_old_space(PyGC_Head *head)
 /* Set all gc_refs = ob_refcnt.  After this, gc_refs is > 0 and
  * PREV_MASK_COLLECTING bit is set for all objects in containers.
  */
-static void
+static Py_ssize_t
 update_refs(PyGC_Head *containers)
 {
     PyGC_Head *next;
     PyGC_Head *gc = GC_NEXT(containers);
+    Py_ssize_t size = 0;
 
     while (gc != containers) {
         next = GC_NEXT(gc);
@@ -518,7 +521,9 @@ update_refs(PyGC_Head *containers)
          */
         _PyObject_ASSERT(op, gc_get_refs(gc) != 0);
         gc = next;
+        size++;
     }
+    return size;
 }
 
 /* A traversal callback for subtract_refs. */
@@ -1179,15 +1184,23 @@ flag is cleared (for example, by using 'clear_unreachable_mask' function or
 by a call to 'move_legacy_finalizers'), the 'unreachable' list is not a normal
 list and we can not use most gc_list_* functions for it. */
 static inline void
-deduce_unreachable(PyGC_Head *base, PyGC_Head *unreachable) {
+deduce_unreachable(PyGC_Head *base, PyGC_Head *unreachable,
+                   struct gc_collection_stats *stats) {
     validate_list(base, collecting_clear_unreachable_clear);
     /* Using ob_refcnt and gc_refs, calculate which objects in the
      * container set are reachable from outside the set (i.e., have a
      * refcount greater than 0 when all the references within the
      * set are taken into account).
      */
-    update_refs(base);  // gc_prev is used for gc_refs
+    Py_ssize_t size = update_refs(base);  // gc_prev is used for gc_refs
+    if (stats != NULL) {
+        stats->visited += size;
+        _PyGC_StatsPhaseDone(stats, "update_refs");
+    }
     subtract_refs(base);
+    if (stats != NULL) {
+        _PyGC_StatsPhaseDone(stats, "subtract_refs");
+    }
 
     /* Leave everything reachable from outside base in base, and move
      * everything else (in base) to unreachable.
@@ -1254,7 +1267,7 @@ handle_resurrected_objects(PyGC_Head *unreachable, PyGC_Head* still_unreachable,
     // have the PREV_MARK_COLLECTING set, but the objects are going to be
     // removed so we can skip the expense of clearing the flag.
     PyGC_Head* resurrected = unreachable;
-    deduce_unreachable(resurrected, still_unreachable);
+    deduce_unreachable(resurrected, still_unreachable, NULL);
     clear_unreachable_mask(still_unreachable);
 
     // Move the resurrected objects to the old generation for future collection.
@@ -1448,15 +1461,17 @@ move_to_reachable(PyObject *op, PyGC_Head *reachable, int visited_space)
 }
 
 static intptr_t
-mark_all_reachable(PyGC_Head *reachable, PyGC_Head *visited, int visited_space)
+mark_all_reachable(PyGC_Head *reachable, PyGC_Head *visited, int visited_space,
+                   Py_ssize_t limit)
 {
-    // Transitively traverse all objects from reachable, until empty
+    // Transitively traverse all objects from reachable, until empty or
+    // `limit` objects have been marked
     struct container_and_flag arg = {
         .container = reachable,
         .visited_space = visited_space,
         .size = 0
     };
-    while (!gc_list_is_empty(reachable)) {
+    while (!gc_list_is_empty(reachable) && arg.size < limit) {
         PyGC_Head *gc = _PyGCHead_NEXT(reachable);
         assert(gc_old_space(gc) == visited_space);
         gc_list_move(gc, visited);
@@ -1466,12 +1481,16 @@ mark_all_reachable(PyGC_Head *reachable, PyGC_Head *visited, int visited_space)
                         visit_add_to_container,
                         &arg);
     }
+    // Marking is only an optimization: the referents of the objects that
+    // were not traversed are examined by later increments instead.
+    gc_list_merge(reachable, visited);
     gc_list_validate_space(visited, visited_space);
     return arg.size;
 }
 
 static intptr_t
-mark_stacks(PyInterpreterState *interp, PyGC_Head *visited, int visited_space, bool start)
+mark_stacks(PyInterpreterState *interp, PyGC_Head *visited, int visited_space,
+            bool start, Py_ssize_t limit)
 {
     PyGC_Head reachable;
     gc_list_init(&reachable);
@@ -1521,13 +1540,15 @@ mark_stacks(PyInterpreterState *interp, PyGC_Head *visited, int visited_space, b
         ts = PyThreadState_Next(ts);
         HEAD_UNLOCK(runtime);
     }
-    objects_marked += mark_all_reachable(&reachable, visited, visited_space);
+    objects_marked += mark_all_reachable(&reachable, visited, visited_space,
+                                         limit - objects_marked);
     assert(gc_list_is_empty(&reachable));
     return objects_marked;
 }
 
 static intptr_t
-mark_global_roots(PyInterpreterState *interp, PyGC_Head *visited, int visited_space)
+mark_global_roots(PyInterpreterState *interp, PyGC_Head *visited,
+                  int visited_space, Py_ssize_t limit)
 {
     PyGC_Head reachable;
     gc_list_init(&reachable);
@@ -1544,19 +1565,23 @@ mark_global_roots(PyInterpreterState *interp, PyGC_Head *visited, int visited_sp
         objects_marked += move_to_reachable(types->for_extensions.initialized[i].tp_dict, &reachable, visited_space);
         objects_marked += move_to_reachable(types->for_extensions.initialized[i].tp_subclasses, &reachable, visited_space);
     }
-    objects_marked += mark_all_reachable(&reachable, visited, visited_space);
+    objects_marked += mark_all_reachable(&reachable, visited, visited_space,
+                                         limit - objects_marked);
     assert(gc_list_is_empty(&reachable));
     return objects_marked;
 }
 
 static intptr_t
-mark_at_start(PyThreadState *tstate)
+mark_at_start(PyThreadState *tstate, Py_ssize_t limit)
 {
     // TO DO -- Make this incremental
     GCState *gcstate = &tstate->interp->gc;
     PyGC_Head *visited = &gcstate->old[gcstate->visited_space].head;
-    Py_ssize_t objects_marked = mark_global_roots(tstate->interp, visited, gcstate->visited_space);
-    objects_marked += mark_stacks(tstate->interp, visited, gcstate->visited_space, true);
+    Py_ssize_t objects_marked = mark_global_roots(tstate->interp, visited,
+                                                  gcstate->visited_space,
+                                                  limit);
+    objects_marked += mark_stacks(tstate->interp, visited, gcstate->visited_space,
+                                  true, limit - objects_marked);
     gcstate->work_to_do -= objects_marked;
     gcstate->phase = GC_PHASE_COLLECT;
     validate_spaces(gcstate);
@@ -1592,17 +1617,67 @@ assess_work_to_do(GCState *gcstate)
     return new_objects + heap_fraction;
 }
 
+/* Maximum number of objects that an increment can mark or examine and still
+ * be expected to fit in the pause budget.  To make sure that the collector
+ * keeps up with the allocation rate, the limit is at least twice the number
+ * of new objects, so that at least as many old objects as new ones are
+ * examined.
+ */
+static Py_ssize_t
+increment_size_limit(GCState *gcstate, Py_ssize_t new_objects)
+{
+    if (gcstate->pause_budget <= 0 || gcstate->increment_ns_per_object <= 0) {
+        return PY_SSIZE_T_MAX;
+    }
+    double limit = (double)gcstate->pause_budget /
+                   gcstate->increment_ns_per_object;
+    if (limit >= (double)PY_SSIZE_T_MAX) {
+        return PY_SSIZE_T_MAX;
+    }
+    return Py_MAX((Py_ssize_t)limit, 2 * new_objects);
+}
+
+/* Update the average cost of an increment per object */
+static void
+update_increment_cost(GCState *gcstate, PyTime_t duration,
+                      Py_ssize_t increment_size)
+{
+    if (increment_size <= 0) {
+        return;
+    }
+    double ns_per_object = (double)duration / (double)increment_size;
+    if (gcstate->increment_ns_per_object > 0) {
+        ns_per_object = (3 * gcstate->increment_ns_per_object +
+                         ns_per_object) / 4;
+    }
+    gcstate->increment_ns_per_object = ns_per_object;
+}
+
 static void
 gc_collect_increment(PyThreadState *tstate, struct gc_collection_stats *stats)
 {
     GC_STAT_ADD(1, collections, 1);
     GCState *gcstate = &tstate->interp->gc;
+    // Work that doesn't fit in the pause budget is left in work_to_do for
+    // the next increments.
+    Py_ssize_t size_limit = increment_size_limit(gcstate, gcstate->young.count);
+    PyTime_t start = 0;
+    if (gcstate->pause_budget > 0) {
+        (void)PyTime_PerfCounterRaw(&start);
+    }
     gcstate->work_to_do += assess_work_to_do(gcstate);
     untrack_tuples(&gcstate->young.head);
     if (gcstate->phase == GC_PHASE_MARK) {
-        Py_ssize_t objects_marked = mark_at_start(tstate);
+        Py_ssize_t objects_marked = mark_at_start(tstate, size_limit);
         GC_STAT_ADD(1, objects_transitively_reachable, objects_marked);
+        stats->visited += objects_marked;
+        _PyGC_StatsPhaseDone(stats, "mark");
         gcstate->work_to_do -= objects_marked;
+        if (gcstate->pause_budget > 0) {
+            PyTime_t end;
+            (void)PyTime_PerfCounterRaw(&end);
+            update_increment_cost(gcstate, end - start, objects_marked);
+        }
         validate_spaces(gcstate);
         return;
     }
@@ -1614,14 +1689,17 @@ gc_collect_increment(PyThreadState *tstate, struct gc_collection_stats *stats)
     if (scale_factor < 2) {
         scale_factor = 2;
     }
-    intptr_t objects_marked = mark_stacks(tstate->interp, visited, gcstate->visited_space, false);
+    intptr_t objects_marked = mark_stacks(tstate->interp, visited,
+                                          gcstate->visited_space, false,
+                                          size_limit);
     GC_STAT_ADD(1, objects_transitively_reachable, objects_marked);
     gcstate->work_to_do -= objects_marked;
     gc_list_set_space(&gcstate->young.head, gcstate->visited_space);
     gc_list_merge(&gcstate->young.head, &increment);
     gc_list_validate_space(&increment, gcstate->visited_space);
     Py_ssize_t increment_size = gc_list_size(&increment);
-    while (increment_size < gcstate->work_to_do) {
+    while (increment_size < gcstate->work_to_do &&
+           objects_marked + increment_size < size_limit) {
         if (gc_list_is_empty(not_visited)) {
             break;
         }
@@ -1633,6 +1711,8 @@ gc_collect_increment(PyThreadState *tstate, struct gc_collection_stats *stats)
         increment_size += expand_region_transitively_reachable(&increment, gc, gcstate);
     }
     GC_STAT_ADD(1, objects_not_transitively_reachable, increment_size);
+    stats->visited += objects_marked;
+    _PyGC_StatsPhaseDone(stats, "mark");
     validate_list(&increment, collecting_clear_unreachable_clear);
     gc_list_validate_space(&increment, gcstate->visited_space);
     PyGC_Head survivors;
@@ -1640,6 +1720,12 @@ gc_collect_increment(PyThreadState *tstate, struct gc_collection_stats *stats)
     gc_collect_region(tstate, &increment, &survivors, stats);
     gc_list_merge(&survivors, visited);
     assert(gc_list_is_empty(&increment));
+    if (gcstate->pause_budget > 0) {
+        PyTime_t end;
+        (void)PyTime_PerfCounterRaw(&end);
+        update_increment_cost(gcstate, end - start,
+                              objects_marked + increment_size);
+    }
     gcstate->work_to_do += gcstate->heap_size / SCAN_RATE_DIVISOR / scale_factor;
     gcstate->work_to_do -= increment_size;
 
@@ -1698,9 +1784,14 @@ gc_collect_region(PyThreadState *tstate,
     assert(!_PyErr_Occurred(tstate));
 
     gc_list_init(&unreachable);
-    deduce_unreachable(from, &unreachable);
+    deduce_unreachable(from, &unreachable, stats);
     validate_consistent_old_space(from);
     untrack_tuples(from);
+    if (gcstate->debug & _PyGC_DEBUG_TYPE_STATS) {
+        for (gc = GC_NEXT(from); gc != from; gc = GC_NEXT(gc)) {
+            _PyGC_StatsCountType(stats, &stats->survived_types, FROM_GC(gc));
+        }
+    }
     validate_consistent_old_space(to);
     if (from != to) {
         gc_list_merge(from, to);
@@ -1728,9 +1819,11 @@ gc_collect_region(PyThreadState *tstate,
             debug_cycle("collectable", FROM_GC(gc));
         }
     }
+    _PyGC_StatsPhaseDone(stats, "move_unreachable");
 
     /* Clear weakrefs and invoke callbacks as necessary. */
     stats->collected += handle_weakrefs(&unreachable, to);
+    _PyGC_StatsPhaseDone(stats, "weakrefs");
     gc_list_validate_space(to, gcstate->visited_space);
     validate_list(to, collecting_clear_unreachable_clear);
     validate_list(&unreachable, collecting_set_unreachable_clear);
@@ -1743,6 +1836,14 @@ gc_collect_region(PyThreadState *tstate,
     PyGC_Head final_unreachable;
     gc_list_init(&final_unreachable);
     handle_resurrected_objects(&unreachable, &final_unreachable, to);
+    if (gcstate->debug & _PyGC_DEBUG_TYPE_STATS) {
+        for (gc = GC_NEXT(&final_unreachable); gc != &final_unreachable;
+             gc = GC_NEXT(gc)) {
+            _PyGC_StatsCountType(stats, &stats->collected_types, FROM_GC(gc));
+        }
+        _PyGC_StatsNameTypes(stats);
+    }
+    _PyGC_StatsPhaseDone(stats, "finalize");
 
     /* Call tp_clear on objects in the final_unreachable set.  This will cause
     * the reference cycles to be broken.  It may also cause some objects
@@ -1767,6 +1868,7 @@ gc_collect_region(PyThreadState *tstate,
     handle_legacy_finalizers(tstate, gcstate, &finalizers, to);
     gc_list_validate_space(to, gcstate->visited_space);
     validate_list(to, collecting_clear_unreachable_clear);
+    _PyGC_StatsPhaseDone(stats, "delete");
 }
 
 /* Invoke progress callbacks to notify clients that garbage collection
@@ -1782,10 +1884,7 @@ do_gc_callback(GCState *gcstate, const char *phase,
     assert(PyList_CheckExact(gcstate->callbacks));
     PyObject *info = NULL;
     if (PyList_GET_SIZE(gcstate->callbacks) != 0) {
-        info = Py_BuildValue("{sisnsn}",
-            "generation", generation,
-            "collected", stats->collected,
-            "uncollectable", stats->uncollectable);
+        info = _PyGC_StatsAsDict(stats, generation, strcmp(phase, "stop") == 0);
         if (info == NULL) {
             PyErr_FormatUnraisable("Exception ignored while invoking gc callbacks");
             return;
@@ -1939,6 +2038,56 @@ _PyGC_Freeze(PyInterpreterState *interp)
     validate_spaces(gcstate);
 }
 
+static int
+visit_immortalize(PyObject *op, void *arg)
+{
+    _PyObjectStack *stack = (_PyObjectStack *)arg;
+    // Strings can only be made immortal by interning them, which could
+    // replace the object, so they are left mortal.
+    if (_Py_IsImmortal(op) || PyUnicode_CheckExact(op)) {
+        return 0;
+    }
+    if (_PyObject_IS_GC(op)) {
+        if (_PyObject_GC_IS_TRACKED(op)) {
+            // Handled by _PyGC_Immortalize() when it reaches the object
+            // in the permanent generation.
+            return 0;
+        }
+        // Untracked containers can still refer to other objects.
+        if (_PyObjectStack_Push(stack, op) < 0) {
+            return -1;
+        }
+    }
+    _Py_SetImmortalUntracked(op);
+    return 0;
+}
+
+int
+_PyGC_Immortalize(PyInterpreterState *interp)
+{
+    GCState *gcstate = &interp->gc;
+    PyGC_Head *head = &gcstate->permanent_generation.head;
+    _PyObjectStack stack = { NULL };
+    PyGC_Head *gc = GC_NEXT(head);
+    while (gc != head) {
+        PyGC_Head *next = GC_NEXT(gc);
+        PyObject *op = FROM_GC(gc);
+        PyObject *child = op;
+        do {
+            traverseproc traverse = Py_TYPE(child)->tp_traverse;
+            if (traverse(child, visit_immortalize, &stack) < 0) {
+                _PyObjectStack_Clear(&stack);
+                PyErr_NoMemory();
+                return -1;
+            }
+        } while ((child = _PyObjectStack_Pop(&stack)) != NULL);
+        // Untracks the object, removing it from the permanent generation.
+        _Py_SetImmortal(op);
+        gc = next;
+    }
+    return 0;
+}
+
 void
 _PyGC_Unfreeze(PyInterpreterState *interp)
 {
@@ -2023,6 +2172,7 @@ _PyGC_Collect(PyThreadState *tstate, int generation, _PyGC_Reason reason)
         PyDTrace_GC_START(generation);
     }
     PyObject *exc = _PyErr_GetRaisedException(tstate);
+    _PyGC_StatsStart(&stats);
     switch(generation) {
         case 0:
             gc_collect_young(tstate, &stats);
@@ -2036,12 +2186,14 @@ _PyGC_Collect(PyThreadState *tstate, int generation, _PyGC_Reason reason)
         default:
             Py_UNREACHABLE();
     }
+    _PyGC_StatsDone(&stats);
     if (PyDTrace_GC_DONE_ENABLED()) {
         PyDTrace_GC_DONE(stats.uncollectable + stats.collected);
     }
     if (reason != _Py_GC_REASON_SHUTDOWN) {
         invoke_gc_callback(gcstate, "stop", generation, &stats);
     }
+    _PyGC_StatsClear(&stats);
     _PyErr_SetRaisedException(tstate, exc);
     GC_STAT_ADD(generation, objects_collected, stats.collected);
 #ifdef Py_STATS
@@ -2430,3 +2582,245 @@ PyUnstable_GC_VisitObjects(gcvisitobjects_t callback, void *arg)
 }
 
 #endif  // Py_GIL_DISABLED
+
+
+/* Per-collection statistics shared by both collectors ************************/
+
+// The phases are timed back to back: each phase lasts from the end of the
+// previous one, so that the durations add up to the whole collection.
+void
+_PyGC_StatsStart(struct gc_collection_stats *stats)
+{
+    (void)PyTime_PerfCounterRaw(&stats->phase_start);
+}
+
+void
+_PyGC_StatsPhaseDone(struct gc_collection_stats *stats, const char *name)
+{
+    PyTime_t now;
+    (void)PyTime_PerfCounterRaw(&now);
+    PyTime_t duration = now - stats->phase_start;
+    stats->phase_start = now;
+    stats->duration += duration;
+    for (int i = 0; i < stats->nphases; i++) {
+        if (strcmp(stats->phases[i].name, name) == 0) {
+            stats->phases[i].duration += duration;
+            return;
+        }
+    }
+    if (stats->nphases < _PyGC_MAX_PHASES) {
+        stats->phases[stats->nphases].name = name;
+        stats->phases[stats->nphases].duration = duration;
+        stats->nphases++;
+    }
+}
+
+// Account for the time since the last phase, e.g. calling the "start"
+// callbacks or freeing memory after the last phase.
+void
+_PyGC_StatsDone(struct gc_collection_stats *stats)
+{
+    PyTime_t now;
+    (void)PyTime_PerfCounterRaw(&now);
+    stats->duration += now - stats->phase_start;
+    stats->phase_start = now;
+}
+
+static void
+type_stats_destroy_key(void *key)
+{
+    Py_DECREF((PyObject *)key);
+}
+
+// Count `op` under its type in `*table`.  The table only uses the raw memory
+// allocator, so this can be called while visiting the heap.  On memory
+// errors, the count is silently dropped.
+void
+_PyGC_StatsCountType(struct gc_collection_stats *stats,
+                     struct _Py_hashtable_t **table, PyObject *op)
+{
+    if (*table == NULL) {
+        _Py_hashtable_allocator_t alloc = {
+            .malloc = PyMem_RawMalloc,
+            .free = PyMem_RawFree,
+        };
+        *table = _Py_hashtable_new_full(_Py_hashtable_hash_ptr,
+                                        _Py_hashtable_compare_direct,
+                                        type_stats_destroy_key, NULL,
+                                        &alloc);
+        if (*table == NULL) {
+            return;
+        }
+    }
+    PyTypeObject *type = Py_TYPE(op);
+    _Py_hashtable_entry_t *entry = _Py_hashtable_get_entry(*table, type);
+    if (entry != NULL) {
+        entry->value = (void *)((uintptr_t)entry->value + 1);
+        return;
+    }
+    // The type is kept alive until _PyGC_StatsNameTypes() is called: it may
+    // be part of the garbage.
+    if (_Py_hashtable_set(*table, Py_NewRef(type), (void *)(uintptr_t)1) < 0) {
+        Py_DECREF(type);
+    }
+}
+
+static int
+type_stats_add_name(_Py_hashtable_t *ht, const void *key,
+                    const void *value, void *dict)
+{
+    PyObject *name = PyType_GetFullyQualifiedName((PyTypeObject *)key);
+    if (name == NULL) {
+        return -1;
+    }
+    // Distinct types can have the same name, so add up their counts:
+    size_t total = (uintptr_t)value;
+    PyObject *count;
+    if (PyDict_GetItemRef((PyObject *)dict, name, &count) < 0) {
+        Py_DECREF(name);
+        return -1;
+    }
+    if (count != NULL) {
+        total += PyLong_AsSize_t(count);
+        Py_DECREF(count);
+    }
+    count = PyLong_FromSize_t(total);
+    if (count == NULL) {
+        Py_DECREF(name);
+        return -1;
+    }
+    int err = PyDict_SetItem((PyObject *)dict, name, count);
+    Py_DECREF(name);
+    Py_DECREF(count);
+    return err;
+}
+
+// Returns a new dict mapping the names of the types in `*table` to their
+// counts, and destroys the table, or NULL with an exception set.
+static PyObject *
+name_type_stats(_Py_hashtable_t **table)
+{
+    PyObject *dict = PyDict_New();
+    if (dict != NULL && *table != NULL &&
+        _Py_hashtable_foreach(*table, type_stats_add_name, dict) < 0)
+    {
+        Py_CLEAR(dict);
+    }
+    if (*table != NULL) {
+        _Py_hashtable_destroy(*table);
+        *table = NULL;
+    }
+    return dict;
+}
+
+// Replace the type counts with counts by type name, releasing the types.
+// This must be called after the collected objects have been counted, but
+// before they are cleared, so that no type in the garbage is kept alive.
+// On errors, the counts are silently dropped.
+void
+_PyGC_StatsNameTypes(struct gc_collection_stats *stats)
+{
+    assert(stats->collected_type_names == NULL);
+    assert(stats->survived_type_names == NULL);
+    stats->collected_type_names = name_type_stats(&stats->collected_types);
+    stats->survived_type_names = name_type_stats(&stats->survived_types);
+    if (stats->collected_type_names == NULL ||
+        stats->survived_type_names == NULL)
+    {
+        PyErr_Clear();
+    }
+}
+
+static int
+add_type_stats(PyObject *info, const char *name, PyObject *names)
+{
+    PyObject *dict = names ? Py_NewRef(names) : PyDict_New();
+    if (dict == NULL) {
+        return -1;
+    }
+    int err = PyDict_SetItemString(info, name, dict);
+    Py_DECREF(dict);
+    return err;
+}
+
+// Build the info dict passed to gc.callbacks.  `done` is false for the
+// "start" phase, where only the generation and zero counts are reported.
+PyObject *
+_PyGC_StatsAsDict(struct gc_collection_stats *stats, int generation, int done)
+{
+    PyObject *info = Py_BuildValue("{sisnsn}",
+        "generation", generation,
+        "collected", stats->collected,
+        "uncollectable", stats->uncollectable);
+    if (info == NULL || !done) {
+        return info;
+    }
+    PyObject *phases = PyDict_New();
+    if (phases == NULL) {
+        goto error;
+    }
+    for (int i = 0; i < stats->nphases; i++) {
+        PyObject *duration = PyFloat_FromDouble(
+            PyTime_AsSecondsDouble(stats->phases[i].duration));
+        if (duration == NULL ||
+            PyDict_SetItemString(phases, stats->phases[i].name, duration) < 0)
+        {
+            Py_XDECREF(duration);
+            Py_DECREF(phases);
+            goto error;
+        }
+        Py_DECREF(duration);
+    }
+    int err = PyDict_SetItemString(info, "phases", phases);
+    Py_DECREF(phases);
+    if (err < 0) {
+        goto error;
+    }
+    PyObject *value = PyFloat_FromDouble(PyTime_AsSecondsDouble(stats->duration));
+    if (value == NULL) {
+        goto error;
+    }
+    err = PyDict_SetItemString(info, "duration", value);
+    Py_DECREF(value);
+    if (err < 0) {
+        goto error;
+    }
+    value = PyLong_FromSsize_t(stats->visited);
+    if (value == NULL) {
+        goto error;
+    }
+    err = PyDict_SetItemString(info, "visited", value);
+    Py_DECREF(value);
+    if (err < 0) {
+        goto error;
+    }
+    if (_PyInterpreterState_GET()->gc.debug & _PyGC_DEBUG_TYPE_STATS) {
+        if (add_type_stats(info, "collected_types",
+                           stats->collected_type_names) < 0 ||
+            add_type_stats(info, "survived_types",
+                           stats->survived_type_names) < 0)
+        {
+            goto error;
+        }
+    }
+    return info;
+
+error:
+    Py_XDECREF(info);
+    return NULL;
+}
+
+void
+_PyGC_StatsClear(struct gc_collection_stats *stats)
+{
+    if (stats->collected_types != NULL) {
+        _Py_hashtable_destroy(stats->collected_types);
+        stats->collected_types = NULL;
+    }
+    if (stats->survived_types != NULL) {
+        _Py_hashtable_destroy(stats->survived_types);
+        stats->survived_types = NULL;
+    }
+    Py_CLEAR(stats->collected_type_names);
+    Py_CLEAR(stats->survived_type_names);
+}
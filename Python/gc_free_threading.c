@@ -9,10 +9,14 @@
 #include "pycore_initconfig.h"    // _PyStatus_NO_MEMORY()
 #include "pycore_interp.h"        // PyInterpreterState.gc
 #include "pycore_interpframe.h"   // _PyFrame_GetLocalsArray()
+#include "pycore_lock.h"          // _Py_yield()
 #include "pycore_object_alloc.h"  // _PyObject_MallocWithType()
+#include "pycore_parking_lot.h"   // _PyParkingLot_Park()
 #include "pycore_pystate.h"       // _PyThreadState_GET()
+#include "pycore_pythread.h"      // PyThread_start_joinable_thread()
 #include "pycore_tstate.h"        // _PyThreadStateImpl
 #include "pycore_tuple.h"         // _PyTuple_MaybeUntrack()
+#include "pycore_typeobject.h"    // _PyType_HasStaticTraverse()
 #include "pycore_weakref.h"       // _PyWeakref_ClearRef()
 
 #include "pydtrace.h"
@@ -77,6 +81,7 @@ struct collection_state {
     Py_ssize_t collected;
     Py_ssize_t uncollectable;
     Py_ssize_t long_lived_total;
+    struct gc_collection_stats *stats;
     struct worklist unreachable;
     struct worklist legacy_finalizers;
     struct worklist wrcb_to_call;
@@ -351,8 +356,8 @@ op_from_block(void *block, void *arg, bool include_frozen)
 }
 
 static int
-gc_visit_heaps_lock_held(PyInterpreterState *interp, mi_block_visit_fun *visitor,
-                         struct visitor_args *arg)
+gc_visit_heaps_lock_held(PyInterpreterState *interp, bool visit_blocks,
+                         mi_block_visit_fun *visitor, struct visitor_args *arg)
 {
     // Offset of PyObject header from start of memory block.
     Py_ssize_t offset_base = 0;
@@ -373,13 +378,13 @@ gc_visit_heaps_lock_held(PyInterpreterState *interp, mi_block_visit_fun *visitor
         }
 
         arg->offset = offset_base;
-        if (!mi_heap_visit_blocks(&m->heaps[_Py_MIMALLOC_HEAP_GC], true,
-                                  visitor, arg)) {
+        if (!mi_heap_visit_blocks(&m->heaps[_Py_MIMALLOC_HEAP_GC],
+                                  visit_blocks, visitor, arg)) {
             return -1;
         }
         arg->offset = offset_pre;
-        if (!mi_heap_visit_blocks(&m->heaps[_Py_MIMALLOC_HEAP_GC_PRE], true,
-                                  visitor, arg)) {
+        if (!mi_heap_visit_blocks(&m->heaps[_Py_MIMALLOC_HEAP_GC_PRE],
+                                  visit_blocks, visitor, arg)) {
             return -1;
         }
     }
@@ -387,13 +392,13 @@ gc_visit_heaps_lock_held(PyInterpreterState *interp, mi_block_visit_fun *visitor
     // visit blocks in the per-interpreter abandoned pool (from dead threads)
     mi_abandoned_pool_t *pool = &interp->mimalloc.abandoned_pool;
     arg->offset = offset_base;
-    if (!_mi_abandoned_pool_visit_blocks(pool, _Py_MIMALLOC_HEAP_GC, true,
-                                         visitor, arg)) {
+    if (!_mi_abandoned_pool_visit_blocks(pool, _Py_MIMALLOC_HEAP_GC,
+                                         visit_blocks, visitor, arg)) {
         return -1;
     }
     arg->offset = offset_pre;
-    if (!_mi_abandoned_pool_visit_blocks(pool, _Py_MIMALLOC_HEAP_GC_PRE, true,
-                                         visitor, arg)) {
+    if (!_mi_abandoned_pool_visit_blocks(pool, _Py_MIMALLOC_HEAP_GC_PRE,
+                                         visit_blocks, visitor, arg)) {
         return -1;
     }
     return 0;
@@ -412,7 +417,22 @@ gc_visit_heaps(PyInterpreterState *interp, mi_block_visit_fun *visitor,
 
     int err;
     HEAD_LOCK(&_PyRuntime);
-    err = gc_visit_heaps_lock_held(interp, visitor, arg);
+    err = gc_visit_heaps_lock_held(interp, true, visitor, arg);
+    HEAD_UNLOCK(&_PyRuntime);
+    return err;
+}
+
+// Like gc_visit_heaps(), but only calls visitor once per page, with
+// block == NULL, without walking the page's blocks.
+static int
+gc_visit_heap_pages(PyInterpreterState *interp, mi_block_visit_fun *visitor,
+                    struct visitor_args *arg)
+{
+    assert(interp->stoptheworld.world_stopped);
+
+    int err;
+    HEAD_LOCK(&_PyRuntime);
+    err = gc_visit_heaps_lock_held(interp, false, visitor, arg);
     HEAD_UNLOCK(&_PyRuntime);
     return err;
 }
@@ -1125,6 +1145,551 @@ mark_heap_visitor(const mi_heap_t *heap, const mi_heap_area_t *area,
     return true;
 }
 
+// Parallel marking
+//
+// When interp->gc.mark_threads is greater than one (see PYTHON_GC_MARK_THREADS
+// in _PyGC_Init), the "mark alive" and mark_heap_visitor passes are split
+// across that many threads: the collecting thread plus helper threads.  For
+// mark_heap_visitor, the GC heap pages are gathered into an array and claimed
+// a few at a time through a shared cursor.  For "mark alive", the collecting
+// thread starts with the roots.  Each thread propagates reachability using its
+// own stack and hands part of it to the other threads once they run out of
+// work.
+//
+// The helper threads are started by the first collection that marks in
+// parallel, and stay parked between passes until _PyGC_Fini().  Collections
+// therefore don't pay for starting threads during their stop-the-world pause.
+//
+// The helper threads have no thread state.  They only call tp_traverse, and
+// they allocate with PyMem_RawMalloc(), which does not use mimalloc.  The
+// tp_traverse of heap types defined in C may use the C API (for example,
+// PyType_GetBaseByToken()), so helper threads set such objects aside and the
+// collecting thread traverses them once the helper threads are done.  Objects
+// are claimed by atomically setting _PyGC_BITS_ALIVE or clearing
+// _PyGC_BITS_UNREACHABLE, which is the only bit of ob_gc_bits modified by the
+// respective pass.
+
+// Number of heap pages claimed at once from the shared cursor
+#define GC_MARK_PAGES_PER_CLAIM 4
+
+// Don't start helper threads for heaps with fewer pages than this per thread
+#define GC_MARK_MIN_PAGES_PER_THREAD 16
+
+// Same, for the "mark alive" pass, based on the number of long lived objects
+#define GC_MARK_MIN_OBJECTS_PER_THREAD 20000
+
+// Number of objects handed over to idle threads at once
+#define GC_MARK_SHARE_SIZE 256
+
+#define GC_MARK_MAX_THREADS 256
+
+struct gc_mark_page {
+    mi_heap_area_t area;
+    mi_page_t *page;
+    Py_ssize_t offset;  // offset of PyObject from start of block
+};
+
+struct gc_mark_chunk {
+    struct gc_mark_chunk *next;
+    Py_ssize_t size;
+    PyObject *items[GC_MARK_SHARE_SIZE];
+};
+
+struct gc_mark_shared {
+    struct collection_state *state;
+    visitproc visit;
+    struct gc_mark_page *pages;
+    Py_ssize_t npages;
+    Py_ssize_t next_page;
+    int nthreads;
+    int error;
+
+    // protects `chunks` and writes to `active`
+    PyMutex mutex;
+    struct gc_mark_chunk *chunks;
+    // number of threads that may still produce work
+    int active;
+};
+
+struct gc_mark_worker {
+    struct visitor_args base;
+    struct gc_mark_shared *shared;
+    PyObject **stack;
+    Py_ssize_t size;
+    Py_ssize_t capacity;
+    // objects left for the collecting thread to traverse (helpers only)
+    PyObject **deferred;
+    Py_ssize_t ndeferred;
+    Py_ssize_t deferred_capacity;
+    int is_helper;
+};
+
+struct gc_mark_helper {
+    struct _gc_mark_pool *pool;
+    int index;  // of this thread's worker in pool->workers
+    PyThread_handle_t handle;
+};
+
+// The helper threads of an interpreter (interp->gc.mark_pool)
+struct _gc_mark_pool {
+    int nhelpers;
+    // Incremented to start a pass, or to make the threads exit
+    int generation;
+    int stop;
+    // Workers for the current pass; workers[0] is the collecting thread's
+    struct gc_mark_worker *workers;
+    // Number of helper threads still working on the current pass
+    int running;
+    struct gc_mark_helper helpers[];
+};
+
+struct gc_page_collector {
+    struct visitor_args base;
+    struct gc_mark_page *pages;
+    Py_ssize_t npages;
+    Py_ssize_t capacity;
+};
+
+static bool
+collect_heap_pages(const mi_heap_t *heap, const mi_heap_area_t *area,
+                   void *block, size_t block_size, void *args)
+{
+    // Called by gc_visit_heap_pages(), so only once per page, with
+    // block == NULL.
+    assert(block == NULL);
+    struct gc_page_collector *c = (struct gc_page_collector *)args;
+    if (area->used == 0) {
+        return true;
+    }
+    if (c->npages < c->capacity) {
+        struct gc_mark_page *p = &c->pages[c->npages];
+        p->area = *area;
+        p->page = _mi_ptr_page(area->blocks);
+        p->offset = c->base.offset;
+    }
+    c->npages++;
+    return true;
+}
+
+static int
+gc_mark_array_push(PyObject ***items, Py_ssize_t *size, Py_ssize_t *capacity,
+                   PyObject *op)
+{
+    if (*size == *capacity) {
+        Py_ssize_t new_capacity = *capacity ? *capacity * 2 : 1024;
+        PyObject **new_items = PyMem_RawRealloc(*items,
+                                                new_capacity * sizeof(PyObject *));
+        if (new_items == NULL) {
+            return -1;
+        }
+        *items = new_items;
+        *capacity = new_capacity;
+    }
+    (*items)[(*size)++] = op;
+    return 0;
+}
+
+static int
+gc_mark_push(struct gc_mark_worker *w, PyObject *op)
+{
+    return gc_mark_array_push(&w->stack, &w->size, &w->capacity, op);
+}
+
+// Atomically clear the unreachable bit.  Returns 1 if this thread cleared it.
+static inline int
+gc_mark_claim(PyObject *op)
+{
+    if (!(_Py_atomic_load_uint8_relaxed(&op->ob_gc_bits) & _PyGC_BITS_UNREACHABLE)) {
+        return 0;
+    }
+    uint8_t old = _Py_atomic_and_uint8(&op->ob_gc_bits,
+                                       (uint8_t)~_PyGC_BITS_UNREACHABLE);
+    return (old & _PyGC_BITS_UNREACHABLE) != 0;
+}
+
+static int
+visit_clear_unreachable_parallel(PyObject *op, void *arg)
+{
+    if (gc_mark_claim(op)) {
+        return gc_mark_push((struct gc_mark_worker *)arg, op);
+    }
+    return 0;
+}
+
+// Move part of the stack to the shared list if another thread is idle.
+static void
+gc_mark_maybe_share(struct gc_mark_worker *w)
+{
+    struct gc_mark_shared *shared = w->shared;
+    if (w->size < 2 * GC_MARK_SHARE_SIZE ||
+        _Py_atomic_load_int_relaxed(&shared->active) ==
+        _Py_atomic_load_int_relaxed(&shared->nthreads))
+    {
+        return;
+    }
+    struct gc_mark_chunk *chunk = PyMem_RawMalloc(sizeof(*chunk));
+    if (chunk == NULL) {
+        return;  // keep the work for ourselves
+    }
+    w->size -= GC_MARK_SHARE_SIZE;
+    memcpy(chunk->items, &w->stack[w->size],
+           GC_MARK_SHARE_SIZE * sizeof(PyObject *));
+    chunk->size = GC_MARK_SHARE_SIZE;
+    PyMutex_LockFlags(&shared->mutex, _Py_LOCK_DONT_DETACH);
+    chunk->next = shared->chunks;
+    shared->chunks = chunk;
+    PyMutex_Unlock(&shared->mutex);
+}
+
+// Transitively mark objects on the worker's stack as reachable.
+static int
+gc_mark_propagate(struct gc_mark_worker *w)
+{
+    while (w->size > 0) {
+        if (_Py_atomic_load_int_relaxed(&w->shared->error)) {
+            w->size = 0;
+            return -1;
+        }
+        PyObject *op = w->stack[--w->size];
+        if (w->is_helper && !_PyType_HasStaticTraverse(Py_TYPE(op))) {
+            if (gc_mark_array_push(&w->deferred, &w->ndeferred,
+                                   &w->deferred_capacity, op) < 0) {
+                w->size = 0;
+                return -1;
+            }
+            continue;
+        }
+        traverseproc traverse = Py_TYPE(op)->tp_traverse;
+        if (traverse(op, w->shared->visit, w) < 0) {
+            w->size = 0;
+            return -1;
+        }
+        gc_mark_maybe_share(w);
+    }
+    return 0;
+}
+
+// Parallel version of mark_heap_visitor()
+static bool
+mark_heap_visitor_parallel(const mi_heap_t *heap, const mi_heap_area_t *area,
+                           void *block, size_t block_size, void *args)
+{
+    struct gc_mark_worker *w = (struct gc_mark_worker *)args;
+    if (block == NULL) {
+        return true;
+    }
+    PyObject *op = (PyObject *)((char*)block + w->base.offset);
+    uint8_t bits = _Py_atomic_load_uint8_relaxed(&op->ob_gc_bits);
+    if (!(bits & _PyGC_BITS_TRACKED) ||
+        (bits & (_PyGC_BITS_FROZEN | _PyGC_BITS_ALIVE)) ||
+        !(bits & _PyGC_BITS_UNREACHABLE))
+    {
+        return true;
+    }
+
+    _PyObject_ASSERT_WITH_MSG(op, gc_get_refs(op) >= 0,
+                                  "refcount is too small");
+
+    struct collection_state *state = w->shared->state;
+    int keep_alive = (state->skip_deferred_objects &&
+                      _PyObject_HasDeferredRefcount(op));
+
+    if ((gc_get_refs(op) != 0 || keep_alive) && gc_mark_claim(op)) {
+        if (gc_mark_push(w, op) < 0 || gc_mark_propagate(w) < 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void
+gc_mark_worker_run(struct gc_mark_worker *w)
+{
+    struct gc_mark_shared *shared = w->shared;
+
+    // Objects that the caller put on the stack of this thread
+    if (gc_mark_propagate(w) < 0) {
+        _Py_atomic_store_int(&shared->error, 1);
+    }
+
+    // Visit the heap pages, a few at a time.
+    for (;;) {
+        if (_Py_atomic_load_int_relaxed(&shared->error)) {
+            break;
+        }
+        Py_ssize_t i = _Py_atomic_add_ssize(&shared->next_page,
+                                            GC_MARK_PAGES_PER_CLAIM);
+        if (i >= shared->npages) {
+            break;
+        }
+        Py_ssize_t end = Py_MIN(i + GC_MARK_PAGES_PER_CLAIM, shared->npages);
+        for (; i < end; i++) {
+            struct gc_mark_page *p = &shared->pages[i];
+            w->base.offset = p->offset;
+            if (!_mi_heap_area_visit_blocks(&p->area, p->page,
+                                            mark_heap_visitor_parallel, w)) {
+                _Py_atomic_store_int(&shared->error, 1);
+                break;
+            }
+        }
+    }
+
+    // Out of pages: help with the work shared by other threads until no
+    // thread can produce any more.
+    PyMutex_LockFlags(&shared->mutex, _Py_LOCK_DONT_DETACH);
+    _Py_atomic_add_int(&shared->active, -1);
+    for (;;) {
+        struct gc_mark_chunk *chunk = shared->chunks;
+        if (chunk != NULL) {
+            shared->chunks = chunk->next;
+            _Py_atomic_add_int(&shared->active, 1);
+            PyMutex_Unlock(&shared->mutex);
+
+            int err = 0;
+            for (Py_ssize_t i = 0; i < chunk->size && err == 0; i++) {
+                err = gc_mark_push(w, chunk->items[i]);
+            }
+            PyMem_RawFree(chunk);
+            if (err < 0 || gc_mark_propagate(w) < 0) {
+                _Py_atomic_store_int(&shared->error, 1);
+                w->size = 0;
+            }
+
+            PyMutex_LockFlags(&shared->mutex, _Py_LOCK_DONT_DETACH);
+            _Py_atomic_add_int(&shared->active, -1);
+        }
+        else if (_Py_atomic_load_int_relaxed(&shared->active) == 0) {
+            break;
+        }
+        else {
+            PyMutex_Unlock(&shared->mutex);
+            _Py_yield();
+            PyMutex_LockFlags(&shared->mutex, _Py_LOCK_DONT_DETACH);
+        }
+    }
+    PyMutex_Unlock(&shared->mutex);
+}
+
+static void
+gc_mark_pool_thread(void *arg)
+{
+    struct gc_mark_helper *helper = (struct gc_mark_helper *)arg;
+    struct _gc_mark_pool *pool = helper->pool;
+    int seen = 0;
+    for (;;) {
+        int generation;
+        while ((generation = _Py_atomic_load_int(&pool->generation)) == seen) {
+            _PyParkingLot_Park(&pool->generation, &seen, sizeof(seen),
+                               -1, NULL, /*detach=*/0);
+        }
+        seen = generation;
+        if (_Py_atomic_load_int(&pool->stop)) {
+            return;
+        }
+        gc_mark_worker_run(&pool->workers[helper->index]);
+        if (_Py_atomic_add_int(&pool->running, -1) == 1) {
+            _PyParkingLot_UnparkAll(&pool->running);
+        }
+    }
+}
+
+// Returns the helper threads of the interpreter, starting up to `nhelpers`
+// of them if this is the first parallel pass.  Returns NULL if no thread
+// could be started.
+static struct _gc_mark_pool *
+gc_mark_pool_get(PyInterpreterState *interp, int nhelpers)
+{
+    struct _gc_mark_pool *pool = interp->gc.mark_pool;
+    if (pool != NULL) {
+        return pool;
+    }
+    pool = PyMem_RawCalloc(1, sizeof(*pool) +
+                              nhelpers * sizeof(struct gc_mark_helper));
+    if (pool == NULL) {
+        return NULL;
+    }
+    for (int i = 0; i < nhelpers; i++) {
+        struct gc_mark_helper *helper = &pool->helpers[i];
+        helper->pool = pool;
+        helper->index = i + 1;
+        PyThread_ident_t ident;
+        if (PyThread_start_joinable_thread(gc_mark_pool_thread, helper,
+                                           &ident, &helper->handle) != 0) {
+            // Continue with the threads we have.
+            break;
+        }
+        pool->nhelpers++;
+    }
+    if (pool->nhelpers == 0) {
+        PyMem_RawFree(pool);
+        return NULL;
+    }
+    interp->gc.mark_pool = pool;
+    return pool;
+}
+
+static void
+gc_mark_pool_stop(PyInterpreterState *interp)
+{
+    struct _gc_mark_pool *pool = interp->gc.mark_pool;
+    if (pool == NULL) {
+        return;
+    }
+    interp->gc.mark_pool = NULL;
+    _Py_atomic_store_int(&pool->stop, 1);
+    _Py_atomic_add_int(&pool->generation, 1);
+    _PyParkingLot_UnparkAll(&pool->generation);
+    for (int i = 0; i < pool->nhelpers; i++) {
+        PyThread_join_thread(pool->helpers[i].handle);
+    }
+    PyMem_RawFree(pool);
+}
+
+// Runs gc_mark_worker_run() on the collecting thread and the helper threads,
+// with `roots` (if not NULL) on the stack of the collecting thread.  Returns
+// 1 on success, 0 if the pass should run on this thread alone (`roots` is
+// then left untouched), or -1 on out-of-memory while marking.
+static int
+gc_mark_run_threads(PyInterpreterState *interp, struct gc_mark_shared *shared,
+                    int nthreads, _PyObjectStack *roots)
+{
+    struct _gc_mark_pool *pool = gc_mark_pool_get(interp, nthreads - 1);
+    if (pool == NULL) {
+        return 0;
+    }
+    nthreads = pool->nhelpers + 1;
+    struct gc_mark_worker *workers = PyMem_RawCalloc(nthreads,
+                                                     sizeof(*workers));
+    if (workers == NULL) {
+        return 0;
+    }
+    for (int i = 0; i < nthreads; i++) {
+        workers[i].shared = shared;
+        workers[i].is_helper = (i > 0);
+    }
+    if (roots != NULL) {
+        PyObject *op;
+        while ((op = _PyObjectStack_Pop(roots)) != NULL) {
+            if (gc_mark_push(&workers[0], op) < 0) {
+                _PyObjectStack_Clear(roots);
+                PyMem_RawFree(workers[0].stack);
+                PyMem_RawFree(workers);
+                return -1;
+            }
+        }
+    }
+
+    // Publish the pass before waking up the helper threads.
+    shared->nthreads = nthreads;
+    shared->active = nthreads;
+    pool->workers = workers;
+    _Py_atomic_store_int_relaxed(&pool->running, pool->nhelpers);
+    _Py_atomic_add_int(&pool->generation, 1);
+    _PyParkingLot_UnparkAll(&pool->generation);
+
+    gc_mark_worker_run(&workers[0]);
+
+    int running;
+    while ((running = _Py_atomic_load_int(&pool->running)) != 0) {
+        _PyParkingLot_Park(&pool->running, &running, sizeof(running),
+                           -1, NULL, /*detach=*/0);
+    }
+    pool->workers = NULL;
+
+    // Traverse the objects that the helper threads set aside, and whatever
+    // is reachable from them, on this thread.
+    shared->nthreads = shared->active = 1;
+    for (int i = 1; i < nthreads && !shared->error; i++) {
+        struct gc_mark_worker *helper = &workers[i];
+        for (Py_ssize_t j = 0; j < helper->ndeferred; j++) {
+            if (gc_mark_push(&workers[0], helper->deferred[j]) < 0) {
+                shared->error = 1;
+                break;
+            }
+        }
+        if (gc_mark_propagate(&workers[0]) < 0) {
+            shared->error = 1;
+        }
+    }
+    workers[0].size = 0;
+
+    for (int i = 0; i < nthreads; i++) {
+        assert(workers[i].size == 0);
+        PyMem_RawFree(workers[i].stack);
+        PyMem_RawFree(workers[i].deferred);
+    }
+    assert(shared->chunks == NULL);
+    PyMem_RawFree(workers);
+    return shared->error ? -1 : 1;
+}
+
+#ifdef GC_ENABLE_MARK_ALIVE
+// Atomically set the alive bit of a tracked object.  Returns 1 if this thread
+// set it.
+static inline int
+gc_mark_claim_alive(PyObject *op)
+{
+    uint8_t bits = _Py_atomic_load_uint8_relaxed(&op->ob_gc_bits);
+    if (!(bits & _PyGC_BITS_TRACKED) || (bits & _PyGC_BITS_ALIVE)) {
+        return 0;
+    }
+    uint8_t old = _Py_atomic_or_uint8(&op->ob_gc_bits, _PyGC_BITS_ALIVE);
+    return (old & _PyGC_BITS_ALIVE) == 0;
+}
+
+// Parallel version of gc_mark_enqueue_no_buffer(), without the untracking
+static int
+visit_mark_alive_parallel(PyObject *op, void *arg)
+{
+    if (op != NULL && gc_mark_claim_alive(op)) {
+        return gc_mark_push((struct gc_mark_worker *)arg, op);
+    }
+    return 0;
+}
+#endif
+
+// Runs the mark_heap_visitor pass on multiple threads.  Returns 1 on success,
+// 0 if the pass should run on this thread alone, or -1 on out-of-memory.
+static int
+mark_heap_parallel(PyInterpreterState *interp, struct collection_state *state)
+{
+    int nthreads = interp->gc.mark_threads;
+    if (nthreads <= 1) {
+        return 0;
+    }
+
+    // Count the pages first, because we can't allocate while visiting.
+    // Visiting pages may free delayed blocks, so the count is only an
+    // estimate; fall back to a single thread if it grows.
+    struct gc_page_collector collector = { 0 };
+    gc_visit_heap_pages(interp, &collect_heap_pages, &collector.base);
+    if (collector.npages < (Py_ssize_t)nthreads * GC_MARK_MIN_PAGES_PER_THREAD) {
+        return 0;
+    }
+    collector.capacity = collector.npages + collector.npages / 8;
+    collector.pages = PyMem_RawMalloc(collector.capacity *
+                                      sizeof(struct gc_mark_page));
+    if (collector.pages == NULL) {
+        return 0;
+    }
+    collector.npages = 0;
+    gc_visit_heap_pages(interp, &collect_heap_pages, &collector.base);
+    if (collector.npages > collector.capacity) {
+        PyMem_RawFree(collector.pages);
+        return 0;
+    }
+
+    struct gc_mark_shared shared = {
+        .state = state,
+        .visit = visit_clear_unreachable_parallel,
+        .pages = collector.pages,
+        .npages = collector.npages,
+    };
+    int err = gc_mark_run_threads(interp, &shared, nthreads, NULL);
+    PyMem_RawFree(collector.pages);
+    return err;
+}
+
 static bool
 restore_refs(const mi_heap_t *heap, const mi_heap_area_t *area,
              void *block, size_t block_size, void *args)
@@ -1156,6 +1721,7 @@ scan_heap_visitor(const mi_heap_t *heap, const mi_heap_area_t *area,
     }
 
     struct collection_state *state = (struct collection_state *)args;
+    state->stats->visited++;
     if (gc_is_unreachable(op)) {
         // Disable deferred refcounting for unreachable objects so that they
         // are collected immediately after finalization.
@@ -1187,6 +1753,9 @@ scan_heap_visitor(const mi_heap_t *heap, const mi_heap_area_t *area,
     gc_restore_tid(op);
     gc_clear_alive(op);
     state->long_lived_total++;
+    if (state->gcstate->debug & _PyGC_DEBUG_TYPE_STATS) {
+        _PyGC_StatsCountType(state->stats, &state->stats->survived_types, op);
+    }
     return true;
 }
 
@@ -1348,6 +1917,16 @@ gc_mark_alive_from_roots(PyInterpreterState *interp,
     // would hold about 130k objects.
     mark_args.use_prefetch = interp->gc.long_lived_total > 200000;
 
+    // With several marking threads, the roots are gathered on the stack and
+    // handed over to the threads, which don't use the prefetch buffer.
+    int nthreads = interp->gc.mark_threads;
+    bool parallel = (nthreads > 1 &&
+                     interp->gc.long_lived_total >=
+                     (Py_ssize_t)nthreads * GC_MARK_MIN_OBJECTS_PER_THREAD);
+    if (parallel) {
+        mark_args.use_prefetch = false;
+    }
+
     #define MARK_ENQUEUE(op) \
         if (op != NULL ) { \
             if (gc_mark_enqueue(op, &mark_args) < 0) { \
@@ -1378,7 +1957,19 @@ gc_mark_alive_from_roots(PyInterpreterState *interp,
     #undef MARK_ENQUEUE
 
     // Use tp_traverse to find everything reachable from roots.
-    if (gc_propagate_alive(&mark_args) < 0) {
+    int err = 0;
+    if (parallel) {
+        struct gc_mark_shared shared = {
+            .state = state,
+            .visit = visit_mark_alive_parallel,
+        };
+        err = gc_mark_run_threads(interp, &shared, nthreads,
+                                  &mark_args.stack);
+    }
+    if (err == 0) {
+        err = gc_propagate_alive(&mark_args);
+    }
+    if (err < 0) {
         gc_abort_mark_alive(interp, state, &mark_args);
         return -1;
     }
@@ -1409,6 +2000,7 @@ deduce_unreachable_heap(PyInterpreterState *interp,
     // by computing the difference between the refcount and the number of
     // incoming references.
     gc_visit_heaps(interp, &update_refs, &state->base);
+    _PyGC_StatsPhaseDone(state->stats, "update_refs");
 
 #ifdef GC_DEBUG
     // Check that all objects are marked as unreachable and that the computed
@@ -1421,11 +2013,16 @@ deduce_unreachable_heap(PyInterpreterState *interp,
 
     // Transitively mark reachable objects by clearing the
     // _PyGC_BITS_UNREACHABLE flag.
-    if (gc_visit_heaps(interp, &mark_heap_visitor, &state->base) < 0) {
+    int err = mark_heap_parallel(interp, state);
+    if (err == 0) {
+        err = gc_visit_heaps(interp, &mark_heap_visitor, &state->base);
+    }
+    if (err < 0) {
         // On out-of-memory, restore the refcounts and bail out.
         gc_visit_heaps(interp, &restore_refs, &state->base);
         return -1;
     }
+    _PyGC_StatsPhaseDone(state->stats, "mark_heap");
 
     // Identify remaining unreachable objects and push them onto a stack.
     // Restores ob_tid for reachable objects.
@@ -1438,6 +2035,7 @@ deduce_unreachable_heap(PyInterpreterState *interp,
             return -1;
         }
     }
+    _PyGC_StatsPhaseDone(state->stats, "scan_heap");
 
     return 0;
 }
@@ -1579,9 +2177,28 @@ _PyGC_Init(PyInterpreterState *interp)
         return _PyStatus_NO_MEMORY();
     }
 
+    int mark_threads;
+    char *env = Py_GETENV("PYTHON_GC_MARK_THREADS");
+    if (env && _Py_str_to_int(env, &mark_threads) == 0 && mark_threads > 0) {
+        gcstate->mark_threads = Py_MIN(mark_threads, GC_MARK_MAX_THREADS);
+    }
+
     return _PyStatus_OK();
 }
 
+void
+_PyGC_AfterFork_Child(_PyRuntimeState *runtime)
+{
+    // The helper threads of the parent don't exist in the child.  The pool
+    // is plain memory, so it can be freed without waking them up.
+    for (PyInterpreterState *interp = runtime->interpreters.head;
+         interp != NULL; interp = interp->next)
+    {
+        PyMem_RawFree(interp->gc.mark_pool);
+        interp->gc.mark_pool = NULL;
+    }
+}
+
 static void
 debug_cycle(const char *msg, PyObject *op)
 {
@@ -1814,8 +2431,7 @@ handle_resurrected_objects(struct collection_state *state)
  */
 static void
 invoke_gc_callback(PyThreadState *tstate, const char *phase,
-                   int generation, Py_ssize_t collected,
-                   Py_ssize_t uncollectable)
+                   int generation, struct gc_collection_stats *stats)
 {
     assert(!_PyErr_Occurred(tstate));
 
@@ -1829,10 +2445,8 @@ invoke_gc_callback(PyThreadState *tstate, const char *phase,
     assert(PyList_CheckExact(gcstate->callbacks));
     PyObject *info = NULL;
     if (PyList_GET_SIZE(gcstate->callbacks) != 0) {
-        info = Py_BuildValue("{sisnsn}",
-            "generation", generation,
-            "collected", collected,
-            "uncollectable", uncollectable);
+        info = _PyGC_StatsAsDict(stats, generation,
+                                 strcmp(phase, "stop") == 0);
         if (info == NULL) {
             PyErr_FormatUnraisable("Exception ignored while "
                                    "invoking gc callbacks");
@@ -1955,6 +2569,7 @@ gc_collect_internal(PyInterpreterState *interp, struct collection_state *state,
     _Py_FOR_EACH_TSTATE_END(interp);
 
     process_delayed_frees(interp, state);
+    _PyGC_StatsPhaseDone(state->stats, "merge_refcounts");
 
     #ifdef GC_ENABLE_MARK_ALIVE
     // If gc.freeze() was used, it seems likely that doing this "mark alive"
@@ -1972,6 +2587,7 @@ gc_collect_internal(PyInterpreterState *interp, struct collection_state *state,
             PyErr_NoMemory();
             return;
         }
+        _PyGC_StatsPhaseDone(state->stats, "mark_alive");
     }
     #endif
 
@@ -2009,6 +2625,7 @@ gc_collect_internal(PyInterpreterState *interp, struct collection_state *state,
     // Call weakref callbacks and finalizers after unpausing other threads to
     // avoid potential deadlocks.
     call_weakref_callbacks(state);
+    _PyGC_StatsPhaseDone(state->stats, "weakrefs");
     finalize_garbage(state);
 
     // Handle any objects that may have resurrected after the finalization.
@@ -2026,6 +2643,15 @@ gc_collect_internal(PyInterpreterState *interp, struct collection_state *state,
         PyErr_NoMemory();
         return;
     }
+    if (state->gcstate->debug & _PyGC_DEBUG_TYPE_STATS) {
+        PyObject *op;
+        WORKSTACK_FOR_EACH(&state->unreachable, op) {
+            _PyGC_StatsCountType(state->stats, &state->stats->collected_types,
+                                 op);
+        }
+        _PyGC_StatsNameTypes(state->stats);
+    }
+    _PyGC_StatsPhaseDone(state->stats, "finalize");
 
     // Call tp_clear on objects in the unreachable set. This will cause
     // the reference cycles to be broken. It may also cause some objects
@@ -2034,6 +2660,7 @@ gc_collect_internal(PyInterpreterState *interp, struct collection_state *state,
 
     // Append objects with legacy finalizers to the "gc.garbage" list.
     handle_legacy_finalizers(state);
+    _PyGC_StatsPhaseDone(state->stats, "delete");
 }
 
 /* This is the main function.  Read this to understand how the
@@ -2072,8 +2699,9 @@ gc_collect_main(PyThreadState *tstate, int generation, _PyGC_Reason reason)
 #endif
     GC_STAT_ADD(generation, collections, 1);
 
+    struct gc_collection_stats gc_stats = { 0 };
     if (reason != _Py_GC_REASON_SHUTDOWN) {
-        invoke_gc_callback(tstate, "start", generation, 0, 0);
+        invoke_gc_callback(tstate, "start", generation, &gc_stats);
     }
 
     if (gcstate->debug & _PyGC_DEBUG_STATS) {
@@ -2093,12 +2721,17 @@ gc_collect_main(PyThreadState *tstate, int generation, _PyGC_Reason reason)
         .interp = interp,
         .gcstate = gcstate,
         .reason = reason,
+        .stats = &gc_stats,
     };
 
+    _PyGC_StatsStart(&gc_stats);
     gc_collect_internal(interp, &state, generation);
+    _PyGC_StatsDone(&gc_stats);
 
     m = state.collected;
     n = state.uncollectable;
+    gc_stats.collected = m;
+    gc_stats.uncollectable = n;
 
     if (gcstate->debug & _PyGC_DEBUG_STATS) {
         PyTime_t t2;
@@ -2142,8 +2775,9 @@ gc_collect_main(PyThreadState *tstate, int generation, _PyGC_Reason reason)
     }
 
     if (reason != _Py_GC_REASON_SHUTDOWN) {
-        invoke_gc_callback(tstate, "stop", generation, m, n);
+        invoke_gc_callback(tstate, "stop", generation, &gc_stats);
     }
+    _PyGC_StatsClear(&gc_stats);
 
     assert(!_PyErr_Occurred(tstate));
     _Py_atomic_store_int(&gcstate->collecting, 0);
@@ -2305,6 +2939,76 @@ _PyGC_Freeze(PyInterpreterState *interp)
     _PyEval_StartTheWorld(interp);
 }
 
+struct immortalize_args {
+    struct visitor_args base;
+    _PyObjectStack stack;
+};
+
+static int
+visit_immortalize_referent(PyObject *op, void *arg)
+{
+    _PyObjectStack *stack = (_PyObjectStack *)arg;
+    // Strings can only be made immortal by interning them, which could
+    // replace the object, so they are left mortal.  Objects queued for a
+    // refcount merge are left alone so that the owning thread's merge
+    // does not clobber the immortal refcount.
+    if (_Py_IsImmortal(op) || PyUnicode_CheckExact(op) ||
+        _Py_REF_IS_QUEUED(_Py_atomic_load_ssize_relaxed(&op->ob_ref_shared)))
+    {
+        return 0;
+    }
+    if (_PyObject_IS_GC(op)) {
+        if (_PyObject_GC_IS_TRACKED(op)) {
+            // Handled by visit_immortalize() when the heap walk reaches it.
+            return 0;
+        }
+        // Untracked containers can still refer to other objects.
+        if (_PyObjectStack_Push(stack, op) < 0) {
+            return -1;
+        }
+    }
+    _Py_SetImmortalUntracked(op);
+    return 0;
+}
+
+static bool
+visit_immortalize(const mi_heap_t *heap, const mi_heap_area_t *area,
+                  void *block, size_t block_size, void *args)
+{
+    PyObject *op = op_from_block(block, args, true);
+    if (op == NULL || !gc_is_frozen(op) || gc_is_unreachable(op) ||
+        _Py_REF_IS_QUEUED(_Py_atomic_load_ssize_relaxed(&op->ob_ref_shared)))
+    {
+        return true;
+    }
+    _PyObjectStack *stack = &((struct immortalize_args *)args)->stack;
+    PyObject *child = op;
+    do {
+        traverseproc traverse = Py_TYPE(child)->tp_traverse;
+        if (traverse(child, visit_immortalize_referent, stack) < 0) {
+            return false;
+        }
+    } while ((child = _PyObjectStack_Pop(stack)) != NULL);
+    gc_clear_bit(op, _PyGC_BITS_FROZEN);
+    _Py_SetImmortal(op);
+    return true;
+}
+
+int
+_PyGC_Immortalize(PyInterpreterState *interp)
+{
+    struct immortalize_args args = { 0 };
+    _PyEval_StopTheWorld(interp);
+    int err = gc_visit_heaps(interp, &visit_immortalize, &args.base);
+    _PyEval_StartTheWorld(interp);
+    _PyObjectStack_Clear(&args.stack);
+    if (err < 0) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    return 0;
+}
+
 static bool
 visit_unfreeze(const mi_heap_t *heap, const mi_heap_area_t *area,
                void *block, size_t block_size, void *args)
@@ -2462,6 +3166,7 @@ _PyGC_Fini(PyInterpreterState *interp)
     GCState *gcstate = &interp->gc;
     Py_CLEAR(gcstate->garbage);
     Py_CLEAR(gcstate->callbacks);
+    gc_mark_pool_stop(interp);
 
     /* We expect that none of this interpreters objects are shared
        with other interpreters.
@@ -820,20 +820,28 @@
                     JUMP_TO_PREDICTED(BINARY_OP);
                 }
                 Py_UCS4 c = PyUnicode_READ_CHAR(str, index);
-                if (Py_ARRAY_LENGTH(_Py_SINGLETON(strings).ascii) <= c) {
-                    UPDATE_MISS_STATS(BINARY_OP);
-                    assert(_PyOpcode_Deopt[opcode] == (BINARY_OP));
-                    JUMP_TO_PREDICTED(BINARY_OP);
-                }
                 STAT_INC(BINARY_OP, hit);
-                PyObject *res_o = (PyObject*)&_Py_SINGLETON(strings).ascii[c];
+                PyObject *res_o;
+                if (c < 256) {
+                    _PyFrame_SetStackPointer(frame, stack_pointer);
+                    res_o = (PyObject *)_Py_LATIN1_CHR(c);
+                    stack_pointer = _PyFrame_GetStackPointer(frame);
+                }
+                else {
+                    _PyFrame_SetStackPointer(frame, stack_pointer);
+                    res_o = PyUnicode_FromOrdinal(c);
+                    stack_pointer = _PyFrame_GetStackPointer(frame);
+                }
                 PyStackRef_CLOSE_SPECIALIZED(sub_st, _PyLong_ExactDealloc);
                 stack_pointer += -2;
                 assert(WITHIN_STACK_BOUNDS());
                 _PyFrame_SetStackPointer(frame, stack_pointer);
                 PyStackRef_CLOSE(str_st);
                 stack_pointer = _PyFrame_GetStackPointer(frame);
-                res = PyStackRef_FromPyObjectImmortal(res_o);
+                if (res_o == NULL) {
+                    JUMP_TO_LABEL(error);
+                }
+                res = PyStackRef_FromPyObjectSteal(res_o);
             }
             stack_pointer[0] = res;
             stack_pointer += 1;
@@ -1055,24 +1063,36 @@
                 stop = stack_pointer[-1];
                 start = stack_pointer[-2];
                 container = stack_pointer[-3];
+                PyObject *start_o = PyStackRef_AsPyObjectSteal(start);
+                PyObject *stop_o = PyStackRef_AsPyObjectSteal(stop);
+                PyObject *res_o;
+                stack_pointer += -2;
+                assert(WITHIN_STACK_BOUNDS());
                 _PyFrame_SetStackPointer(frame, stack_pointer);
-                PyObject *slice = _PyBuildSlice_ConsumeRefs(PyStackRef_AsPyObjectSteal(start),
-                    PyStackRef_AsPyObjectSteal(stop));
+                int handled = _PyEval_SliceSequence(PyStackRef_AsPyObjectBorrow(container),
+                    start_o, stop_o, &res_o);
                 stack_pointer = _PyFrame_GetStackPointer(frame);
-                PyObject *res_o;
-                if (slice == NULL) {
-                    res_o = NULL;
+                if (handled) {
+                    _PyFrame_SetStackPointer(frame, stack_pointer);
+                    Py_DECREF(start_o);
+                    Py_DECREF(stop_o);
+                    stack_pointer = _PyFrame_GetStackPointer(frame);
                 }
                 else {
-                    stack_pointer += -2;
-                    assert(WITHIN_STACK_BOUNDS());
                     _PyFrame_SetStackPointer(frame, stack_pointer);
-                    res_o = PyObject_GetItem(PyStackRef_AsPyObjectBorrow(container), slice);
-                    Py_DECREF(slice);
+                    PyObject *slice = _PyBuildSlice_ConsumeRefs(start_o, stop_o);
                     stack_pointer = _PyFrame_GetStackPointer(frame);
-                    stack_pointer += 2;
+                    if (slice == NULL) {
+                        res_o = NULL;
+                    }
+                    else {
+                        _PyFrame_SetStackPointer(frame, stack_pointer);
+                        res_o = PyObject_GetItem(PyStackRef_AsPyObjectBorrow(container), slice);
+                        Py_DECREF(slice);
+                        stack_pointer = _PyFrame_GetStackPointer(frame);
+                    }
                 }
-                stack_pointer += -3;
+                stack_pointer += -1;
                 assert(WITHIN_STACK_BOUNDS());
                 _PyFrame_SetStackPointer(frame, stack_pointer);
                 PyStackRef_CLOSE(container);
@@ -2317,6 +2337,112 @@
             DISPATCH();
         }
 
+        TARGET(CALL_DUNDER_CALL) {
+            #if Py_TAIL_CALL_INTERP
+            int opcode = CALL_DUNDER_CALL;
+            (void)(opcode);
+            #endif
+            _Py_CODEUNIT* const this_instr = next_instr;
+            (void)this_instr;
+            frame->instr_ptr = next_instr;
+            next_instr += 4;
+            INSTRUCTION_STATS(CALL_DUNDER_CALL);
+            static_assert(INLINE_CACHE_ENTRIES_CALL == 3, "incorrect cache size");
+            _PyStackRef *callable;
+            _PyStackRef *null;
+            _PyStackRef *self_or_null;
+            _PyStackRef *args;
+            _PyInterpreterFrame *new_frame;
+            /* Skip 1 cache entry */
+            // _CHECK_PEP_523
+            {
+                if (tstate->interp->eval_frame) {
+                    UPDATE_MISS_STATS(CALL);
+                    assert(_PyOpcode_Deopt[opcode] == (CALL));
+                    JUMP_TO_PREDICTED(CALL);
+                }
+            }
+            // _CHECK_DUNDER_CALL
+            {
+                null = &stack_pointer[-1 - oparg];
+                callable = &stack_pointer[-2 - oparg];
+                uint32_t type_version = read_u32(&this_instr[2].cache);
+                PyTypeObject *tp = PyStackRef_TYPE(callable[0]);
+                if (FT_ATOMIC_LOAD_UINT32_RELAXED(tp->tp_version_tag) != type_version) {
+                    UPDATE_MISS_STATS(CALL);
+                    assert(_PyOpcode_Deopt[opcode] == (CALL));
+                    JUMP_TO_PREDICTED(CALL);
+                }
+                if (!PyStackRef_IsNull(null[0])) {
+                    UPDATE_MISS_STATS(CALL);
+                    assert(_PyOpcode_Deopt[opcode] == (CALL));
+                    JUMP_TO_PREDICTED(CALL);
+                }
+                assert(tp->tp_flags & Py_TPFLAGS_HEAPTYPE);
+                assert(tp->tp_call == _Py_slot_tp_call);
+            }
+            // _EXPAND_DUNDER_CALL
+            {
+                self_or_null = null;
+                assert(PyStackRef_IsNull(self_or_null[0]));
+                PyHeapTypeObject *cls = (PyHeapTypeObject *)PyStackRef_TYPE(callable[0]);
+                PyObject *call = FT_ATOMIC_LOAD_PTR_ACQUIRE(cls->_spec_cache.call);
+                assert(PyFunction_Check(call));
+                STAT_INC(CALL, hit);
+                self_or_null[0] = callable[0];
+                callable[0] = PyStackRef_FromPyObjectNew(call);
+            }
+            // flush
+            // _PY_FRAME_GENERAL
+            {
+                args = &stack_pointer[-oparg];
+                PyObject *callable_o = PyStackRef_AsPyObjectBorrow(callable[0]);
+                int total_args = oparg;
+                if (!PyStackRef_IsNull(self_or_null[0])) {
+                    args--;
+                    total_args++;
+                }
+                assert(Py_TYPE(callable_o) == &PyFunction_Type);
+                int code_flags = ((PyCodeObject*)PyFunction_GET_CODE(callable_o))->co_flags;
+                PyObject *locals = code_flags & CO_OPTIMIZED ? NULL : Py_NewRef(PyFunction_GET_GLOBALS(callable_o));
+                _PyFrame_SetStackPointer(frame, stack_pointer);
+                _PyInterpreterFrame *temp = _PyEvalFramePushAndInit(
+                    tstate, callable[0], locals,
+                    args, total_args, NULL, frame
+                );
+                stack_pointer = _PyFrame_GetStackPointer(frame);
+                stack_pointer += -2 - oparg;
+                assert(WITHIN_STACK_BOUNDS());
+                if (temp == NULL) {
+                    JUMP_TO_LABEL(error);
+                }
+                new_frame = temp;
+            }
+            // _SAVE_RETURN_OFFSET
+            {
+                #if TIER_ONE
+                frame->return_offset = (uint16_t)(next_instr - this_instr);
+                #endif
+                #if TIER_TWO
+                frame->return_offset = oparg;
+                #endif
+            }
+            // _PUSH_FRAME
+            {
+                assert(tstate->interp->eval_frame == NULL);
+                _PyInterpreterFrame *temp = new_frame;
+                _PyFrame_SetStackPointer(frame, stack_pointer);
+                assert(new_frame->previous == frame || new_frame->previous->previous == frame);
+                CALL_STAT_INC(inlined_py_calls);
+                frame = tstate->current_frame = temp;
+                tstate->py_recursion_remaining--;
+                LOAD_SP();
+                LOAD_IP(0);
+                LLTRACE_RESUME_FRAME();
+            }
+            DISPATCH();
+        }
+
         TARGET(CALL_FUNCTION_EX) {
             #if Py_TAIL_CALL_INTERP
             int opcode = CALL_FUNCTION_EX;
@@ -4571,6 +4697,66 @@
             DISPATCH();
         }
 
+        TARGET(COMPARE_OP_FLOAT_INT) {
+            #if Py_TAIL_CALL_INTERP
+            int opcode = COMPARE_OP_FLOAT_INT;
+            (void)(opcode);
+            #endif
+            _Py_CODEUNIT* const this_instr = next_instr;
+            (void)this_instr;
+            frame->instr_ptr = next_instr;
+            next_instr += 2;
+            INSTRUCTION_STATS(COMPARE_OP_FLOAT_INT);
+            static_assert(INLINE_CACHE_ENTRIES_COMPARE_OP == 1, "incorrect cache size");
+            _PyStackRef value;
+            _PyStackRef left;
+            _PyStackRef right;
+            _PyStackRef res;
+            // _GUARD_TOS_INT
+            {
+                value = stack_pointer[-1];
+                PyObject *value_o = PyStackRef_AsPyObjectBorrow(value);
+                if (!PyLong_CheckExact(value_o)) {
+                    UPDATE_MISS_STATS(COMPARE_OP);
+                    assert(_PyOpcode_Deopt[opcode] == (COMPARE_OP));
+                    JUMP_TO_PREDICTED(COMPARE_OP);
+                }
+            }
+            // _GUARD_NOS_FLOAT
+            {
+                left = stack_pointer[-2];
+                PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+                if (!PyFloat_CheckExact(left_o)) {
+                    UPDATE_MISS_STATS(COMPARE_OP);
+                    assert(_PyOpcode_Deopt[opcode] == (COMPARE_OP));
+                    JUMP_TO_PREDICTED(COMPARE_OP);
+                }
+            }
+            /* Skip 1 cache entry */
+            // _COMPARE_OP_FLOAT_INT
+            {
+                right = value;
+                PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+                PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+                if (!_PyLong_IsCompact((PyLongObject *)right_o)) {
+                    UPDATE_MISS_STATS(COMPARE_OP);
+                    assert(_PyOpcode_Deopt[opcode] == (COMPARE_OP));
+                    JUMP_TO_PREDICTED(COMPARE_OP);
+                }
+                STAT_INC(COMPARE_OP, hit);
+                double dleft = PyFloat_AS_DOUBLE(left_o);
+                double dright = (double)_PyLong_CompactValue((PyLongObject *)right_o);
+                int sign_ish = COMPARISON_BIT(dleft, dright);
+                PyStackRef_CLOSE_SPECIALIZED(left, _PyFloat_ExactDealloc);
+                PyStackRef_CLOSE_SPECIALIZED(right, _PyLong_ExactDealloc);
+                res = (sign_ish & oparg) ? PyStackRef_True : PyStackRef_False;
+            }
+            stack_pointer[-2] = res;
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            DISPATCH();
+        }
+
         TARGET(COMPARE_OP_INT) {
             #if Py_TAIL_CALL_INTERP
             int opcode = COMPARE_OP_INT;
@@ -4638,6 +4824,66 @@
             DISPATCH();
         }
 
+        TARGET(COMPARE_OP_INT_FLOAT) {
+            #if Py_TAIL_CALL_INTERP
+            int opcode = COMPARE_OP_INT_FLOAT;
+            (void)(opcode);
+            #endif
+            _Py_CODEUNIT* const this_instr = next_instr;
+            (void)this_instr;
+            frame->instr_ptr = next_instr;
+            next_instr += 2;
+            INSTRUCTION_STATS(COMPARE_OP_INT_FLOAT);
+            static_assert(INLINE_CACHE_ENTRIES_COMPARE_OP == 1, "incorrect cache size");
+            _PyStackRef value;
+            _PyStackRef left;
+            _PyStackRef right;
+            _PyStackRef res;
+            // _GUARD_TOS_FLOAT
+            {
+                value = stack_pointer[-1];
+                PyObject *value_o = PyStackRef_AsPyObjectBorrow(value);
+                if (!PyFloat_CheckExact(value_o)) {
+                    UPDATE_MISS_STATS(COMPARE_OP);
+                    assert(_PyOpcode_Deopt[opcode] == (COMPARE_OP));
+                    JUMP_TO_PREDICTED(COMPARE_OP);
+                }
+            }
+            // _GUARD_NOS_INT
+            {
+                left = stack_pointer[-2];
+                PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+                if (!PyLong_CheckExact(left_o)) {
+                    UPDATE_MISS_STATS(COMPARE_OP);
+                    assert(_PyOpcode_Deopt[opcode] == (COMPARE_OP));
+                    JUMP_TO_PREDICTED(COMPARE_OP);
+                }
+            }
+            /* Skip 1 cache entry */
+            // _COMPARE_OP_INT_FLOAT
+            {
+                right = value;
+                PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+                PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+                if (!_PyLong_IsCompact((PyLongObject *)left_o)) {
+                    UPDATE_MISS_STATS(COMPARE_OP);
+                    assert(_PyOpcode_Deopt[opcode] == (COMPARE_OP));
+                    JUMP_TO_PREDICTED(COMPARE_OP);
+                }
+                STAT_INC(COMPARE_OP, hit);
+                double dleft = (double)_PyLong_CompactValue((PyLongObject *)left_o);
+                double dright = PyFloat_AS_DOUBLE(right_o);
+                int sign_ish = COMPARISON_BIT(dleft, dright);
+                PyStackRef_CLOSE_SPECIALIZED(left, _PyLong_ExactDealloc);
+                PyStackRef_CLOSE_SPECIALIZED(right, _PyFloat_ExactDealloc);
+                res = (sign_ish & oparg) ? PyStackRef_True : PyStackRef_False;
+            }
+            stack_pointer[-2] = res;
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            DISPATCH();
+        }
+
         TARGET(COMPARE_OP_STR) {
             #if Py_TAIL_CALL_INTERP
             int opcode = COMPARE_OP_STR;
@@ -4708,19 +4954,20 @@
             PREDICTED_CONTAINS_OP:;
             _Py_CODEUNIT* const this_instr = next_instr - 2;
             (void)this_instr;
-            _PyStackRef right;
             _PyStackRef left;
+            _PyStackRef right;
             _PyStackRef b;
             // _SPECIALIZE_CONTAINS_OP
             {
                 right = stack_pointer[-1];
+                left = stack_pointer[-2];
                 uint16_t counter = read_u16(&this_instr[1].cache);
                 (void)counter;
                 #if ENABLE_SPECIALIZATION_FT
                 if (ADAPTIVE_COUNTER_TRIGGERS(counter)) {
                     next_instr = this_instr;
                     _PyFrame_SetStackPointer(frame, stack_pointer);
-                    _Py_Specialize_ContainsOp(right, next_instr);
+                    _Py_Specialize_ContainsOp(left, right, next_instr);
                     stack_pointer = _PyFrame_GetStackPointer(frame);
                     DISPATCH_SAME_OPARG();
                 }
@@ -4730,7 +4977,6 @@
             }
             // _CONTAINS_OP
             {
-                left = stack_pointer[-2];
                 PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
                 PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
                 _PyFrame_SetStackPointer(frame, stack_pointer);
@@ -4873,20 +5119,104 @@
             DISPATCH();
         }
 
-        TARGET(CONVERT_VALUE) {
+        TARGET(CONTAINS_OP_STR_TUPLE) {
             #if Py_TAIL_CALL_INTERP
-            int opcode = CONVERT_VALUE;
+            int opcode = CONTAINS_OP_STR_TUPLE;
             (void)(opcode);
             #endif
+            _Py_CODEUNIT* const this_instr = next_instr;
+            (void)this_instr;
             frame->instr_ptr = next_instr;
-            next_instr += 1;
-            INSTRUCTION_STATS(CONVERT_VALUE);
-            _PyStackRef value;
-            _PyStackRef result;
-            value = stack_pointer[-1];
-            conversion_func conv_fn;
-            assert(oparg >= FVC_STR && oparg <= FVC_ASCII);
-            conv_fn = _PyEval_ConversionFuncs[oparg];
+            next_instr += 2;
+            INSTRUCTION_STATS(CONTAINS_OP_STR_TUPLE);
+            static_assert(INLINE_CACHE_ENTRIES_CONTAINS_OP == 1, "incorrect cache size");
+            _PyStackRef tos;
+            _PyStackRef nos;
+            _PyStackRef left;
+            _PyStackRef right;
+            _PyStackRef b;
+            // _GUARD_TOS_TUPLE
+            {
+                tos = stack_pointer[-1];
+                PyObject *o = PyStackRef_AsPyObjectBorrow(tos);
+                if (!PyTuple_CheckExact(o)) {
+                    UPDATE_MISS_STATS(CONTAINS_OP);
+                    assert(_PyOpcode_Deopt[opcode] == (CONTAINS_OP));
+                    JUMP_TO_PREDICTED(CONTAINS_OP);
+                }
+            }
+            // _GUARD_NOS_UNICODE
+            {
+                nos = stack_pointer[-2];
+                PyObject *o = PyStackRef_AsPyObjectBorrow(nos);
+                if (!PyUnicode_CheckExact(o)) {
+                    UPDATE_MISS_STATS(CONTAINS_OP);
+                    assert(_PyOpcode_Deopt[opcode] == (CONTAINS_OP));
+                    JUMP_TO_PREDICTED(CONTAINS_OP);
+                }
+            }
+            /* Skip 1 cache entry */
+            // _CONTAINS_OP_STR_TUPLE
+            {
+                right = tos;
+                left = nos;
+                PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+                PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+                assert(PyUnicode_CheckExact(left_o));
+                assert(PyTuple_CheckExact(right_o));
+                int res = 0;
+                Py_ssize_t n = PyTuple_GET_SIZE(right_o);
+                for (Py_ssize_t i = 0; i < n; i++) {
+                    PyObject *item = PyTuple_GET_ITEM(right_o, i);
+                    if (item == left_o) {
+                        res = 1;
+                        break;
+                    }
+                    if (!PyUnicode_CheckExact(item)) {
+                        UPDATE_MISS_STATS(CONTAINS_OP);
+                        assert(_PyOpcode_Deopt[opcode] == (CONTAINS_OP));
+                        JUMP_TO_PREDICTED(CONTAINS_OP);
+                    }
+                    if (_PyUnicode_Equal(item, left_o)) {
+                        res = 1;
+                        break;
+                    }
+                }
+                STAT_INC(CONTAINS_OP, hit);
+                _PyFrame_SetStackPointer(frame, stack_pointer);
+                _PyStackRef tmp = right;
+                right = PyStackRef_NULL;
+                stack_pointer[-1] = right;
+                PyStackRef_CLOSE(tmp);
+                tmp = left;
+                left = PyStackRef_NULL;
+                stack_pointer[-2] = left;
+                PyStackRef_CLOSE(tmp);
+                stack_pointer = _PyFrame_GetStackPointer(frame);
+                stack_pointer += -2;
+                assert(WITHIN_STACK_BOUNDS());
+                b = (res ^ oparg) ? PyStackRef_True : PyStackRef_False;
+            }
+            stack_pointer[0] = b;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            DISPATCH();
+        }
+
+        TARGET(CONVERT_VALUE) {
+            #if Py_TAIL_CALL_INTERP
+            int opcode = CONVERT_VALUE;
+            (void)(opcode);
+            #endif
+            frame->instr_ptr = next_instr;
+            next_instr += 1;
+            INSTRUCTION_STATS(CONVERT_VALUE);
+            _PyStackRef value;
+            _PyStackRef result;
+            value = stack_pointer[-1];
+            conversion_func conv_fn;
+            assert(oparg >= FVC_STR && oparg <= FVC_ASCII);
+            conv_fn = _PyEval_ConversionFuncs[oparg];
             _PyFrame_SetStackPointer(frame, stack_pointer);
             PyObject *result_o = conv_fn(PyStackRef_AsPyObjectBorrow(value));
             stack_pointer = _PyFrame_GetStackPointer(frame);
@@ -5293,7 +5623,9 @@
             assert(executor->vm_data.code == code);
             assert(executor->vm_data.valid);
             assert(tstate->previous_executor == NULL);
-            if (_Py_atomic_load_uintptr_relaxed(&tstate->eval_breaker) & _PY_EVAL_EVENTS_MASK) {
+            if ((_Py_atomic_load_uintptr_relaxed(&tstate->eval_breaker) & _PY_EVAL_EVENTS_MASK) ||
+                !_PyExecutor_IsReady(executor))
+            {
                 opcode = executor->vm_data.opcode;
                 oparg = (oparg & ~255) | executor->vm_data.oparg;
                 next_instr = this_instr;
@@ -5356,15 +5688,89 @@
             (void)(opcode);
             #endif
             frame->instr_ptr = next_instr;
-            next_instr += 1;
+            next_instr += 2;
             INSTRUCTION_STATS(FORMAT_SIMPLE);
+            PREDICTED_FORMAT_SIMPLE:;
+            _Py_CODEUNIT* const this_instr = next_instr - 2;
+            (void)this_instr;
             _PyStackRef value;
             _PyStackRef res;
-            value = stack_pointer[-1];
-            PyObject *value_o = PyStackRef_AsPyObjectBorrow(value);
-            if (!PyUnicode_CheckExact(value_o)) {
+            // _SPECIALIZE_FORMAT_SIMPLE
+            {
+                value = stack_pointer[-1];
+                uint16_t counter = read_u16(&this_instr[1].cache);
+                (void)counter;
+                #if ENABLE_SPECIALIZATION_FT
+                if (ADAPTIVE_COUNTER_TRIGGERS(counter)) {
+                    next_instr = this_instr;
+                    _PyFrame_SetStackPointer(frame, stack_pointer);
+                    _Py_Specialize_FormatSimple(value, next_instr);
+                    stack_pointer = _PyFrame_GetStackPointer(frame);
+                    DISPATCH_SAME_OPARG();
+                }
+                OPCODE_DEFERRED_INC(FORMAT_SIMPLE);
+                ADVANCE_ADAPTIVE_COUNTER(this_instr[1].counter);
+                #endif  /* ENABLE_SPECIALIZATION_FT */
+            }
+            // _FORMAT_SIMPLE
+            {
+                PyObject *value_o = PyStackRef_AsPyObjectBorrow(value);
+                if (!PyUnicode_CheckExact(value_o)) {
+                    _PyFrame_SetStackPointer(frame, stack_pointer);
+                    PyObject *res_o = PyObject_Format(value_o, NULL);
+                    stack_pointer = _PyFrame_GetStackPointer(frame);
+                    stack_pointer += -1;
+                    assert(WITHIN_STACK_BOUNDS());
+                    _PyFrame_SetStackPointer(frame, stack_pointer);
+                    PyStackRef_CLOSE(value);
+                    stack_pointer = _PyFrame_GetStackPointer(frame);
+                    if (res_o == NULL) {
+                        JUMP_TO_LABEL(error);
+                    }
+                    res = PyStackRef_FromPyObjectSteal(res_o);
+                }
+                else {
+                    res = value;
+                    stack_pointer += -1;
+                }
+            }
+            stack_pointer[0] = res;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            DISPATCH();
+        }
+
+        TARGET(FORMAT_SIMPLE_FLOAT) {
+            #if Py_TAIL_CALL_INTERP
+            int opcode = FORMAT_SIMPLE_FLOAT;
+            (void)(opcode);
+            #endif
+            _Py_CODEUNIT* const this_instr = next_instr;
+            (void)this_instr;
+            frame->instr_ptr = next_instr;
+            next_instr += 2;
+            INSTRUCTION_STATS(FORMAT_SIMPLE_FLOAT);
+            static_assert(INLINE_CACHE_ENTRIES_FORMAT_SIMPLE == 1, "incorrect cache size");
+            _PyStackRef value;
+            _PyStackRef res;
+            // _GUARD_TOS_FLOAT
+            {
+                value = stack_pointer[-1];
+                PyObject *value_o = PyStackRef_AsPyObjectBorrow(value);
+                if (!PyFloat_CheckExact(value_o)) {
+                    UPDATE_MISS_STATS(FORMAT_SIMPLE);
+                    assert(_PyOpcode_Deopt[opcode] == (FORMAT_SIMPLE));
+                    JUMP_TO_PREDICTED(FORMAT_SIMPLE);
+                }
+            }
+            /* Skip 1 cache entry */
+            // _FORMAT_SIMPLE_FLOAT
+            {
+                PyObject *value_o = PyStackRef_AsPyObjectBorrow(value);
+                assert(PyFloat_CheckExact(value_o));
+                STAT_INC(FORMAT_SIMPLE, hit);
                 _PyFrame_SetStackPointer(frame, stack_pointer);
-                PyObject *res_o = PyObject_Format(value_o, NULL);
+                PyObject *res_o = PyFloat_Type.tp_repr(value_o);
                 stack_pointer = _PyFrame_GetStackPointer(frame);
                 stack_pointer += -1;
                 assert(WITHIN_STACK_BOUNDS());
@@ -5376,9 +5782,53 @@
                 }
                 res = PyStackRef_FromPyObjectSteal(res_o);
             }
-            else {
-                res = value;
+            stack_pointer[0] = res;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            DISPATCH();
+        }
+
+        TARGET(FORMAT_SIMPLE_INT) {
+            #if Py_TAIL_CALL_INTERP
+            int opcode = FORMAT_SIMPLE_INT;
+            (void)(opcode);
+            #endif
+            _Py_CODEUNIT* const this_instr = next_instr;
+            (void)this_instr;
+            frame->instr_ptr = next_instr;
+            next_instr += 2;
+            INSTRUCTION_STATS(FORMAT_SIMPLE_INT);
+            static_assert(INLINE_CACHE_ENTRIES_FORMAT_SIMPLE == 1, "incorrect cache size");
+            _PyStackRef value;
+            _PyStackRef res;
+            // _GUARD_TOS_INT
+            {
+                value = stack_pointer[-1];
+                PyObject *value_o = PyStackRef_AsPyObjectBorrow(value);
+                if (!PyLong_CheckExact(value_o)) {
+                    UPDATE_MISS_STATS(FORMAT_SIMPLE);
+                    assert(_PyOpcode_Deopt[opcode] == (FORMAT_SIMPLE));
+                    JUMP_TO_PREDICTED(FORMAT_SIMPLE);
+                }
+            }
+            /* Skip 1 cache entry */
+            // _FORMAT_SIMPLE_INT
+            {
+                PyObject *value_o = PyStackRef_AsPyObjectBorrow(value);
+                assert(PyLong_CheckExact(value_o));
+                STAT_INC(FORMAT_SIMPLE, hit);
+                _PyFrame_SetStackPointer(frame, stack_pointer);
+                PyObject *res_o = _PyLong_Format(value_o, 10);
+                stack_pointer = _PyFrame_GetStackPointer(frame);
                 stack_pointer += -1;
+                assert(WITHIN_STACK_BOUNDS());
+                _PyFrame_SetStackPointer(frame, stack_pointer);
+                PyStackRef_CLOSE(value);
+                stack_pointer = _PyFrame_GetStackPointer(frame);
+                if (res_o == NULL) {
+                    JUMP_TO_LABEL(error);
+                }
+                res = PyStackRef_FromPyObjectSteal(res_o);
             }
             stack_pointer[0] = res;
             stack_pointer += 1;
@@ -5386,36 +5836,272 @@
             DISPATCH();
         }
 
+        TARGET(FORMAT_SIMPLE_STR) {
+            #if Py_TAIL_CALL_INTERP
+            int opcode = FORMAT_SIMPLE_STR;
+            (void)(opcode);
+            #endif
+            _Py_CODEUNIT* const this_instr = next_instr;
+            (void)this_instr;
+            frame->instr_ptr = next_instr;
+            next_instr += 2;
+            INSTRUCTION_STATS(FORMAT_SIMPLE_STR);
+            static_assert(INLINE_CACHE_ENTRIES_FORMAT_SIMPLE == 1, "incorrect cache size");
+            _PyStackRef value;
+            _PyStackRef res;
+            // _GUARD_TOS_UNICODE
+            {
+                value = stack_pointer[-1];
+                PyObject *value_o = PyStackRef_AsPyObjectBorrow(value);
+                if (!PyUnicode_CheckExact(value_o)) {
+                    UPDATE_MISS_STATS(FORMAT_SIMPLE);
+                    assert(_PyOpcode_Deopt[opcode] == (FORMAT_SIMPLE));
+                    JUMP_TO_PREDICTED(FORMAT_SIMPLE);
+                }
+            }
+            /* Skip 1 cache entry */
+            // _FORMAT_SIMPLE_STR
+            {
+                assert(PyUnicode_CheckExact(PyStackRef_AsPyObjectBorrow(value)));
+                STAT_INC(FORMAT_SIMPLE, hit);
+                res = value;
+            }
+            stack_pointer[-1] = res;
+            DISPATCH();
+        }
+
         TARGET(FORMAT_WITH_SPEC) {
             #if Py_TAIL_CALL_INTERP
             int opcode = FORMAT_WITH_SPEC;
             (void)(opcode);
             #endif
             frame->instr_ptr = next_instr;
-            next_instr += 1;
+            next_instr += 2;
             INSTRUCTION_STATS(FORMAT_WITH_SPEC);
+            PREDICTED_FORMAT_WITH_SPEC:;
+            _Py_CODEUNIT* const this_instr = next_instr - 2;
+            (void)this_instr;
             _PyStackRef value;
             _PyStackRef fmt_spec;
             _PyStackRef res;
-            fmt_spec = stack_pointer[-1];
-            value = stack_pointer[-2];
-            _PyFrame_SetStackPointer(frame, stack_pointer);
-            PyObject *res_o = PyObject_Format(PyStackRef_AsPyObjectBorrow(value), PyStackRef_AsPyObjectBorrow(fmt_spec));
-            _PyStackRef tmp = fmt_spec;
-            fmt_spec = PyStackRef_NULL;
-            stack_pointer[-1] = fmt_spec;
-            PyStackRef_CLOSE(tmp);
-            tmp = value;
-            value = PyStackRef_NULL;
-            stack_pointer[-2] = value;
-            PyStackRef_CLOSE(tmp);
-            stack_pointer = _PyFrame_GetStackPointer(frame);
-            stack_pointer += -2;
+            // _SPECIALIZE_FORMAT_WITH_SPEC
+            {
+                value = stack_pointer[-2];
+                uint16_t counter = read_u16(&this_instr[1].cache);
+                (void)counter;
+                #if ENABLE_SPECIALIZATION_FT
+                if (ADAPTIVE_COUNTER_TRIGGERS(counter)) {
+                    next_instr = this_instr;
+                    _PyFrame_SetStackPointer(frame, stack_pointer);
+                    _Py_Specialize_FormatWithSpec(value, next_instr);
+                    stack_pointer = _PyFrame_GetStackPointer(frame);
+                    DISPATCH_SAME_OPARG();
+                }
+                OPCODE_DEFERRED_INC(FORMAT_WITH_SPEC);
+                ADVANCE_ADAPTIVE_COUNTER(this_instr[1].counter);
+                #endif  /* ENABLE_SPECIALIZATION_FT */
+            }
+            // _FORMAT_WITH_SPEC
+            {
+                fmt_spec = stack_pointer[-1];
+                _PyFrame_SetStackPointer(frame, stack_pointer);
+                PyObject *res_o = PyObject_Format(PyStackRef_AsPyObjectBorrow(value), PyStackRef_AsPyObjectBorrow(fmt_spec));
+                _PyStackRef tmp = fmt_spec;
+                fmt_spec = PyStackRef_NULL;
+                stack_pointer[-1] = fmt_spec;
+                PyStackRef_CLOSE(tmp);
+                tmp = value;
+                value = PyStackRef_NULL;
+                stack_pointer[-2] = value;
+                PyStackRef_CLOSE(tmp);
+                stack_pointer = _PyFrame_GetStackPointer(frame);
+                stack_pointer += -2;
+                assert(WITHIN_STACK_BOUNDS());
+                if (res_o == NULL) {
+                    JUMP_TO_LABEL(error);
+                }
+                res = PyStackRef_FromPyObjectSteal(res_o);
+            }
+            stack_pointer[0] = res;
+            stack_pointer += 1;
             assert(WITHIN_STACK_BOUNDS());
-            if (res_o == NULL) {
-                JUMP_TO_LABEL(error);
+            DISPATCH();
+        }
+
+        TARGET(FORMAT_WITH_SPEC_FLOAT) {
+            #if Py_TAIL_CALL_INTERP
+            int opcode = FORMAT_WITH_SPEC_FLOAT;
+            (void)(opcode);
+            #endif
+            _Py_CODEUNIT* const this_instr = next_instr;
+            (void)this_instr;
+            frame->instr_ptr = next_instr;
+            next_instr += 2;
+            INSTRUCTION_STATS(FORMAT_WITH_SPEC_FLOAT);
+            static_assert(INLINE_CACHE_ENTRIES_FORMAT_WITH_SPEC == 1, "incorrect cache size");
+            _PyStackRef left;
+            _PyStackRef value;
+            _PyStackRef fmt_spec;
+            _PyStackRef res;
+            // _GUARD_NOS_FLOAT
+            {
+                left = stack_pointer[-2];
+                PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+                if (!PyFloat_CheckExact(left_o)) {
+                    UPDATE_MISS_STATS(FORMAT_WITH_SPEC);
+                    assert(_PyOpcode_Deopt[opcode] == (FORMAT_WITH_SPEC));
+                    JUMP_TO_PREDICTED(FORMAT_WITH_SPEC);
+                }
+            }
+            /* Skip 1 cache entry */
+            // _FORMAT_WITH_SPEC_FLOAT
+            {
+                fmt_spec = stack_pointer[-1];
+                value = left;
+                PyObject *value_o = PyStackRef_AsPyObjectBorrow(value);
+                PyObject *spec_o = PyStackRef_AsPyObjectBorrow(fmt_spec);
+                assert(PyFloat_CheckExact(value_o));
+                assert(PyUnicode_Check(spec_o));
+                STAT_INC(FORMAT_WITH_SPEC, hit);
+                _PyFrame_SetStackPointer(frame, stack_pointer);
+                PyObject *res_o = _PyObject_FormatAdvanced(
+                    value_o, spec_o, _PyFloat_FormatAdvancedWriter);
+                _PyStackRef tmp = fmt_spec;
+                fmt_spec = PyStackRef_NULL;
+                stack_pointer[-1] = fmt_spec;
+                PyStackRef_CLOSE(tmp);
+                tmp = value;
+                value = PyStackRef_NULL;
+                stack_pointer[-2] = value;
+                PyStackRef_CLOSE(tmp);
+                stack_pointer = _PyFrame_GetStackPointer(frame);
+                stack_pointer += -2;
+                assert(WITHIN_STACK_BOUNDS());
+                if (res_o == NULL) {
+                    JUMP_TO_LABEL(error);
+                }
+                res = PyStackRef_FromPyObjectSteal(res_o);
+            }
+            stack_pointer[0] = res;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            DISPATCH();
+        }
+
+        TARGET(FORMAT_WITH_SPEC_INT) {
+            #if Py_TAIL_CALL_INTERP
+            int opcode = FORMAT_WITH_SPEC_INT;
+            (void)(opcode);
+            #endif
+            _Py_CODEUNIT* const this_instr = next_instr;
+            (void)this_instr;
+            frame->instr_ptr = next_instr;
+            next_instr += 2;
+            INSTRUCTION_STATS(FORMAT_WITH_SPEC_INT);
+            static_assert(INLINE_CACHE_ENTRIES_FORMAT_WITH_SPEC == 1, "incorrect cache size");
+            _PyStackRef left;
+            _PyStackRef value;
+            _PyStackRef fmt_spec;
+            _PyStackRef res;
+            // _GUARD_NOS_INT
+            {
+                left = stack_pointer[-2];
+                PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+                if (!PyLong_CheckExact(left_o)) {
+                    UPDATE_MISS_STATS(FORMAT_WITH_SPEC);
+                    assert(_PyOpcode_Deopt[opcode] == (FORMAT_WITH_SPEC));
+                    JUMP_TO_PREDICTED(FORMAT_WITH_SPEC);
+                }
+            }
+            /* Skip 1 cache entry */
+            // _FORMAT_WITH_SPEC_INT
+            {
+                fmt_spec = stack_pointer[-1];
+                value = left;
+                PyObject *value_o = PyStackRef_AsPyObjectBorrow(value);
+                PyObject *spec_o = PyStackRef_AsPyObjectBorrow(fmt_spec);
+                assert(PyLong_CheckExact(value_o));
+                assert(PyUnicode_Check(spec_o));
+                STAT_INC(FORMAT_WITH_SPEC, hit);
+                _PyFrame_SetStackPointer(frame, stack_pointer);
+                PyObject *res_o = _PyObject_FormatAdvanced(
+                    value_o, spec_o, _PyLong_FormatAdvancedWriter);
+                _PyStackRef tmp = fmt_spec;
+                fmt_spec = PyStackRef_NULL;
+                stack_pointer[-1] = fmt_spec;
+                PyStackRef_CLOSE(tmp);
+                tmp = value;
+                value = PyStackRef_NULL;
+                stack_pointer[-2] = value;
+                PyStackRef_CLOSE(tmp);
+                stack_pointer = _PyFrame_GetStackPointer(frame);
+                stack_pointer += -2;
+                assert(WITHIN_STACK_BOUNDS());
+                if (res_o == NULL) {
+                    JUMP_TO_LABEL(error);
+                }
+                res = PyStackRef_FromPyObjectSteal(res_o);
+            }
+            stack_pointer[0] = res;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            DISPATCH();
+        }
+
+        TARGET(FORMAT_WITH_SPEC_STR) {
+            #if Py_TAIL_CALL_INTERP
+            int opcode = FORMAT_WITH_SPEC_STR;
+            (void)(opcode);
+            #endif
+            _Py_CODEUNIT* const this_instr = next_instr;
+            (void)this_instr;
+            frame->instr_ptr = next_instr;
+            next_instr += 2;
+            INSTRUCTION_STATS(FORMAT_WITH_SPEC_STR);
+            static_assert(INLINE_CACHE_ENTRIES_FORMAT_WITH_SPEC == 1, "incorrect cache size");
+            _PyStackRef nos;
+            _PyStackRef value;
+            _PyStackRef fmt_spec;
+            _PyStackRef res;
+            // _GUARD_NOS_UNICODE
+            {
+                nos = stack_pointer[-2];
+                PyObject *o = PyStackRef_AsPyObjectBorrow(nos);
+                if (!PyUnicode_CheckExact(o)) {
+                    UPDATE_MISS_STATS(FORMAT_WITH_SPEC);
+                    assert(_PyOpcode_Deopt[opcode] == (FORMAT_WITH_SPEC));
+                    JUMP_TO_PREDICTED(FORMAT_WITH_SPEC);
+                }
+            }
+            /* Skip 1 cache entry */
+            // _FORMAT_WITH_SPEC_STR
+            {
+                fmt_spec = stack_pointer[-1];
+                value = nos;
+                PyObject *value_o = PyStackRef_AsPyObjectBorrow(value);
+                PyObject *spec_o = PyStackRef_AsPyObjectBorrow(fmt_spec);
+                assert(PyUnicode_CheckExact(value_o));
+                assert(PyUnicode_Check(spec_o));
+                STAT_INC(FORMAT_WITH_SPEC, hit);
+                _PyFrame_SetStackPointer(frame, stack_pointer);
+                PyObject *res_o = _PyObject_FormatAdvanced(
+                    value_o, spec_o, _PyUnicode_FormatAdvancedWriter);
+                _PyStackRef tmp = fmt_spec;
+                fmt_spec = PyStackRef_NULL;
+                stack_pointer[-1] = fmt_spec;
+                PyStackRef_CLOSE(tmp);
+                tmp = value;
+                value = PyStackRef_NULL;
+                stack_pointer[-2] = value;
+                PyStackRef_CLOSE(tmp);
+                stack_pointer = _PyFrame_GetStackPointer(frame);
+                stack_pointer += -2;
+                assert(WITHIN_STACK_BOUNDS());
+                if (res_o == NULL) {
+                    JUMP_TO_LABEL(error);
+                }
+                res = PyStackRef_FromPyObjectSteal(res_o);
             }
-            res = PyStackRef_FromPyObjectSteal(res_o);
             stack_pointer[0] = res;
             stack_pointer += 1;
             assert(WITHIN_STACK_BOUNDS());
@@ -5448,15 +6134,134 @@
                     stack_pointer = _PyFrame_GetStackPointer(frame);
                     DISPATCH_SAME_OPARG();
                 }
-                OPCODE_DEFERRED_INC(FOR_ITER);
-                ADVANCE_ADAPTIVE_COUNTER(this_instr[1].counter);
-                #endif  /* ENABLE_SPECIALIZATION_FT */
+                OPCODE_DEFERRED_INC(FOR_ITER);
+                ADVANCE_ADAPTIVE_COUNTER(this_instr[1].counter);
+                #endif  /* ENABLE_SPECIALIZATION_FT */
+            }
+            // _FOR_ITER
+            {
+                PyObject *iter_o = PyStackRef_AsPyObjectBorrow(iter);
+                _PyFrame_SetStackPointer(frame, stack_pointer);
+                PyObject *next_o = (*Py_TYPE(iter_o)->tp_iternext)(iter_o);
+                stack_pointer = _PyFrame_GetStackPointer(frame);
+                if (next_o == NULL) {
+                    if (_PyErr_Occurred(tstate)) {
+                        _PyFrame_SetStackPointer(frame, stack_pointer);
+                        int matches = _PyErr_ExceptionMatches(tstate, PyExc_StopIteration);
+                        stack_pointer = _PyFrame_GetStackPointer(frame);
+                        if (!matches) {
+                            JUMP_TO_LABEL(error);
+                        }
+                        _PyFrame_SetStackPointer(frame, stack_pointer);
+                        _PyEval_MonitorRaise(tstate, frame, this_instr);
+                        _PyErr_Clear(tstate);
+                        stack_pointer = _PyFrame_GetStackPointer(frame);
+                    }
+                    assert(next_instr[oparg].op.code == END_FOR ||
+                       next_instr[oparg].op.code == INSTRUMENTED_END_FOR);
+                    JUMPBY(oparg + 1);
+                    DISPATCH();
+                }
+                next = PyStackRef_FromPyObjectSteal(next_o);
+            }
+            stack_pointer[0] = next;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            DISPATCH();
+        }
+
+        TARGET(FOR_ITER_DICT_ITEMS) {
+            #if Py_TAIL_CALL_INTERP
+            int opcode = FOR_ITER_DICT_ITEMS;
+            (void)(opcode);
+            #endif
+            _Py_CODEUNIT* const this_instr = next_instr;
+            (void)this_instr;
+            frame->instr_ptr = next_instr;
+            next_instr += 2;
+            INSTRUCTION_STATS(FOR_ITER_DICT_ITEMS);
+            static_assert(INLINE_CACHE_ENTRIES_FOR_ITER == 1, "incorrect cache size");
+            _PyStackRef iter;
+            _PyStackRef next;
+            /* Skip 1 cache entry */
+            // _ITER_CHECK_DICT_ITEMS
+            {
+                iter = stack_pointer[-1];
+                PyObject *iter_o = PyStackRef_AsPyObjectBorrow(iter);
+                if (Py_TYPE(iter_o) != &PyDictIterItem_Type) {
+                    UPDATE_MISS_STATS(FOR_ITER);
+                    assert(_PyOpcode_Deopt[opcode] == (FOR_ITER));
+                    JUMP_TO_PREDICTED(FOR_ITER);
+                }
+                #ifdef Py_GIL_DISABLED
+                if (!_PyObject_IsUniquelyReferenced(iter_o)) {
+                    UPDATE_MISS_STATS(FOR_ITER);
+                    assert(_PyOpcode_Deopt[opcode] == (FOR_ITER));
+                    JUMP_TO_PREDICTED(FOR_ITER);
+                }
+                #endif
+            }
+            // _ITER_NEXT_DICT_ITEMS
+            {
+                PyObject *iter_o = PyStackRef_AsPyObjectBorrow(iter);
+                assert(Py_TYPE(iter_o) == &PyDictIterItem_Type);
+                STAT_INC(FOR_ITER, hit);
+                _PyFrame_SetStackPointer(frame, stack_pointer);
+                PyObject *next_o = PyDictIterItem_Type.tp_iternext(iter_o);
+                stack_pointer = _PyFrame_GetStackPointer(frame);
+                if (next_o == NULL) {
+                    if (_PyErr_Occurred(tstate)) {
+                        JUMP_TO_LABEL(error);
+                    }
+                    JUMPBY(oparg + 1);
+                    DISPATCH();
+                }
+                next = PyStackRef_FromPyObjectSteal(next_o);
+            }
+            stack_pointer[0] = next;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            DISPATCH();
+        }
+
+        TARGET(FOR_ITER_ENUMERATE) {
+            #if Py_TAIL_CALL_INTERP
+            int opcode = FOR_ITER_ENUMERATE;
+            (void)(opcode);
+            #endif
+            _Py_CODEUNIT* const this_instr = next_instr;
+            (void)this_instr;
+            frame->instr_ptr = next_instr;
+            next_instr += 2;
+            INSTRUCTION_STATS(FOR_ITER_ENUMERATE);
+            static_assert(INLINE_CACHE_ENTRIES_FOR_ITER == 1, "incorrect cache size");
+            _PyStackRef iter;
+            _PyStackRef next;
+            /* Skip 1 cache entry */
+            // _ITER_CHECK_ENUMERATE
+            {
+                iter = stack_pointer[-1];
+                PyObject *iter_o = PyStackRef_AsPyObjectBorrow(iter);
+                if (Py_TYPE(iter_o) != &PyEnum_Type) {
+                    UPDATE_MISS_STATS(FOR_ITER);
+                    assert(_PyOpcode_Deopt[opcode] == (FOR_ITER));
+                    JUMP_TO_PREDICTED(FOR_ITER);
+                }
+                #ifdef Py_GIL_DISABLED
+                if (!_PyObject_IsUniquelyReferenced(iter_o)) {
+                    UPDATE_MISS_STATS(FOR_ITER);
+                    assert(_PyOpcode_Deopt[opcode] == (FOR_ITER));
+                    JUMP_TO_PREDICTED(FOR_ITER);
+                }
+                #endif
             }
-            // _FOR_ITER
+            // _ITER_NEXT_ENUMERATE
             {
                 PyObject *iter_o = PyStackRef_AsPyObjectBorrow(iter);
+                assert(Py_TYPE(iter_o) == &PyEnum_Type);
+                STAT_INC(FOR_ITER, hit);
                 _PyFrame_SetStackPointer(frame, stack_pointer);
-                PyObject *next_o = (*Py_TYPE(iter_o)->tp_iternext)(iter_o);
+                PyObject *next_o = PyEnum_Type.tp_iternext(iter_o);
                 stack_pointer = _PyFrame_GetStackPointer(frame);
                 if (next_o == NULL) {
                     if (_PyErr_Occurred(tstate)) {
@@ -5471,8 +6276,6 @@
                         _PyErr_Clear(tstate);
                         stack_pointer = _PyFrame_GetStackPointer(frame);
                     }
-                    assert(next_instr[oparg].op.code == END_FOR ||
-                       next_instr[oparg].op.code == INSTRUMENTED_END_FOR);
                     JUMPBY(oparg + 1);
                     DISPATCH();
                 }
@@ -5720,6 +6523,79 @@
             DISPATCH();
         }
 
+        TARGET(FOR_ITER_REVERSED_LIST) {
+            #if Py_TAIL_CALL_INTERP
+            int opcode = FOR_ITER_REVERSED_LIST;
+            (void)(opcode);
+            #endif
+            _Py_CODEUNIT* const this_instr = next_instr;
+            (void)this_instr;
+            frame->instr_ptr = next_instr;
+            next_instr += 2;
+            INSTRUCTION_STATS(FOR_ITER_REVERSED_LIST);
+            static_assert(INLINE_CACHE_ENTRIES_FOR_ITER == 1, "incorrect cache size");
+            _PyStackRef iter;
+            _PyStackRef next;
+            /* Skip 1 cache entry */
+            // _ITER_CHECK_REVERSED_LIST
+            {
+                iter = stack_pointer[-1];
+                PyObject *iter_o = PyStackRef_AsPyObjectBorrow(iter);
+                if (Py_TYPE(iter_o) != &PyListRevIter_Type) {
+                    UPDATE_MISS_STATS(FOR_ITER);
+                    assert(_PyOpcode_Deopt[opcode] == (FOR_ITER));
+                    JUMP_TO_PREDICTED(FOR_ITER);
+                }
+                #ifdef Py_GIL_DISABLED
+                if (true) {
+                    UPDATE_MISS_STATS(FOR_ITER);
+                    assert(_PyOpcode_Deopt[opcode] == (FOR_ITER));
+                    JUMP_TO_PREDICTED(FOR_ITER);
+                }
+                #endif
+            }
+            // _ITER_JUMP_REVERSED_LIST
+            {
+                PyObject *iter_o = PyStackRef_AsPyObjectBorrow(iter);
+                assert(Py_TYPE(iter_o) == &PyListRevIter_Type);
+                #ifndef Py_GIL_DISABLED
+
+                _PyListIterObject *it = (_PyListIterObject *)iter_o;
+                STAT_INC(FOR_ITER, hit);
+                PyListObject *seq = it->it_seq;
+                if (seq == NULL || it->it_index < 0 ||
+                    it->it_index >= PyList_GET_SIZE(seq))
+                {
+                    it->it_index = -1;
+                    if (seq != NULL) {
+                        it->it_seq = NULL;
+                        _PyFrame_SetStackPointer(frame, stack_pointer);
+                        Py_DECREF(seq);
+                        stack_pointer = _PyFrame_GetStackPointer(frame);
+                    }
+                    JUMPBY(oparg + 1);
+                    DISPATCH();
+                }
+                #else
+                (void)iter_o;
+                #endif
+            }
+            // _ITER_NEXT_REVERSED_LIST
+            {
+                PyObject *iter_o = PyStackRef_AsPyObjectBorrow(iter);
+                _PyListIterObject *it = (_PyListIterObject *)iter_o;
+                assert(Py_TYPE(iter_o) == &PyListRevIter_Type);
+                PyListObject *seq = it->it_seq;
+                assert(seq);
+                assert(it->it_index >= 0 && it->it_index < PyList_GET_SIZE(seq));
+                next = PyStackRef_FromPyObjectNew(PyList_GET_ITEM(seq, it->it_index--));
+            }
+            stack_pointer[0] = next;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            DISPATCH();
+        }
+
         TARGET(FOR_ITER_TUPLE) {
             #if Py_TAIL_CALL_INTERP
             int opcode = FOR_ITER_TUPLE;
@@ -7506,12 +8382,17 @@
                         }
                     }
                     else {
-                        _PyFrame_SetStackPointer(frame, stack_pointer);
-                        this_instr[1].counter = initial_jump_backoff_counter();
-                        stack_pointer = _PyFrame_GetStackPointer(frame);
-                        assert(tstate->previous_executor == NULL);
-                        tstate->previous_executor = Py_None;
-                        GOTO_TIER_TWO(executor);
+                        this_instr[1].counter = rearm_backoff_counter(counter);
+                        if (!_PyExecutor_IsReady(executor)) {
+                            _PyFrame_SetStackPointer(frame, stack_pointer);
+                            Py_DECREF(executor);
+                            stack_pointer = _PyFrame_GetStackPointer(frame);
+                        }
+                        else {
+                            assert(tstate->previous_executor == NULL);
+                            tstate->previous_executor = Py_None;
+                            GOTO_TIER_TWO(executor);
+                        }
                     }
                 }
                 else {
@@ -7993,6 +8874,88 @@
             DISPATCH();
         }
 
+        TARGET(LOAD_ATTR_INSTANCE_VALUE_POLY) {
+            #if Py_TAIL_CALL_INTERP
+            int opcode = LOAD_ATTR_INSTANCE_VALUE_POLY;
+            (void)(opcode);
+            #endif
+            _Py_CODEUNIT* const this_instr = next_instr;
+            (void)this_instr;
+            frame->instr_ptr = next_instr;
+            next_instr += 10;
+            INSTRUCTION_STATS(LOAD_ATTR_INSTANCE_VALUE_POLY);
+            static_assert(INLINE_CACHE_ENTRIES_LOAD_ATTR == 9, "incorrect cache size");
+            _PyStackRef owner;
+            _PyStackRef attr;
+            _PyStackRef *null;
+            /* Skip 1 cache entry */
+            // _GUARD_TYPE_VERSION_POLY
+            {
+                owner = stack_pointer[-1];
+                uint32_t type_version = read_u32(&this_instr[2].cache);
+                uint32_t type_version2 = read_u32(&this_instr[4].cache);
+                PyTypeObject *tp = Py_TYPE(PyStackRef_AsPyObjectBorrow(owner));
+                assert(type_version != 0 && type_version2 != 0);
+                unsigned int tp_version = FT_ATOMIC_LOAD_UINT_RELAXED(tp->tp_version_tag);
+                if (tp_version != type_version && tp_version != type_version2) {
+                    UPDATE_MISS_STATS(LOAD_ATTR);
+                    assert(_PyOpcode_Deopt[opcode] == (LOAD_ATTR));
+                    JUMP_TO_PREDICTED(LOAD_ATTR);
+                }
+            }
+            // _CHECK_MANAGED_OBJECT_HAS_VALUES
+            {
+                PyObject *owner_o = PyStackRef_AsPyObjectBorrow(owner);
+                assert(Py_TYPE(owner_o)->tp_dictoffset < 0);
+                assert(Py_TYPE(owner_o)->tp_flags & Py_TPFLAGS_INLINE_VALUES);
+                if (!FT_ATOMIC_LOAD_UINT8(_PyObject_InlineValues(owner_o)->valid)) {
+                    UPDATE_MISS_STATS(LOAD_ATTR);
+                    assert(_PyOpcode_Deopt[opcode] == (LOAD_ATTR));
+                    JUMP_TO_PREDICTED(LOAD_ATTR);
+                }
+            }
+            // _LOAD_ATTR_INSTANCE_VALUE_INDEX
+            {
+                uint16_t index = read_u16(&this_instr[6].cache);
+                PyObject *owner_o = PyStackRef_AsPyObjectBorrow(owner);
+                PyObject **value_ptr = &_PyObject_InlineValues(owner_o)->values[index];
+                PyObject *attr_o = FT_ATOMIC_LOAD_PTR_ACQUIRE(*value_ptr);
+                if (attr_o == NULL) {
+                    UPDATE_MISS_STATS(LOAD_ATTR);
+                    assert(_PyOpcode_Deopt[opcode] == (LOAD_ATTR));
+                    JUMP_TO_PREDICTED(LOAD_ATTR);
+                }
+                #ifdef Py_GIL_DISABLED
+                int increfed = _Py_TryIncrefCompareStackRef(value_ptr, attr_o, &attr);
+                if (!increfed) {
+                    if (true) {
+                        UPDATE_MISS_STATS(LOAD_ATTR);
+                        assert(_PyOpcode_Deopt[opcode] == (LOAD_ATTR));
+                        JUMP_TO_PREDICTED(LOAD_ATTR);
+                    }
+                }
+                #else
+                attr = PyStackRef_FromPyObjectNew(attr_o);
+                #endif
+                STAT_INC(LOAD_ATTR, hit);
+                stack_pointer[-1] = attr;
+                _PyFrame_SetStackPointer(frame, stack_pointer);
+                PyStackRef_CLOSE(owner);
+                stack_pointer = _PyFrame_GetStackPointer(frame);
+            }
+            /* Skip 3 cache entries */
+            // _PUSH_NULL_CONDITIONAL
+            {
+                null = &stack_pointer[0];
+                if (oparg & 1) {
+                    null[0] = PyStackRef_NULL;
+                }
+            }
+            stack_pointer += (oparg & 1);
+            assert(WITHIN_STACK_BOUNDS());
+            DISPATCH();
+        }
+
         TARGET(LOAD_ATTR_METHOD_LAZY_DICT) {
             #if Py_TAIL_CALL_INTERP
             int opcode = LOAD_ATTR_METHOD_LAZY_DICT;
@@ -10746,6 +11709,141 @@
             DISPATCH();
         }
 
+        TARGET(STORE_ATTR_PROPERTY) {
+            #if Py_TAIL_CALL_INTERP
+            int opcode = STORE_ATTR_PROPERTY;
+            (void)(opcode);
+            #endif
+            _Py_CODEUNIT* const this_instr = next_instr;
+            (void)this_instr;
+            frame->instr_ptr = next_instr;
+            next_instr += 5;
+            INSTRUCTION_STATS(STORE_ATTR_PROPERTY);
+            static_assert(INLINE_CACHE_ENTRIES_STORE_ATTR == 4, "incorrect cache size");
+            _PyStackRef owner;
+            _PyStackRef value;
+            /* Skip 1 cache entry */
+            // _GUARD_TYPE_VERSION
+            {
+                owner = stack_pointer[-1];
+                uint32_t type_version = read_u32(&this_instr[2].cache);
+                PyTypeObject *tp = Py_TYPE(PyStackRef_AsPyObjectBorrow(owner));
+                assert(type_version != 0);
+                if (FT_ATOMIC_LOAD_UINT_RELAXED(tp->tp_version_tag) != type_version) {
+                    UPDATE_MISS_STATS(STORE_ATTR);
+                    assert(_PyOpcode_Deopt[opcode] == (STORE_ATTR));
+                    JUMP_TO_PREDICTED(STORE_ATTR);
+                }
+            }
+            /* Skip 1 cache entry */
+            // _STORE_ATTR_PROPERTY
+            {
+                value = stack_pointer[-2];
+                PyHeapTypeObject *ht = (PyHeapTypeObject *)PyStackRef_TYPE(owner);
+                PyObject *descr = FT_ATOMIC_LOAD_PTR_ACQUIRE(ht->_spec_cache.property);
+                assert(Py_IS_TYPE(descr, &PyProperty_Type));
+                PyObject *name = GETITEM(FRAME_CO_NAMES, oparg);
+                if (((_PyPropertyObject *)descr)->prop_name != name) {
+                    UPDATE_MISS_STATS(STORE_ATTR);
+                    assert(_PyOpcode_Deopt[opcode] == (STORE_ATTR));
+                    JUMP_TO_PREDICTED(STORE_ATTR);
+                }
+                PyObject *fset = ((_PyPropertyObject *)descr)->prop_set;
+                if (fset == NULL) {
+                    UPDATE_MISS_STATS(STORE_ATTR);
+                    assert(_PyOpcode_Deopt[opcode] == (STORE_ATTR));
+                    JUMP_TO_PREDICTED(STORE_ATTR);
+                }
+                STAT_INC(STORE_ATTR, hit);
+                PyObject *args[2] = {
+                    PyStackRef_AsPyObjectBorrow(owner),
+                    PyStackRef_AsPyObjectBorrow(value),
+                };
+                _PyFrame_SetStackPointer(frame, stack_pointer);
+                PyObject *res = PyObject_Vectorcall(fset, args, 2, NULL);
+                _PyStackRef tmp = owner;
+                owner = PyStackRef_NULL;
+                stack_pointer[-1] = owner;
+                PyStackRef_CLOSE(tmp);
+                tmp = value;
+                value = PyStackRef_NULL;
+                stack_pointer[-2] = value;
+                PyStackRef_CLOSE(tmp);
+                stack_pointer = _PyFrame_GetStackPointer(frame);
+                stack_pointer += -2;
+                assert(WITHIN_STACK_BOUNDS());
+                if (res == NULL) {
+                    JUMP_TO_LABEL(error);
+                }
+                _PyFrame_SetStackPointer(frame, stack_pointer);
+                Py_DECREF(res);
+                stack_pointer = _PyFrame_GetStackPointer(frame);
+            }
+            DISPATCH();
+        }
+
+        TARGET(STORE_ATTR_SETATTR_OVERRIDDEN) {
+            #if Py_TAIL_CALL_INTERP
+            int opcode = STORE_ATTR_SETATTR_OVERRIDDEN;
+            (void)(opcode);
+            #endif
+            _Py_CODEUNIT* const this_instr = next_instr;
+            (void)this_instr;
+            frame->instr_ptr = next_instr;
+            next_instr += 5;
+            INSTRUCTION_STATS(STORE_ATTR_SETATTR_OVERRIDDEN);
+            static_assert(INLINE_CACHE_ENTRIES_STORE_ATTR == 4, "incorrect cache size");
+            _PyStackRef owner;
+            _PyStackRef value;
+            /* Skip 1 cache entry */
+            // _GUARD_TYPE_VERSION
+            {
+                owner = stack_pointer[-1];
+                uint32_t type_version = read_u32(&this_instr[2].cache);
+                PyTypeObject *tp = Py_TYPE(PyStackRef_AsPyObjectBorrow(owner));
+                assert(type_version != 0);
+                if (FT_ATOMIC_LOAD_UINT_RELAXED(tp->tp_version_tag) != type_version) {
+                    UPDATE_MISS_STATS(STORE_ATTR);
+                    assert(_PyOpcode_Deopt[opcode] == (STORE_ATTR));
+                    JUMP_TO_PREDICTED(STORE_ATTR);
+                }
+            }
+            /* Skip 1 cache entry */
+            // _STORE_ATTR_SETATTR_OVERRIDDEN
+            {
+                value = stack_pointer[-2];
+                PyHeapTypeObject *ht = (PyHeapTypeObject *)PyStackRef_TYPE(owner);
+                PyObject *setattr = FT_ATOMIC_LOAD_PTR_ACQUIRE(ht->_spec_cache.setattr);
+                assert(Py_IS_TYPE(setattr, &PyFunction_Type));
+                STAT_INC(STORE_ATTR, hit);
+                PyObject *args[3] = {
+                    PyStackRef_AsPyObjectBorrow(owner),
+                    GETITEM(FRAME_CO_NAMES, oparg),
+                    PyStackRef_AsPyObjectBorrow(value),
+                };
+                _PyFrame_SetStackPointer(frame, stack_pointer);
+                PyObject *res = PyObject_Vectorcall(setattr, args, 3, NULL);
+                _PyStackRef tmp = owner;
+                owner = PyStackRef_NULL;
+                stack_pointer[-1] = owner;
+                PyStackRef_CLOSE(tmp);
+                tmp = value;
+                value = PyStackRef_NULL;
+                stack_pointer[-2] = value;
+                PyStackRef_CLOSE(tmp);
+                stack_pointer = _PyFrame_GetStackPointer(frame);
+                stack_pointer += -2;
+                assert(WITHIN_STACK_BOUNDS());
+                if (res == NULL) {
+                    JUMP_TO_LABEL(error);
+                }
+                _PyFrame_SetStackPointer(frame, stack_pointer);
+                Py_DECREF(res);
+                stack_pointer = _PyFrame_GetStackPointer(frame);
+            }
+            DISPATCH();
+        }
+
         TARGET(STORE_ATTR_SLOT) {
             #if Py_TAIL_CALL_INTERP
             int opcode = STORE_ATTR_SLOT;
@@ -19,6 +19,7 @@
 #include "pycore_opcode_utils.h"
 #include "pycore_optimizer.h"
 #include "pycore_pyerrors.h"
+#include "pycore_semaphore.h"
 #include "pycore_setobject.h"
 #include "pycore_sliceobject.h"
 #include "pycore_tuple.h"
@@ -55,14 +56,32 @@ jit_error(const char *message)
     PyErr_Format(PyExc_RuntimeWarning, "JIT %s (%d)", message, hint);
 }
 
+// Executable memory is mapped in chunks of at least JIT_CHUNK_SIZE bytes,
+// which are handed out to executors as runs of whole pages. Executors never
+// share a page, so that each one can be protected separately: code has to
+// stay executable while a neighbour on the same chunk is being written.
+// Chunks are aligned to, and the same size as, a huge page on x86-64 and
+// AArch64, so hot code packed into one chunk can be covered by a single
+// iTLB entry.
+#define JIT_CHUNK_SIZE (2 * 1024 * 1024)
+
+typedef struct _jit_code_chunk {
+    struct _jit_code_chunk *next;
+    unsigned char *memory;
+    size_t page_count;
+    size_t free_pages;
+    // One entry per page, nonzero if the page belongs to an executor:
+    char used[1];
+} jit_chunk;
+
 static unsigned char *
-jit_alloc(size_t size)
+map_chunk(size_t size)
 {
     assert(size);
     assert(size % get_page_size() == 0);
 #ifdef MS_WINDOWS
-    int flags = MEM_COMMIT | MEM_RESERVE;
-    unsigned char *memory = VirtualAlloc(NULL, size, flags, PAGE_READWRITE);
+    // Pages are committed as they are handed out to executors:
+    unsigned char *memory = VirtualAlloc(NULL, size, MEM_RESERVE, PAGE_NOACCESS);
     int failed = memory == NULL;
 #else
     int flags = MAP_ANONYMOUS | MAP_PRIVATE;
@@ -71,18 +90,39 @@ jit_alloc(size_t size)
     flags |= MAP_JIT;
     prot |= PROT_EXEC;
 # endif
-    unsigned char *memory = mmap(NULL, size, prot, flags, -1, 0);
-    int failed = memory == MAP_FAILED;
+    // Over-allocate, then trim the mapping down to an aligned chunk:
+    size_t padded = size + JIT_CHUNK_SIZE;
+    unsigned char *mapping = mmap(NULL, padded, prot, flags, -1, 0);
+    int failed = mapping == MAP_FAILED;
+    unsigned char *memory = NULL;
+    if (!failed) {
+        memory = _Py_ALIGN_UP(mapping, JIT_CHUNK_SIZE);
+        size_t head = memory - mapping;
+        size_t tail = padded - head - size;
+        if (head) {
+            failed |= munmap(mapping, head);
+        }
+        if (tail) {
+            failed |= munmap(memory + size, tail);
+        }
+    }
 #endif
     if (failed) {
         jit_error("unable to allocate memory");
         return NULL;
     }
+#ifdef MADV_HUGEPAGE
+    // Transparent huge pages can only back a range once all of it has the
+    // same protection, which happens as the chunk fills up with executable
+    // code. Explicit huge pages (MAP_HUGETLB) would make every mprotect()
+    // call cover a whole chunk, so they are not used. Failure is harmless:
+    (void)madvise(memory, size, MADV_HUGEPAGE);
+#endif
     return memory;
 }
 
 static int
-jit_free(unsigned char *memory, size_t size)
+unmap_chunk(unsigned char *memory, size_t size)
 {
     assert(size);
     assert(size % get_page_size() == 0);
@@ -95,23 +135,197 @@ jit_free(unsigned char *memory, size_t size)
         jit_error("unable to free memory");
         return -1;
     }
-    OPT_STAT_ADD(jit_freed_memory_size, size);
     return 0;
 }
 
+// Make pages that are about to be handed out to an executor writable.
 static int
-mark_executable(unsigned char *memory, size_t size)
+commit_pages(unsigned char *memory, size_t size)
 {
-    if (size == 0) {
+#ifdef MS_WINDOWS
+    int failed = VirtualAlloc(memory, size, MEM_COMMIT, PAGE_READWRITE) == NULL;
+#elif defined(MAP_JIT)
+    int failed = 0;
+#else
+    int failed = mprotect(memory, size, PROT_READ | PROT_WRITE);
+#endif
+    if (failed) {
+        jit_error("unable to allocate memory");
+        return -1;
+    }
+    return 0;
+}
+
+// Give the physical memory behind pages that are no longer used back to the
+// OS, while keeping the address range reserved. Failure is harmless.
+static void
+decommit_pages(unsigned char *memory, size_t size)
+{
+#ifdef MS_WINDOWS
+    (void)VirtualFree(memory, size, MEM_DECOMMIT);
+#elif defined(MADV_DONTNEED)
+    (void)madvise(memory, size, MADV_DONTNEED);
+#endif
+}
+
+// Finds the first free run of pages at or after page "start", wrapping
+// around to the beginning of the chunk if there is none.
+static unsigned char *
+alloc_from_chunk(jit_chunk *chunk, size_t pages, size_t page_size, size_t start)
+{
+    if (chunk->free_pages < pages) {
+        return NULL;
+    }
+    size_t from = start;
+    while (1) {
+        size_t run = 0;
+        for (size_t i = from; i < chunk->page_count; i++) {
+            run = chunk->used[i] ? 0 : run + 1;
+            if (run == pages) {
+                size_t first = i + 1 - pages;
+                unsigned char *memory = chunk->memory + first * page_size;
+                if (commit_pages(memory, pages * page_size)) {
+                    return NULL;
+                }
+                memset(&chunk->used[first], 1, pages);
+                chunk->free_pages -= pages;
+                return memory;
+            }
+        }
+        if (from == 0) {
+            return NULL;
+        }
+        from = 0;
+    }
+}
+
+static jit_chunk *
+find_chunk(struct _jit_code_arena *arena, const unsigned char *memory,
+           size_t page_size)
+{
+    for (jit_chunk *chunk = arena->chunks; chunk; chunk = chunk->next) {
+        if (chunk->memory <= memory &&
+            memory < chunk->memory + chunk->page_count * page_size)
+        {
+            return chunk;
+        }
+    }
+    return NULL;
+}
+
+// Returns NULL with an exception set on error, or NULL without one if
+// PYTHON_JIT_MEMORY_LIMIT doesn't leave room for size more bytes. If near
+// isn't NULL, the memory is placed as close after it as possible.
+static unsigned char *
+jit_alloc(size_t size, const unsigned char *near)
+{
+    assert(size);
+    size_t page_size = get_page_size();
+    assert(size % page_size == 0);
+    PyThreadState *tstate = _PyThreadState_GET();
+    struct _jit_code_arena *arena = &tstate->interp->jit_arena;
+    if (arena->limit && arena->used + size > arena->limit) {
+        // Evict executors that haven't run since the last sweep. This
+        // approximates least-recently-used order, since the sweep also
+        // marks all of the remaining executors as cold. Don't do it here,
+        // though: we're in the middle of compiling a trace, and the executor
+        // that it is about to be linked to could be one of the cold ones.
+        // Leave it to the eval breaker, and let a later attempt succeed:
+        _Py_set_eval_breaker_bit(tstate, _PY_EVAL_JIT_INVALIDATE_COLD_BIT);
+        return NULL;
+    }
+    size_t pages = size / page_size;
+    unsigned char *memory = NULL;
+    jit_chunk *preferred = near ? find_chunk(arena, near, page_size) : NULL;
+    if (preferred != NULL) {
+        size_t start = (near - preferred->memory) / page_size;
+        memory = alloc_from_chunk(preferred, pages, page_size, start);
+        if (memory == NULL && PyErr_Occurred()) {
+            return NULL;
+        }
+    }
+    for (jit_chunk *chunk = arena->chunks; chunk && !memory; chunk = chunk->next) {
+        if (chunk == preferred) {
+            continue;
+        }
+        memory = alloc_from_chunk(chunk, pages, page_size, 0);
+        if (memory == NULL && PyErr_Occurred()) {
+            return NULL;
+        }
+    }
+    if (memory == NULL) {
+        size_t chunk_size = Py_MAX(size, (size_t)JIT_CHUNK_SIZE);
+        chunk_size = _Py_SIZE_ROUND_UP(chunk_size, page_size);
+        size_t page_count = chunk_size / page_size;
+        jit_chunk *chunk = PyMem_RawMalloc(offsetof(jit_chunk, used) + page_count);
+        if (chunk == NULL) {
+            PyErr_NoMemory();
+            return NULL;
+        }
+        chunk->memory = map_chunk(chunk_size);
+        if (chunk->memory == NULL) {
+            PyMem_RawFree(chunk);
+            return NULL;
+        }
+        chunk->page_count = chunk->free_pages = page_count;
+        memset(chunk->used, 0, page_count);
+        memory = alloc_from_chunk(chunk, pages, page_size, 0);
+        if (memory == NULL) {
+            unmap_chunk(chunk->memory, chunk_size);
+            PyMem_RawFree(chunk);
+            return NULL;
+        }
+        chunk->next = arena->chunks;
+        arena->chunks = chunk;
+    }
+    arena->used += size;
+    return memory;
+}
+
+static int
+jit_free(unsigned char *memory, size_t size)
+{
+    assert(size);
+    size_t page_size = get_page_size();
+    assert(size % page_size == 0);
+    struct _jit_code_arena *arena = &_PyInterpreterState_GET()->jit_arena;
+    jit_chunk *chunk = find_chunk(arena, memory, page_size);
+    assert(chunk != NULL);
+    size_t first = (memory - chunk->memory) / page_size;
+    size_t pages = size / page_size;
+    assert(first + pages <= chunk->page_count);
+    memset(&chunk->used[first], 0, pages);
+    chunk->free_pages += pages;
+    arena->used -= size;
+    OPT_STAT_ADD(jit_freed_memory_size, size);
+    if (chunk->free_pages < chunk->page_count) {
+        decommit_pages(memory, size);
         return 0;
     }
+    jit_chunk **link = &arena->chunks;
+    while (*link != chunk) {
+        link = &(*link)->next;
+    }
+    *link = chunk->next;
+    int err = unmap_chunk(chunk->memory, chunk->page_count * page_size);
+    PyMem_RawFree(chunk);
+    return err;
+}
+
+// Returns NULL on success, or a description of what went wrong. This doesn't
+// raise, since the compiler thread calls it without a thread state.
+static const char *
+protect_executable(unsigned char *memory, size_t size)
+{
+    if (size == 0) {
+        return NULL;
+    }
     assert(size % get_page_size() == 0);
     // Do NOT ever leave the memory writable! Also, don't forget to flush the
     // i-cache (I cannot begin to tell you how horrible that is to debug):
 #ifdef MS_WINDOWS
     if (!FlushInstructionCache(GetCurrentProcess(), memory, size)) {
-        jit_error("unable to flush instruction cache");
-        return -1;
+        return "unable to flush instruction cache";
     }
     int old;
     int failed = !VirtualProtect(memory, size, PAGE_EXECUTE_READ, &old);
@@ -123,10 +337,9 @@ mark_executable(unsigned char *memory, size_t size)
 #endif
 #endif
     if (failed) {
-        jit_error("unable to protect executable memory");
-        return -1;
+        return "unable to protect executable memory";
     }
-    return 0;
+    return NULL;
 }
 
 // JIT compiler stuff: /////////////////////////////////////////////////////////
@@ -488,7 +701,299 @@ combine_symbol_mask(const symbol_mask src, symbol_mask dest)
     }
 }
 
+// Everything needed to emit the machine code for an executor into memory
+// that has already been allocated for it.
+typedef struct jit_job {
+    struct jit_job *next;
+    _PyExecutorObject *executor;
+    const _PyUOpInstruction *trace;
+    size_t length;
+    unsigned char *memory;
+    size_t code_size;
+    size_t data_size;
+    size_t total_size;
+    // Set by the compiler thread if the code couldn't be made executable:
+    const char *error;
+    jit_state state;
+} jit_job;
+
+// Emits the code without touching any Python objects, so that this can run
+// on the compiler thread.
+static void
+emit_job(jit_job *job)
+{
+    const StencilGroup *group;
+    _PyExecutorObject *executor = job->executor;
+    const _PyUOpInstruction *trace = job->trace;
+    jit_state *state = &job->state;
+    unsigned char *memory = job->memory;
+#ifdef MAP_JIT
+    pthread_jit_write_protect_np(0);
+#endif
+    // Loop again to emit the code:
+    unsigned char *code = memory;
+    state->trampolines.mem = memory + job->code_size;
+    unsigned char *data = memory + job->code_size + state->trampolines.size;
+    // Compile the shim, which handles converting between the native
+    // calling convention and the calling convention used by jitted code
+    // (which may be different for efficiency reasons).
+    group = &shim;
+    group->emit(code, data, executor, NULL, state);
+    code += group->code_size;
+    data += group->data_size;
+    assert(trace[0].opcode == _START_EXECUTOR);
+    for (size_t i = 0; i < job->length; i++) {
+        const _PyUOpInstruction *instruction = &trace[i];
+        group = &stencil_groups[instruction->opcode];
+        group->emit(code, data, executor, instruction, state);
+        code += group->code_size;
+        data += group->data_size;
+    }
+    // Protect against accidental buffer overrun into data:
+    group = &stencil_groups[_FATAL_ERROR];
+    group->emit(code, data, executor, NULL, state);
+    code += group->code_size;
+    data += group->data_size;
+    assert(code == memory + job->code_size);
+    assert(data == memory + job->code_size + state->trampolines.size + job->data_size);
+#ifdef MAP_JIT
+    pthread_jit_write_protect_np(1);
+#endif
+    job->error = protect_executable(memory, job->total_size);
+}
+
+// Background compilation: /////////////////////////////////////////////////////
+
+// With PYTHON_JIT_BACKGROUND, the trace is still projected and optimized on
+// the thread that found it to be hot, and memory is allocated for it there
+// too. Only emitting the machine code happens on the compiler thread. The
+// executor is installed straight away, but _PyExecutor_IsReady() keeps
+// execution in tier 1 until jit_code is published. Each queued job owns a
+// strong reference to its executor, which is released (with the GIL held)
+// by a pending call that the compiler thread schedules once the job is done.
+typedef struct _jit_compiler {
+    PyInterpreterState *interp;
+    PyMutex mutex;
+    _PySemaphore wakeup;
+    PyThread_handle_t handle;
+    bool running;
+    bool stopping;
+    // Jobs are emitted in order and stay at the head of "pending" while they
+    // are in progress:
+    jit_job *pending;
+    jit_job *pending_tail;
+    jit_job *done;
+} jit_compiler;
+
+static void
+publish_job(jit_job *job)
+{
+    if (job->error == NULL) {
+        _Py_atomic_store_ptr_release(&job->executor->jit_code, job->memory);
+    }
+}
+
+// Releases finished jobs. Must be called with the GIL held.
+static void
+reap_jobs(jit_compiler *compiler)
+{
+    PyMutex_Lock(&compiler->mutex);
+    jit_job *job = compiler->done;
+    compiler->done = NULL;
+    PyMutex_Unlock(&compiler->mutex);
+    while (job != NULL) {
+        jit_job *next = job->next;
+        _PyExecutorObject *executor = job->executor;
+        if (job->error != NULL) {
+            // The executor stays in tier 1 forever. Give back its memory:
+            executor->jit_side_entry = NULL;
+            executor->jit_size = 0;
+            if (jit_free(job->memory, job->total_size)) {
+                PyErr_FormatUnraisable("Exception ignored while "
+                                       "freeing JIT memory");
+            }
+        }
+        Py_DECREF(executor);
+        PyMem_RawFree(job);
+        job = next;
+    }
+}
+
+static int
+reap_pending(void *arg)
+{
+    PyInterpreterState *interp = (PyInterpreterState *)arg;
+    // The compiler may already have been torn down by _PyJIT_Fini():
+    if (interp->jit_compiler != NULL) {
+        reap_jobs(interp->jit_compiler);
+    }
+    return 0;
+}
+
+static void
+compiler_thread(void *arg)
+{
+    jit_compiler *compiler = (jit_compiler *)arg;
+    while (1) {
+        _PySemaphore_Wait(&compiler->wakeup, -1, 0);
+        PyMutex_Lock(&compiler->mutex);
+        jit_job *job = compiler->pending;
+        bool stopping = compiler->stopping;
+        PyMutex_Unlock(&compiler->mutex);
+        if (job == NULL) {
+            if (stopping) {
+                return;
+            }
+            continue;
+        }
+        emit_job(job);
+        publish_job(job);
+        PyMutex_Lock(&compiler->mutex);
+        compiler->pending = job->next;
+        if (compiler->pending == NULL) {
+            compiler->pending_tail = NULL;
+        }
+        // Only the first finished job needs to schedule a reap, since that
+        // releases everything that finishes before it runs:
+        bool schedule = compiler->done == NULL;
+        job->next = compiler->done;
+        compiler->done = job;
+        PyMutex_Unlock(&compiler->mutex);
+        if (schedule) {
+            // If the queue is full, the job is reaped along with the next one
+            // that is queued instead:
+            _PyEval_AddPendingCall(compiler->interp, reap_pending,
+                                   compiler->interp, 0);
+        }
+    }
+}
+
+// Returns 0 if the job was queued, or -1 (without an exception) if it has to
+// be compiled synchronously instead.
+static int
+queue_job(PyInterpreterState *interp, jit_job *job)
+{
+    jit_compiler *compiler = interp->jit_compiler;
+    if (compiler == NULL) {
+        compiler = PyMem_RawCalloc(1, sizeof(jit_compiler));
+        if (compiler == NULL) {
+            return -1;
+        }
+        compiler->interp = interp;
+        _PySemaphore_Init(&compiler->wakeup);
+        interp->jit_compiler = compiler;
+    }
+    reap_jobs(compiler);
+    if (!compiler->running) {
+        PyThread_ident_t ident;
+        if (PyThread_start_joinable_thread(compiler_thread, compiler,
+                                           &ident, &compiler->handle))
+        {
+            return -1;
+        }
+        compiler->running = true;
+    }
+    jit_job *queued = PyMem_RawMalloc(sizeof(jit_job));
+    if (queued == NULL) {
+        return -1;
+    }
+    memcpy(queued, job, sizeof(jit_job));
+    queued->next = NULL;
+    Py_INCREF(queued->executor);
+    PyMutex_Lock(&compiler->mutex);
+    if (compiler->pending_tail) {
+        compiler->pending_tail->next = queued;
+    }
+    else {
+        compiler->pending = queued;
+    }
+    compiler->pending_tail = queued;
+    PyMutex_Unlock(&compiler->mutex);
+    _PySemaphore_Wakeup(&compiler->wakeup);
+    return 0;
+}
+
+void
+_PyJIT_Fini(PyInterpreterState *interp)
+{
+    // Anything compiled from now on (by finalizers, say) is compiled
+    // synchronously, rather than starting the compiler thread again:
+    interp->jit_background = false;
+    jit_compiler *compiler = interp->jit_compiler;
+    if (compiler == NULL) {
+        return;
+    }
+    if (compiler->running) {
+        PyMutex_Lock(&compiler->mutex);
+        compiler->stopping = true;
+        PyMutex_Unlock(&compiler->mutex);
+        _PySemaphore_Wakeup(&compiler->wakeup);
+        Py_BEGIN_ALLOW_THREADS
+        PyThread_join_thread(compiler->handle);
+        Py_END_ALLOW_THREADS
+        compiler->running = false;
+    }
+    assert(compiler->pending == NULL);
+    reap_jobs(compiler);
+    _PySemaphore_Destroy(&compiler->wakeup);
+    PyMem_RawFree(compiler);
+    interp->jit_compiler = NULL;
+}
+
+void
+_PyJIT_BeforeFork(PyInterpreterState *interp)
+{
+    if (interp->jit_compiler != NULL) {
+        PyMutex_Lock(&interp->jit_compiler->mutex);
+    }
+}
+
+void
+_PyJIT_AfterFork_Parent(PyInterpreterState *interp)
+{
+    if (interp->jit_compiler != NULL) {
+        PyMutex_Unlock(&interp->jit_compiler->mutex);
+    }
+}
+
+void
+_PyJIT_AfterFork_Child(PyInterpreterState *interp)
+{
+    jit_compiler *compiler = interp->jit_compiler;
+    if (compiler == NULL) {
+        return;
+    }
+    // The compiler thread is gone, possibly halfway through a job. Emit
+    // whatever it hadn't finished here instead, starting over if necessary:
+    _PyMutex_at_fork_reinit(&compiler->mutex);
+    _PySemaphore_Init(&compiler->wakeup);
+    compiler->running = false;
+    compiler->stopping = false;
+    while (compiler->pending != NULL) {
+        jit_job *job = compiler->pending;
+        compiler->pending = job->next;
+        if (!_PyExecutor_IsReady(job->executor)) {
+            if (commit_pages(job->memory, job->total_size)) {
+                PyErr_Clear();
+                job->error = "unable to allocate memory";
+            }
+            else {
+                emit_job(job);
+                publish_job(job);
+            }
+        }
+        job->next = compiler->done;
+        compiler->done = job;
+    }
+    compiler->pending_tail = NULL;
+    if (compiler->done != NULL) {
+        _PyEval_AddPendingCall(interp, reap_pending, interp, 0);
+    }
+}
+
 // Compiles executor in-place. Don't forget to call _PyJIT_Free later!
+// Returns 0 on success, -1 on error, and 1 if the JIT memory limit has been
+// reached and the executor can't be compiled.
 int
 _PyJIT_Compile(_PyExecutorObject *executor, const _PyUOpInstruction trace[], size_t length)
 {
@@ -496,86 +1001,78 @@ _PyJIT_Compile(_PyExecutorObject *executor, const _PyUOpInstruction trace[], siz
     // Loop once to find the total compiled size:
     size_t code_size = 0;
     size_t data_size = 0;
-    jit_state state = {0};
+    jit_job job = {0};
+    jit_state *state = &job.state;
     group = &shim;
     code_size += group->code_size;
     data_size += group->data_size;
-    combine_symbol_mask(group->trampoline_mask, state.trampolines.mask);
+    combine_symbol_mask(group->trampoline_mask, state->trampolines.mask);
     for (size_t i = 0; i < length; i++) {
         const _PyUOpInstruction *instruction = &trace[i];
         group = &stencil_groups[instruction->opcode];
-        state.instruction_starts[i] = code_size;
+        state->instruction_starts[i] = code_size;
         code_size += group->code_size;
         data_size += group->data_size;
-        combine_symbol_mask(group->trampoline_mask, state.trampolines.mask);
+        combine_symbol_mask(group->trampoline_mask, state->trampolines.mask);
     }
     group = &stencil_groups[_FATAL_ERROR];
     code_size += group->code_size;
     data_size += group->data_size;
-    combine_symbol_mask(group->trampoline_mask, state.trampolines.mask);
+    combine_symbol_mask(group->trampoline_mask, state->trampolines.mask);
     // Calculate the size of the trampolines required by the whole trace
-    for (size_t i = 0; i < Py_ARRAY_LENGTH(state.trampolines.mask); i++) {
-        state.trampolines.size += _Py_popcount32(state.trampolines.mask[i]) * TRAMPOLINE_SIZE;
+    for (size_t i = 0; i < Py_ARRAY_LENGTH(state->trampolines.mask); i++) {
+        state->trampolines.size += _Py_popcount32(state->trampolines.mask[i]) * TRAMPOLINE_SIZE;
     }
     // Round up to the nearest page:
     size_t page_size = get_page_size();
     assert((page_size & (page_size - 1)) == 0);
-    size_t padding = page_size - ((code_size + state.trampolines.size + data_size) & (page_size - 1));
-    size_t total_size = code_size + state.trampolines.size + data_size  + padding;
-    unsigned char *memory = jit_alloc(total_size);
+    size_t padding = page_size - ((code_size + state->trampolines.size + data_size) & (page_size - 1));
+    size_t total_size = code_size + state->trampolines.size + data_size  + padding;
+    // Side exits are compiled while the executor that they are attached to is
+    // in tstate->previous_executor. Keep the two close together in memory:
+    PyThreadState *tstate = _PyThreadState_GET();
+    PyObject *parent = tstate->previous_executor;
+    const unsigned char *near = NULL;
+    if (parent != NULL && parent != Py_None) {
+        near = ((_PyExecutorObject *)parent)->jit_code;
+    }
+    unsigned char *memory = jit_alloc(total_size, near);
     if (memory == NULL) {
-        return -1;
+        return PyErr_Occurred() ? -1 : 1;
     }
-#ifdef MAP_JIT
-    pthread_jit_write_protect_np(0);
-#endif
     // Collect memory stats
     OPT_STAT_ADD(jit_total_memory_size, total_size);
     OPT_STAT_ADD(jit_code_size, code_size);
-    OPT_STAT_ADD(jit_trampoline_size, state.trampolines.size);
+    OPT_STAT_ADD(jit_trampoline_size, state->trampolines.size);
     OPT_STAT_ADD(jit_data_size, data_size);
     OPT_STAT_ADD(jit_padding_size, padding);
     OPT_HIST(total_size, trace_total_memory_hist);
     // Update the offsets of each instruction:
     for (size_t i = 0; i < length; i++) {
-        state.instruction_starts[i] += (uintptr_t)memory;
+        state->instruction_starts[i] += (uintptr_t)memory;
     }
-    // Loop again to emit the code:
-    unsigned char *code = memory;
-    state.trampolines.mem = memory + code_size;
-    unsigned char *data = memory + code_size + state.trampolines.size;
-    // Compile the shim, which handles converting between the native
-    // calling convention and the calling convention used by jitted code
-    // (which may be different for efficiency reasons).
-    group = &shim;
-    group->emit(code, data, executor, NULL, &state);
-    code += group->code_size;
-    data += group->data_size;
-    assert(trace[0].opcode == _START_EXECUTOR);
-    for (size_t i = 0; i < length; i++) {
-        const _PyUOpInstruction *instruction = &trace[i];
-        group = &stencil_groups[instruction->opcode];
-        group->emit(code, data, executor, instruction, &state);
-        code += group->code_size;
-        data += group->data_size;
+    job.executor = executor;
+    job.trace = trace;
+    job.length = length;
+    job.memory = memory;
+    job.code_size = code_size;
+    job.data_size = data_size;
+    job.total_size = total_size;
+    executor->jit_code = NULL;
+    executor->jit_side_entry = memory + shim.code_size;
+    executor->jit_size = total_size;
+    if (tstate->interp->jit_background && queue_job(tstate->interp, &job) == 0) {
+        return 0;
     }
-    // Protect against accidental buffer overrun into data:
-    group = &stencil_groups[_FATAL_ERROR];
-    group->emit(code, data, executor, NULL, &state);
-    code += group->code_size;
-    data += group->data_size;
-    assert(code == memory + code_size);
-    assert(data == memory + code_size + state.trampolines.size + data_size);
-#ifdef MAP_JIT
-    pthread_jit_write_protect_np(1);
-#endif
-    if (mark_executable(memory, total_size)) {
+    emit_job(&job);
+    if (job.error != NULL) {
+        jit_error(job.error);
+        executor->jit_side_entry = NULL;
+        executor->jit_size = 0;
         jit_free(memory, total_size);
         return -1;
     }
-    executor->jit_code = memory;
-    executor->jit_side_entry = memory + shim.code_size;
-    executor->jit_size = total_size;
+    publish_job(&job);
     return 0;
 }
 
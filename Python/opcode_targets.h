@@ -149,6 +149,7 @@ static void *opcode_targets[256] = {
     &&TARGET_CALL_BUILTIN_FAST,
     &&TARGET_CALL_BUILTIN_FAST_WITH_KEYWORDS,
     &&TARGET_CALL_BUILTIN_O,
+    &&TARGET_CALL_DUNDER_CALL,
     &&TARGET_CALL_ISINSTANCE,
     &&TARGET_CALL_KW_BOUND_METHOD,
     &&TARGET_CALL_KW_NON_PY,
@@ -166,13 +167,25 @@ static void *opcode_targets[256] = {
     &&TARGET_CALL_TUPLE_1,
     &&TARGET_CALL_TYPE_1,
     &&TARGET_COMPARE_OP_FLOAT,
+    &&TARGET_COMPARE_OP_FLOAT_INT,
     &&TARGET_COMPARE_OP_INT,
+    &&TARGET_COMPARE_OP_INT_FLOAT,
     &&TARGET_COMPARE_OP_STR,
     &&TARGET_CONTAINS_OP_DICT,
     &&TARGET_CONTAINS_OP_SET,
+    &&TARGET_CONTAINS_OP_STR_TUPLE,
+    &&TARGET_FORMAT_SIMPLE_FLOAT,
+    &&TARGET_FORMAT_SIMPLE_INT,
+    &&TARGET_FORMAT_SIMPLE_STR,
+    &&TARGET_FORMAT_WITH_SPEC_FLOAT,
+    &&TARGET_FORMAT_WITH_SPEC_INT,
+    &&TARGET_FORMAT_WITH_SPEC_STR,
+    &&TARGET_FOR_ITER_DICT_ITEMS,
+    &&TARGET_FOR_ITER_ENUMERATE,
     &&TARGET_FOR_ITER_GEN,
     &&TARGET_FOR_ITER_LIST,
     &&TARGET_FOR_ITER_RANGE,
+    &&TARGET_FOR_ITER_REVERSED_LIST,
     &&TARGET_FOR_ITER_TUPLE,
     &&TARGET_JUMP_BACKWARD_JIT,
     &&TARGET_JUMP_BACKWARD_NO_JIT,
@@ -180,6 +193,7 @@ static void *opcode_targets[256] = {
     &&TARGET_LOAD_ATTR_CLASS_WITH_METACLASS_CHECK,
     &&TARGET_LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN,
     &&TARGET_LOAD_ATTR_INSTANCE_VALUE,
+    &&TARGET_LOAD_ATTR_INSTANCE_VALUE_POLY,
     &&TARGET_LOAD_ATTR_METHOD_LAZY_DICT,
     &&TARGET_LOAD_ATTR_METHOD_NO_DICT,
     &&TARGET_LOAD_ATTR_METHOD_WITH_VALUES,
@@ -198,6 +212,8 @@ static void *opcode_targets[256] = {
     &&TARGET_RESUME_CHECK,
     &&TARGET_SEND_GEN,
     &&TARGET_STORE_ATTR_INSTANCE_VALUE,
+    &&TARGET_STORE_ATTR_PROPERTY,
+    &&TARGET_STORE_ATTR_SETATTR_OVERRIDDEN,
     &&TARGET_STORE_ATTR_SLOT,
     &&TARGET_STORE_ATTR_WITH_HINT,
     &&TARGET_STORE_SUBSCR_DICT,
@@ -218,22 +234,6 @@ static void *opcode_targets[256] = {
     &&_unknown_opcode,
     &&_unknown_opcode,
     &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
     &&TARGET_INSTRUMENTED_END_FOR,
     &&TARGET_INSTRUMENTED_POP_ITER,
     &&TARGET_INSTRUMENTED_END_SEND,
@@ -300,6 +300,7 @@ Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CALL_BUILTIN_CLASS(TAIL_CALL_PAR
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CALL_BUILTIN_FAST(TAIL_CALL_PARAMS);
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CALL_BUILTIN_FAST_WITH_KEYWORDS(TAIL_CALL_PARAMS);
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CALL_BUILTIN_O(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CALL_DUNDER_CALL(TAIL_CALL_PARAMS);
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CALL_FUNCTION_EX(TAIL_CALL_PARAMS);
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CALL_INTRINSIC_1(TAIL_CALL_PARAMS);
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CALL_INTRINSIC_2(TAIL_CALL_PARAMS);
@@ -325,11 +326,14 @@ Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CHECK_EXC_MATCH(TAIL_CALL_PARAMS
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CLEANUP_THROW(TAIL_CALL_PARAMS);
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_COMPARE_OP(TAIL_CALL_PARAMS);
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_COMPARE_OP_FLOAT(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_COMPARE_OP_FLOAT_INT(TAIL_CALL_PARAMS);
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_COMPARE_OP_INT(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_COMPARE_OP_INT_FLOAT(TAIL_CALL_PARAMS);
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_COMPARE_OP_STR(TAIL_CALL_PARAMS);
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CONTAINS_OP(TAIL_CALL_PARAMS);
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CONTAINS_OP_DICT(TAIL_CALL_PARAMS);
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CONTAINS_OP_SET(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CONTAINS_OP_STR_TUPLE(TAIL_CALL_PARAMS);
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_CONVERT_VALUE(TAIL_CALL_PARAMS);
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_COPY(TAIL_CALL_PARAMS);
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_COPY_FREE_VARS(TAIL_CALL_PARAMS);
@@ -348,11 +352,20 @@ Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_ENTER_EXECUTOR(TAIL_CALL_PARAMS)
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_EXIT_INIT_CHECK(TAIL_CALL_PARAMS);
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_EXTENDED_ARG(TAIL_CALL_PARAMS);
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_FORMAT_SIMPLE(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_FORMAT_SIMPLE_FLOAT(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_FORMAT_SIMPLE_INT(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_FORMAT_SIMPLE_STR(TAIL_CALL_PARAMS);
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_FORMAT_WITH_SPEC(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_FORMAT_WITH_SPEC_FLOAT(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_FORMAT_WITH_SPEC_INT(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_FORMAT_WITH_SPEC_STR(TAIL_CALL_PARAMS);
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_FOR_ITER(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_FOR_ITER_DICT_ITEMS(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_FOR_ITER_ENUMERATE(TAIL_CALL_PARAMS);
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_FOR_ITER_GEN(TAIL_CALL_PARAMS);
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_FOR_ITER_LIST(TAIL_CALL_PARAMS);
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_FOR_ITER_RANGE(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_FOR_ITER_REVERSED_LIST(TAIL_CALL_PARAMS);
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_FOR_ITER_TUPLE(TAIL_CALL_PARAMS);
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_GET_AITER(TAIL_CALL_PARAMS);
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_GET_ANEXT(TAIL_CALL_PARAMS);
@@ -397,6 +410,7 @@ Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_LOAD_ATTR_CLASS(TAIL_CALL_PARAMS
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_LOAD_ATTR_CLASS_WITH_METACLASS_CHECK(TAIL_CALL_PARAMS);
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN(TAIL_CALL_PARAMS);
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_LOAD_ATTR_INSTANCE_VALUE(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_LOAD_ATTR_INSTANCE_VALUE_POLY(TAIL_CALL_PARAMS);
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_LOAD_ATTR_METHOD_LAZY_DICT(TAIL_CALL_PARAMS);
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_LOAD_ATTR_METHOD_NO_DICT(TAIL_CALL_PARAMS);
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_LOAD_ATTR_METHOD_WITH_VALUES(TAIL_CALL_PARAMS);
@@ -463,6 +477,8 @@ Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_SET_FUNCTION_ATTRIBUTE(TAIL_CALL
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_SET_UPDATE(TAIL_CALL_PARAMS);
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_STORE_ATTR(TAIL_CALL_PARAMS);
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_STORE_ATTR_INSTANCE_VALUE(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_STORE_ATTR_PROPERTY(TAIL_CALL_PARAMS);
+Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_STORE_ATTR_SETATTR_OVERRIDDEN(TAIL_CALL_PARAMS);
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_STORE_ATTR_SLOT(TAIL_CALL_PARAMS);
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_STORE_ATTR_WITH_HINT(TAIL_CALL_PARAMS);
 Py_PRESERVE_NONE_CC static PyObject *_TAIL_CALL_STORE_DEREF(TAIL_CALL_PARAMS);
@@ -536,6 +552,7 @@ static py_tail_call_funcptr INSTRUCTION_TABLE[256] = {
     [CALL_BUILTIN_FAST] = _TAIL_CALL_CALL_BUILTIN_FAST,
     [CALL_BUILTIN_FAST_WITH_KEYWORDS] = _TAIL_CALL_CALL_BUILTIN_FAST_WITH_KEYWORDS,
     [CALL_BUILTIN_O] = _TAIL_CALL_CALL_BUILTIN_O,
+    [CALL_DUNDER_CALL] = _TAIL_CALL_CALL_DUNDER_CALL,
     [CALL_FUNCTION_EX] = _TAIL_CALL_CALL_FUNCTION_EX,
     [CALL_INTRINSIC_1] = _TAIL_CALL_CALL_INTRINSIC_1,
     [CALL_INTRINSIC_2] = _TAIL_CALL_CALL_INTRINSIC_2,
@@ -561,11 +578,14 @@ static py_tail_call_funcptr INSTRUCTION_TABLE[256] = {
     [CLEANUP_THROW] = _TAIL_CALL_CLEANUP_THROW,
     [COMPARE_OP] = _TAIL_CALL_COMPARE_OP,
     [COMPARE_OP_FLOAT] = _TAIL_CALL_COMPARE_OP_FLOAT,
+    [COMPARE_OP_FLOAT_INT] = _TAIL_CALL_COMPARE_OP_FLOAT_INT,
     [COMPARE_OP_INT] = _TAIL_CALL_COMPARE_OP_INT,
+    [COMPARE_OP_INT_FLOAT] = _TAIL_CALL_COMPARE_OP_INT_FLOAT,
     [COMPARE_OP_STR] = _TAIL_CALL_COMPARE_OP_STR,
     [CONTAINS_OP] = _TAIL_CALL_CONTAINS_OP,
     [CONTAINS_OP_DICT] = _TAIL_CALL_CONTAINS_OP_DICT,
     [CONTAINS_OP_SET] = _TAIL_CALL_CONTAINS_OP_SET,
+    [CONTAINS_OP_STR_TUPLE] = _TAIL_CALL_CONTAINS_OP_STR_TUPLE,
     [CONVERT_VALUE] = _TAIL_CALL_CONVERT_VALUE,
     [COPY] = _TAIL_CALL_COPY,
     [COPY_FREE_VARS] = _TAIL_CALL_COPY_FREE_VARS,
@@ -584,11 +604,20 @@ static py_tail_call_funcptr INSTRUCTION_TABLE[256] = {
     [EXIT_INIT_CHECK] = _TAIL_CALL_EXIT_INIT_CHECK,
     [EXTENDED_ARG] = _TAIL_CALL_EXTENDED_ARG,
     [FORMAT_SIMPLE] = _TAIL_CALL_FORMAT_SIMPLE,
+    [FORMAT_SIMPLE_FLOAT] = _TAIL_CALL_FORMAT_SIMPLE_FLOAT,
+    [FORMAT_SIMPLE_INT] = _TAIL_CALL_FORMAT_SIMPLE_INT,
+    [FORMAT_SIMPLE_STR] = _TAIL_CALL_FORMAT_SIMPLE_STR,
     [FORMAT_WITH_SPEC] = _TAIL_CALL_FORMAT_WITH_SPEC,
+    [FORMAT_WITH_SPEC_FLOAT] = _TAIL_CALL_FORMAT_WITH_SPEC_FLOAT,
+    [FORMAT_WITH_SPEC_INT] = _TAIL_CALL_FORMAT_WITH_SPEC_INT,
+    [FORMAT_WITH_SPEC_STR] = _TAIL_CALL_FORMAT_WITH_SPEC_STR,
     [FOR_ITER] = _TAIL_CALL_FOR_ITER,
+    [FOR_ITER_DICT_ITEMS] = _TAIL_CALL_FOR_ITER_DICT_ITEMS,
+    [FOR_ITER_ENUMERATE] = _TAIL_CALL_FOR_ITER_ENUMERATE,
     [FOR_ITER_GEN] = _TAIL_CALL_FOR_ITER_GEN,
     [FOR_ITER_LIST] = _TAIL_CALL_FOR_ITER_LIST,
     [FOR_ITER_RANGE] = _TAIL_CALL_FOR_ITER_RANGE,
+    [FOR_ITER_REVERSED_LIST] = _TAIL_CALL_FOR_ITER_REVERSED_LIST,
     [FOR_ITER_TUPLE] = _TAIL_CALL_FOR_ITER_TUPLE,
     [GET_AITER] = _TAIL_CALL_GET_AITER,
     [GET_ANEXT] = _TAIL_CALL_GET_ANEXT,
@@ -633,6 +662,7 @@ static py_tail_call_funcptr INSTRUCTION_TABLE[256] = {
     [LOAD_ATTR_CLASS_WITH_METACLASS_CHECK] = _TAIL_CALL_LOAD_ATTR_CLASS_WITH_METACLASS_CHECK,
     [LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN] = _TAIL_CALL_LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN,
     [LOAD_ATTR_INSTANCE_VALUE] = _TAIL_CALL_LOAD_ATTR_INSTANCE_VALUE,
+    [LOAD_ATTR_INSTANCE_VALUE_POLY] = _TAIL_CALL_LOAD_ATTR_INSTANCE_VALUE_POLY,
     [LOAD_ATTR_METHOD_LAZY_DICT] = _TAIL_CALL_LOAD_ATTR_METHOD_LAZY_DICT,
     [LOAD_ATTR_METHOD_NO_DICT] = _TAIL_CALL_LOAD_ATTR_METHOD_NO_DICT,
     [LOAD_ATTR_METHOD_WITH_VALUES] = _TAIL_CALL_LOAD_ATTR_METHOD_WITH_VALUES,
@@ -699,6 +729,8 @@ static py_tail_call_funcptr INSTRUCTION_TABLE[256] = {
     [SET_UPDATE] = _TAIL_CALL_SET_UPDATE,
     [STORE_ATTR] = _TAIL_CALL_STORE_ATTR,
     [STORE_ATTR_INSTANCE_VALUE] = _TAIL_CALL_STORE_ATTR_INSTANCE_VALUE,
+    [STORE_ATTR_PROPERTY] = _TAIL_CALL_STORE_ATTR_PROPERTY,
+    [STORE_ATTR_SETATTR_OVERRIDDEN] = _TAIL_CALL_STORE_ATTR_SETATTR_OVERRIDDEN,
     [STORE_ATTR_SLOT] = _TAIL_CALL_STORE_ATTR_SLOT,
     [STORE_ATTR_WITH_HINT] = _TAIL_CALL_STORE_ATTR_WITH_HINT,
     [STORE_DEREF] = _TAIL_CALL_STORE_DEREF,
@@ -738,22 +770,6 @@ static py_tail_call_funcptr INSTRUCTION_TABLE[256] = {
     [125] = _TAIL_CALL_UNKNOWN_OPCODE,
     [126] = _TAIL_CALL_UNKNOWN_OPCODE,
     [127] = _TAIL_CALL_UNKNOWN_OPCODE,
-    [211] = _TAIL_CALL_UNKNOWN_OPCODE,
-    [212] = _TAIL_CALL_UNKNOWN_OPCODE,
-    [213] = _TAIL_CALL_UNKNOWN_OPCODE,
-    [214] = _TAIL_CALL_UNKNOWN_OPCODE,
-    [215] = _TAIL_CALL_UNKNOWN_OPCODE,
-    [216] = _TAIL_CALL_UNKNOWN_OPCODE,
-    [217] = _TAIL_CALL_UNKNOWN_OPCODE,
-    [218] = _TAIL_CALL_UNKNOWN_OPCODE,
-    [219] = _TAIL_CALL_UNKNOWN_OPCODE,
-    [220] = _TAIL_CALL_UNKNOWN_OPCODE,
-    [221] = _TAIL_CALL_UNKNOWN_OPCODE,
-    [222] = _TAIL_CALL_UNKNOWN_OPCODE,
-    [223] = _TAIL_CALL_UNKNOWN_OPCODE,
-    [224] = _TAIL_CALL_UNKNOWN_OPCODE,
-    [225] = _TAIL_CALL_UNKNOWN_OPCODE,
-    [226] = _TAIL_CALL_UNKNOWN_OPCODE,
     [227] = _TAIL_CALL_UNKNOWN_OPCODE,
     [228] = _TAIL_CALL_UNKNOWN_OPCODE,
     [229] = _TAIL_CALL_UNKNOWN_OPCODE,
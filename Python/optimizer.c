@@ -99,7 +99,8 @@ insert_executor(PyCodeObject *code, _Py_CODEUNIT *instr, int index, _PyExecutorO
 }
 
 static _PyExecutorObject *
-make_executor_from_uops(_PyUOpInstruction *buffer, int length, const _PyBloomFilter *dependencies);
+make_executor_from_uops(_PyUOpInstruction *buffer, int length, const _PyBloomFilter *dependencies,
+                        PyCodeObject *code);
 
 static int
 uop_optimize(_PyInterpreterFrame *frame, _Py_CODEUNIT *instr,
@@ -213,6 +214,7 @@ uop_dealloc(PyObject *op) {
 #ifdef _Py_JIT
     _PyJIT_Free(self);
 #endif
+    Py_XDECREF(self->exit_locations);
     PyObject_GC_Del(self);
 }
 
@@ -374,6 +376,17 @@ _PyUOp_Replacements[MAX_UOP_ID + 1] = {
     [_ITER_JUMP_TUPLE] = _GUARD_NOT_EXHAUSTED_TUPLE,
     [_FOR_ITER] = _FOR_ITER_TIER_TWO,
     [_ITER_NEXT_LIST] = _ITER_NEXT_LIST_TIER_TWO,
+    [_ITER_JUMP_REVERSED_LIST] = _GUARD_NOT_EXHAUSTED_REVERSED_LIST,
+    [_ITER_NEXT_DICT_ITEMS] = _ITER_NEXT_DICT_ITEMS_TIER_TWO,
+    [_ITER_NEXT_ENUMERATE] = _ITER_NEXT_ENUMERATE_TIER_TWO,
+};
+
+/* Used when a FOR_ITER that produces 2-tuples is immediately followed by
+ * UNPACK_SEQUENCE 2: the pair is pushed directly, and the unpack skipped. */
+static const uint16_t
+unpack_two_replacements[MAX_UOP_ID + 1] = {
+    [_ITER_NEXT_DICT_ITEMS_TIER_TWO] = _ITER_NEXT_DICT_ITEMS_UNPACK,
+    [_ITER_NEXT_ENUMERATE_TIER_TWO] = _ITER_NEXT_ENUMERATE_UNPACK,
 };
 
 static const uint8_t
@@ -381,7 +394,12 @@ is_for_iter_test[MAX_UOP_ID + 1] = {
     [_GUARD_NOT_EXHAUSTED_RANGE] = 1,
     [_GUARD_NOT_EXHAUSTED_LIST] = 1,
     [_GUARD_NOT_EXHAUSTED_TUPLE] = 1,
+    [_GUARD_NOT_EXHAUSTED_REVERSED_LIST] = 1,
     [_FOR_ITER_TIER_TWO] = 1,
+    [_ITER_NEXT_DICT_ITEMS_TIER_TWO] = 1,
+    [_ITER_NEXT_DICT_ITEMS_UNPACK] = 1,
+    [_ITER_NEXT_ENUMERATE_TIER_TWO] = 1,
+    [_ITER_NEXT_ENUMERATE_UNPACK] = 1,
 };
 
 static const uint16_t
@@ -458,11 +476,16 @@ add_to_trace(
 // Reserve space for N uops, plus 3 for _SET_IP, _CHECK_VALIDITY and _EXIT_TRACE
 #define RESERVE(needed) RESERVE_RAW((needed) + 3, _PyUOpName(opcode))
 
+// Count a trace that is given up on, for sys._jit.get_abandoned()
+#define ABANDON(REASON) \
+    _PyInterpreterState_GET()->trace_abandoned[(REASON)]++
+
 // Trace stack operations (used by _PUSH_FRAME, _RETURN_VALUE)
 #define TRACE_STACK_PUSH() \
     if (trace_stack_depth >= TRACE_STACK_SIZE) { \
         DPRINTF(2, "Trace stack overflow\n"); \
         OPT_STAT_INC(trace_stack_overflow); \
+        ABANDON(_PY_TRACE_ABANDON_STACK_OVERFLOW); \
         return 0; \
     } \
     assert(func == NULL || func->func_code == (PyObject *)code); \
@@ -510,6 +533,8 @@ translate_bytecode_to_trace(
     int trace_stack_depth = 0;
     int confidence = CONFIDENCE_RANGE;  // Adjusted by branch instructions
     bool jump_seen = false;
+    // Reported if the trace ends before any instruction is translated
+    _PyTraceAbandonReason stop_reason = _PY_TRACE_ABANDON_NO_PROGRESS;
 
 #ifdef Py_DEBUG
     char *python_lltrace = Py_GETENV("PYTHON_LLTRACE");
@@ -682,6 +707,7 @@ translate_bytecode_to_trace(
                         if (trace_stack_depth == 0) {
                             DPRINTF(2, "Trace stack underflow\n");
                             OPT_STAT_INC(trace_stack_underflow);
+                            ABANDON(_PY_TRACE_ABANDON_STACK_UNDERFLOW);
                             return 0;
                         }
                     }
@@ -726,6 +752,17 @@ translate_bytecode_to_trace(
                                     assert(_Py_GetBaseCodeUnit(code, jump_target+1).op.code == POP_ITER);
                                 }
 #endif
+                                if (unpack_two_replacements[uop]) {
+                                    assert(i + 1 == nuops);
+                                    _Py_CODEUNIT *next_instr = instr + 1 + _PyOpcode_Caches[_PyOpcode_Deopt[opcode]];
+                                    if (_PyOpcode_Deopt[next_instr->op.code] == UNPACK_SEQUENCE &&
+                                        next_instr->op.arg == 2)
+                                    {
+                                        uop = unpack_two_replacements[uop];
+                                        // Skip the UNPACK_SEQUENCE:
+                                        instr += 1 + INLINE_CACHE_ENTRIES_UNPACK_SEQUENCE;
+                                    }
+                                }
                                 break;
                             case OPERAND1_1:
                                 assert(trace[trace_length-1].opcode == uop);
@@ -780,10 +817,12 @@ translate_bytecode_to_trace(
                             if (opcode == FOR_ITER_GEN ||
                                 opcode == LOAD_ATTR_PROPERTY ||
                                 opcode == BINARY_OP_SUBSCR_GETITEM ||
+                                opcode == CALL_DUNDER_CALL ||
                                 opcode == SEND_GEN)
                             {
                                 DPRINTF(2, "Bailing due to dynamic target\n");
                                 OPT_STAT_INC(unknown_callee);
+                                ABANDON(_PY_TRACE_ABANDON_UNKNOWN_CALLEE);
                                 return 0;
                             }
                             assert(_PyOpcode_Deopt[opcode] == CALL || _PyOpcode_Deopt[opcode] == CALL_KW);
@@ -851,6 +890,7 @@ translate_bytecode_to_trace(
                             }
                             DPRINTF(2, "Bail, new_code == NULL\n");
                             OPT_STAT_INC(unknown_callee);
+                            ABANDON(_PY_TRACE_ABANDON_UNKNOWN_CALLEE);
                             return 0;
                         }
 
@@ -870,6 +910,7 @@ translate_bytecode_to_trace(
                 }
                 DPRINTF(2, "Unsupported opcode %s\n", _PyOpcode_OpName[opcode]);
                 OPT_UNSUPPORTED_OPCODE(opcode);
+                stop_reason = _PY_TRACE_ABANDON_UNSUPPORTED_OPCODE;
                 goto done;  // Break out of loop
             }  // End default
 
@@ -896,6 +937,7 @@ translate_bytecode_to_trace(
     // Skip short traces where we can't even translate a single instruction:
     if (first) {
         OPT_STAT_INC(trace_too_short);
+        ABANDON(stop_reason);
         DPRINTF(2,
                 "No trace for %s (%s:%d) at byte offset %d (no progress)\n",
                 PyUnicode_AsUTF8(code->co_qualname),
@@ -922,6 +964,7 @@ translate_bytecode_to_trace(
 
 #undef RESERVE
 #undef RESERVE_RAW
+#undef ABANDON
 #undef INSTR_IP
 #undef ADD_TO_TRACE
 #undef DPRINTF
@@ -1026,7 +1069,8 @@ prepare_for_execution(_PyUOpInstruction *buffer, int length)
         if (opcode == _JUMP_TO_TOP) {
             assert(buffer[0].opcode == _START_EXECUTOR);
             buffer[i].format = UOP_FORMAT_JUMP;
-            buffer[i].jump_target = 1;
+            /* Skip any loop-invariant guards hoisted by the optimizer */
+            buffer[i].jump_target = 1 + buffer[i].oparg;
         }
     }
     return next_spare;
@@ -1045,6 +1089,92 @@ allocate_executor(int exit_count, int length)
     res->trace = (_PyUOpInstruction *)(res->exits + exit_count);
     res->code_size = length;
     res->exit_count = exit_count;
+    res->exit_locations = NULL;
+    return res;
+}
+
+static PyObject *
+code_location(PyCodeObject *code)
+{
+    if (code == NULL) {
+        return Py_NewRef(Py_None);
+    }
+    return Py_BuildValue("(OOi)", code->co_qualname, code->co_filename,
+                         code->co_firstlineno);
+}
+
+/* Returns a tuple with the location of the code object that each
+ * _EXIT_TRACE in the buffer returns to, in the order of the exits.
+ * A trace that follows calls and returns passes through several code
+ * objects, so this is worked out from the _PUSH_FRAME and _RETURN_VALUE
+ * operands while they are known to be alive. Their code objects are not
+ * kept alive by the executor, so only their locations are stored. */
+static PyObject *
+make_exit_locations(_PyUOpInstruction *buffer, int length, int exit_count,
+                    PyCodeObject *initial_code)
+{
+    PyCodeObject *stub_code[UOP_MAX_TRACE_LENGTH];
+    bool stub_seen[UOP_MAX_TRACE_LENGTH] = { false };
+    PyCodeObject *code = initial_code;
+    for (int i = 0; i < length; i++) {
+        _PyUOpInstruction *inst = &buffer[i];
+        switch (inst->opcode) {
+            case _PUSH_FRAME:
+            case _RETURN_VALUE:
+            case _RETURN_GENERATOR:
+            case _YIELD_VALUE:
+                /* Set by translate_bytecode_to_trace() to the function
+                 * or code object (with the low bit set) being entered */
+                if (inst->operand0 == 0) {
+                    code = NULL;
+                }
+                else if (inst->operand0 & 1) {
+                    code = (PyCodeObject *)(inst->operand0 & ~1);
+                }
+                else {
+                    PyFunctionObject *func = (PyFunctionObject *)inst->operand0;
+                    code = (PyCodeObject *)func->func_code;
+                }
+                break;
+            case _EXIT_TRACE:
+                stub_code[i] = code;
+                stub_seen[i] = true;
+                break;
+        }
+        if (inst->format == UOP_FORMAT_JUMP && !stub_seen[inst->jump_target]) {
+            stub_code[inst->jump_target] = code;
+            stub_seen[inst->jump_target] = true;
+        }
+        if (is_terminator(inst)) {
+            break;
+        }
+    }
+    PyObject *res = PyTuple_New(exit_count);
+    if (res == NULL) {
+        return NULL;
+    }
+    int next_exit = 0;
+    PyCodeObject *last_code = NULL;
+    PyObject *last_location = NULL;
+    for (int i = 0; i < length; i++) {
+        if (buffer[i].opcode != _EXIT_TRACE) {
+            continue;
+        }
+        code = stub_seen[i] ? stub_code[i] : NULL;
+        if (last_location == NULL || code != last_code) {
+            last_code = code;
+            last_location = code_location(code);
+            if (last_location == NULL) {
+                Py_DECREF(res);
+                return NULL;
+            }
+        }
+        else {
+            Py_INCREF(last_location);
+        }
+        PyTuple_SET_ITEM(res, next_exit++, last_location);
+    }
+    assert(next_exit == exit_count);
     return res;
 }
 
@@ -1115,19 +1245,30 @@ sanity_check(_PyExecutorObject *executor)
  * and not a NOP.
  */
 static _PyExecutorObject *
-make_executor_from_uops(_PyUOpInstruction *buffer, int length, const _PyBloomFilter *dependencies)
+make_executor_from_uops(_PyUOpInstruction *buffer, int length, const _PyBloomFilter *dependencies,
+                        PyCodeObject *code)
 {
     int exit_count = count_exits(buffer, length);
+    PyObject *exit_locations = make_exit_locations(buffer, length, exit_count, code);
+    if (exit_locations == NULL) {
+        return NULL;
+    }
     _PyExecutorObject *executor = allocate_executor(exit_count, length);
     if (executor == NULL) {
+        Py_DECREF(exit_locations);
         return NULL;
     }
+    executor->exit_locations = exit_locations;
 
     /* Initialize exits */
+    PyInterpreterState *interp = _PyInterpreterState_GET();
     for (int i = 0; i < exit_count; i++) {
         executor->exits[i].executor = NULL;
-        executor->exits[i].temperature = initial_temperature_backoff_counter();
+        executor->exits[i].temperature = initial_temperature_backoff_counter(&interp->warmup);
+        executor->exits[i].hit_count = 0;
     }
+    executor->run_count = 0;
+    executor->deopt_count = 0;
     int next_exit = exit_count-1;
     _PyUOpInstruction *dest = (_PyUOpInstruction *)&executor->trace[length];
     assert(buffer[0].opcode == _START_EXECUTOR);
@@ -1171,6 +1312,7 @@ make_executor_from_uops(_PyUOpInstruction *buffer, int length, const _PyBloomFil
     // This is initialized to true so we can prevent the executor
     // from being immediately detected as cold and invalidated.
     executor->vm_data.warm = true;
+    // This fails without an exception if there's no room left for the code:
     if (_PyJIT_Compile(executor, executor->trace, length)) {
         Py_DECREF(executor);
         return NULL;
@@ -1224,6 +1366,9 @@ uop_optimize(
         length = _Py_uop_analyze_and_optimize(frame, buffer,
                                            length,
                                            curr_stackentries, &dependencies);
+        if (length == 0) {
+            _PyInterpreterState_GET()->trace_abandoned[_PY_TRACE_ABANDON_OPTIMIZER]++;
+        }
         if (length <= 0) {
             return length;
         }
@@ -1246,9 +1391,10 @@ uop_optimize(
     OPT_HIST(effective_trace_length(buffer, length), optimized_trace_length_hist);
     length = prepare_for_execution(buffer, length);
     assert(length <= UOP_MAX_TRACE_LENGTH);
-    _PyExecutorObject *executor = make_executor_from_uops(buffer, length,  &dependencies);
+    _PyExecutorObject *executor = make_executor_from_uops(buffer, length, &dependencies,
+                                                          _PyFrame_GetCode(frame));
     if (executor == NULL) {
-        return -1;
+        return PyErr_Occurred() ? -1 : 0;
     }
     assert(length <= UOP_MAX_TRACE_LENGTH);
     *exec_ptr = executor;
@@ -1419,6 +1565,13 @@ _Py_ExecutorDetach(_PyExecutorObject *executor)
     assert(code->co_executors->executors[index] == executor);
     instruction->op.code = executor->vm_data.opcode;
     instruction->op.arg = executor->vm_data.oparg;
+    if (_PyOpcode_Deopt[executor->vm_data.opcode] == JUMP_BACKWARD &&
+        !is_unreachable_backoff_counter(instruction[1].counter))
+    {
+        // Back off further before tracing this loop again, so that loops
+        // whose executors keep being invalidated are retraced less often:
+        instruction[1].counter = restart_backoff_counter(instruction[1].counter);
+    }
     executor->vm_data.code = NULL;
     code->co_executors->executors[index] = NULL;
     Py_DECREF(executor);
@@ -1674,6 +1827,223 @@ _PyDumpExecutors(FILE *out)
     return 0;
 }
 
+static int
+set_profile_item(PyObject *dict, const char *key, PyObject *value)
+{
+    if (value == NULL) {
+        return -1;
+    }
+    int err = PyDict_SetItemString(dict, key, value);
+    Py_DECREF(value);
+    return err;
+}
+
+/* Returns a tuple of the names of the uops in the main trace that jump
+ * to the stub at index `stub`. */
+static PyObject *
+exit_reasons(_PyExecutorObject *executor, uint32_t main_length, uint32_t stub)
+{
+    PyObject *reasons = PyList_New(0);
+    if (reasons == NULL) {
+        return NULL;
+    }
+    for (uint32_t i = 0; i < main_length; i++) {
+        const _PyUOpInstruction *inst = &executor->trace[i];
+        if (inst->format != UOP_FORMAT_JUMP || inst->jump_target != stub) {
+            continue;
+        }
+        PyObject *name = PyUnicode_FromString(_PyOpcode_uop_name[inst->opcode]);
+        if (name == NULL || PyList_Append(reasons, name) < 0) {
+            Py_XDECREF(name);
+            Py_DECREF(reasons);
+            return NULL;
+        }
+        Py_DECREF(name);
+    }
+    PyObject *res = PyList_AsTuple(reasons);
+    Py_DECREF(reasons);
+    return res;
+}
+
+static PyObject *
+exit_profile(_PyExecutorObject *executor, uint32_t main_length, uint32_t index)
+{
+    const _PyExitData *exit = (const _PyExitData *)executor->trace[index].operand0;
+    PyObject *location = Py_None;
+    if (executor->exit_locations != NULL) {
+        location = PyTuple_GET_ITEM(executor->exit_locations, exit - executor->exits);
+    }
+    PyObject *res = PyDict_New();
+    if (res == NULL) {
+        return NULL;
+    }
+    /* The target is an offset into the code object the exit is in,
+     * which is not the executor's own code object if the trace has
+     * followed a call or a return. */
+    bool known = location != Py_None;
+    if (set_profile_item(res, "qualname", Py_NewRef(known ?
+            PyTuple_GET_ITEM(location, 0) : Py_None)) < 0 ||
+        set_profile_item(res, "filename", Py_NewRef(known ?
+            PyTuple_GET_ITEM(location, 1) : Py_None)) < 0 ||
+        set_profile_item(res, "firstlineno", Py_NewRef(known ?
+            PyTuple_GET_ITEM(location, 2) : Py_None)) < 0 ||
+        set_profile_item(res, "target",
+            PyLong_FromUnsignedLong(exit->target * sizeof(_Py_CODEUNIT))) < 0 ||
+        set_profile_item(res, "hits",
+            PyLong_FromUnsignedLongLong(exit->hit_count)) < 0 ||
+        set_profile_item(res, "linked",
+            PyBool_FromLong(exit->executor != NULL)) < 0 ||
+        set_profile_item(res, "reasons",
+            exit_reasons(executor, main_length, index)) < 0)
+    {
+        Py_DECREF(res);
+        return NULL;
+    }
+    return res;
+}
+
+static PyObject *
+executor_profile(_PyExecutorObject *executor)
+{
+    PyObject *res = NULL, *uops = NULL, *exits = NULL, *deopt_reasons = NULL;
+    /* The main trace runs up to the first terminator; the exit and error
+     * stubs follow it. */
+    uint32_t main_length = 0;
+    while (main_length < executor->code_size) {
+        if (is_terminator(&executor->trace[main_length++])) {
+            break;
+        }
+    }
+    uops = PyTuple_New(main_length);
+    exits = PyList_New(0);
+    deopt_reasons = PyList_New(0);
+    if (uops == NULL || exits == NULL || deopt_reasons == NULL) {
+        goto error;
+    }
+    for (uint32_t i = 0; i < main_length; i++) {
+        const char *name = _PyOpcode_uop_name[executor->trace[i].opcode];
+        PyObject *oname = PyUnicode_FromString(name);
+        if (oname == NULL) {
+            goto error;
+        }
+        PyTuple_SET_ITEM(uops, i, oname);
+    }
+    for (uint32_t i = main_length - 1; i < executor->code_size; i++) {
+        int opcode = executor->trace[i].opcode;
+        PyObject *item;
+        if (opcode == _EXIT_TRACE) {
+            item = exit_profile(executor, main_length, i);
+            if (item == NULL || PyList_Append(exits, item) < 0) {
+                Py_XDECREF(item);
+                goto error;
+            }
+            Py_DECREF(item);
+        }
+        else if (opcode == _DEOPT) {
+            item = exit_reasons(executor, main_length, i);
+            if (item == NULL) {
+                goto error;
+            }
+            Py_ssize_t n = PyList_GET_SIZE(deopt_reasons);
+            int err = PyList_SetSlice(deopt_reasons, n, n, item);
+            Py_DECREF(item);
+            if (err < 0) {
+                goto error;
+            }
+        }
+    }
+    res = PyDict_New();
+    if (res == NULL) {
+        goto error;
+    }
+    PyCodeObject *code = executor->vm_data.code;
+    size_t jit_size = 0;
+#ifdef _Py_JIT
+    jit_size = executor->jit_size;
+#endif
+    if (set_profile_item(res, "code",
+            Py_NewRef(code == NULL ? Py_None : (PyObject *)code)) < 0 ||
+        set_profile_item(res, "offset", code == NULL ? Py_NewRef(Py_None) :
+            PyLong_FromLong(executor->vm_data.index * sizeof(_Py_CODEUNIT))) < 0 ||
+        set_profile_item(res, "valid",
+            PyBool_FromLong(executor->vm_data.valid)) < 0 ||
+        set_profile_item(res, "runs",
+            PyLong_FromUnsignedLongLong(executor->run_count)) < 0 ||
+        set_profile_item(res, "deopts",
+            PyLong_FromUnsignedLongLong(executor->deopt_count)) < 0 ||
+        set_profile_item(res, "uops", Py_NewRef(uops)) < 0 ||
+        set_profile_item(res, "exits", Py_NewRef(exits)) < 0 ||
+        set_profile_item(res, "deopt_reasons",
+            PyList_AsTuple(deopt_reasons)) < 0 ||
+        set_profile_item(res, "jit_size", PyLong_FromSize_t(jit_size)) < 0)
+    {
+        goto error;
+    }
+    Py_DECREF(uops);
+    Py_DECREF(exits);
+    Py_DECREF(deopt_reasons);
+    return res;
+error:
+    Py_XDECREF(res);
+    Py_XDECREF(uops);
+    Py_XDECREF(exits);
+    Py_XDECREF(deopt_reasons);
+    return NULL;
+}
+
+static const char *const trace_abandon_names[_PY_TRACE_ABANDON_COUNT] = {
+    [_PY_TRACE_ABANDON_NO_PROGRESS] = "no_progress",
+    [_PY_TRACE_ABANDON_UNSUPPORTED_OPCODE] = "unsupported_opcode",
+    [_PY_TRACE_ABANDON_UNKNOWN_CALLEE] = "unknown_callee",
+    [_PY_TRACE_ABANDON_STACK_OVERFLOW] = "trace_stack_overflow",
+    [_PY_TRACE_ABANDON_STACK_UNDERFLOW] = "trace_stack_underflow",
+    [_PY_TRACE_ABANDON_OPTIMIZER] = "optimizer",
+};
+
+/* Returns a dict mapping each reason for giving up on a trace to the
+ * number of traces abandoned for it. */
+PyObject *
+_PyGetAbandonedTraces(void)
+{
+    PyInterpreterState *interp = PyInterpreterState_Get();
+    PyObject *res = PyDict_New();
+    if (res == NULL) {
+        return NULL;
+    }
+    for (int i = 0; i < _PY_TRACE_ABANDON_COUNT; i++) {
+        if (set_profile_item(res, trace_abandon_names[i],
+                PyLong_FromUnsignedLongLong(interp->trace_abandoned[i])) < 0)
+        {
+            Py_DECREF(res);
+            return NULL;
+        }
+    }
+    return res;
+}
+
+/* Returns a list with one dict per live executor, describing its trace
+ * and how often it, and each of its exits, have run. */
+PyObject *
+_PyGetExecutorProfiles(void)
+{
+    PyInterpreterState *interp = PyInterpreterState_Get();
+    PyObject *res = PyList_New(0);
+    if (res == NULL) {
+        return NULL;
+    }
+    for (_PyExecutorObject *exec = interp->executor_list_head; exec != NULL;) {
+        PyObject *profile = executor_profile(exec);
+        if (profile == NULL || PyList_Append(res, profile) < 0) {
+            Py_XDECREF(profile);
+            Py_DECREF(res);
+            return NULL;
+        }
+        Py_DECREF(profile);
+        exec = exec->vm_data.links.next;
+    }
+    return res;
+}
+
 #else
 
 int
@@ -1683,4 +2053,16 @@ _PyDumpExecutors(FILE *out)
     return -1;
 }
 
+PyObject *
+_PyGetExecutorProfiles(void)
+{
+    return PyList_New(0);
+}
+
+PyObject *
+_PyGetAbandonedTraces(void)
+{
+    return PyDict_New();
+}
+
 #endif /* _Py_TIER2 */
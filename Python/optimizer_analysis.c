@@ -527,6 +527,74 @@ optimize_uops(
 }
 
 
+/* Pushes a value onto the stack without side effects,
+ * so it can be removed if the value is immediately popped. */
+static bool
+is_pure_push(int opcode)
+{
+    switch (opcode) {
+        case _LOAD_CONST_INLINE:
+        case _LOAD_CONST_INLINE_BORROW:
+        case _LOAD_FAST:
+        case _LOAD_FAST_BORROW:
+        case _LOAD_SMALL_INT:
+        case _COPY:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/* The same constant load, but popping one fewer value first. */
+static int
+fewer_pops(int opcode)
+{
+    switch (opcode) {
+        case _POP_TWO_LOAD_CONST_INLINE_BORROW:
+            return _POP_TOP_LOAD_CONST_INLINE_BORROW;
+        case _POP_TOP_LOAD_CONST_INLINE_BORROW:
+            return _LOAD_CONST_INLINE_BORROW;
+        case _POP_TOP_LOAD_CONST_INLINE:
+            return _LOAD_CONST_INLINE;
+        default:
+            Py_UNREACHABLE();
+    }
+}
+
+static _PyUOpInstruction *
+last_non_nop(_PyUOpInstruction *inst)
+{
+    do {
+        inst--;
+    } while (inst->opcode == _NOP);
+    return inst;
+}
+
+/* A tuple that is built only to be unpacked again straight away never
+ * escapes the trace, so there is no need to allocate it. The net effect
+ * of the pair is to reverse the order of the items on the stack.
+ * This is only done once unneeded _SET_IP and _CHECK_VALIDITY uops are
+ * gone, so that nothing between the two can deopt: that would resume in
+ * tier 1 without the tuple on the stack. */
+static void
+sink_tuple(_PyUOpInstruction *this_instr, int length)
+{
+    _PyUOpInstruction *build = last_non_nop(this_instr);
+    if (build->opcode != _BUILD_TUPLE || build->oparg != length) {
+        return;
+    }
+    REPLACE_OP(build, _NOP, 0, 0);
+    if (length <= 1) {
+        REPLACE_OP(this_instr, _NOP, 0, 0);
+    }
+    else if (length <= 3) {
+        REPLACE_OP(this_instr, _SWAP, length, 0);
+    }
+    else {
+        REPLACE_OP(this_instr, _REVERSE, length, 0);
+    }
+}
+
 static int
 remove_unneeded_uops(_PyUOpInstruction *buffer, int buffer_size)
 {
@@ -538,6 +606,14 @@ remove_unneeded_uops(_PyUOpInstruction *buffer, int buffer_size)
     bool may_have_escaped = true;
     for (int pc = 0; pc < buffer_size; pc++) {
         int opcode = buffer[pc].opcode;
+        if (opcode == _UNPACK_SEQUENCE_TWO_TUPLE) {
+            sink_tuple(&buffer[pc], 2);
+            opcode = buffer[pc].opcode;
+        }
+        else if (opcode == _UNPACK_SEQUENCE_TUPLE) {
+            sink_tuple(&buffer[pc], buffer[pc].oparg);
+            opcode = buffer[pc].opcode;
+        }
         switch (opcode) {
             case _START_EXECUTOR:
                 may_have_escaped = false;
@@ -556,16 +632,8 @@ remove_unneeded_uops(_PyUOpInstruction *buffer, int buffer_size)
                 break;
             case _POP_TOP:
             {
-                _PyUOpInstruction *last = &buffer[pc-1];
-                while (last->opcode == _NOP) {
-                    last--;
-                }
-                if (last->opcode == _LOAD_CONST_INLINE  ||
-                    last->opcode == _LOAD_CONST_INLINE_BORROW ||
-                    last->opcode == _LOAD_FAST ||
-                    last->opcode == _LOAD_FAST_BORROW ||
-                    last->opcode == _COPY
-                ) {
+                _PyUOpInstruction *last = last_non_nop(&buffer[pc]);
+                if (is_pure_push(last->opcode)) {
                     last->opcode = _NOP;
                     buffer[pc].opcode = _NOP;
                 }
@@ -577,6 +645,26 @@ remove_unneeded_uops(_PyUOpInstruction *buffer, int buffer_size)
             case _JUMP_TO_TOP:
             case _EXIT_TRACE:
                 return pc + 1;
+            case _POP_TWO_LOAD_CONST_INLINE_BORROW:
+            case _POP_TOP_LOAD_CONST_INLINE_BORROW:
+            case _POP_TOP_LOAD_CONST_INLINE:
+            {
+                /* Values that are pushed only to be popped again never
+                 * need to reach the stack. Cancel each pure push against
+                 * one of the pops, shrinking the instruction towards a
+                 * plain constant load. */
+                _PyUOpInstruction *last = last_non_nop(&buffer[pc]);
+                while (opcode != _LOAD_CONST_INLINE &&
+                       opcode != _LOAD_CONST_INLINE_BORROW &&
+                       is_pure_push(last->opcode))
+                {
+                    last->opcode = _NOP;
+                    opcode = fewer_pops(opcode);
+                    last = last_non_nop(last);
+                }
+                buffer[pc].opcode = opcode;
+                _Py_FALLTHROUGH;
+            }
             default:
             {
                 /* _PUSH_FRAME doesn't escape or error, but it
@@ -597,6 +685,124 @@ remove_unneeded_uops(_PyUOpInstruction *buffer, int buffer_size)
     Py_UNREACHABLE();
 }
 
+static _PyUOpInstruction *
+skip_nops_and_set_ip(_PyUOpInstruction *inst)
+{
+    do {
+        inst++;
+    } while (inst->opcode == _NOP || inst->opcode == _SET_IP);
+    return inst;
+}
+
+/* A function whose body does nothing but return one of its arguments
+ * or a constant cannot deopt, exit or raise, so nothing would ever
+ * observe its frame. Replace the frame push, the body and the return
+ * with a single uop that pops the call's operands and pushes the result.
+ * The guards on the function's version are left in place.
+ *
+ * Any other body keeps its frame. A guard in the callee exits to tier 1
+ * with the callee's frame on top, and side exits have no way of building
+ * that frame after the fact, so the frame has to exist before the guard
+ * runs. Property getters are not inlined either: translation stops at
+ * LOAD_ATTR_PROPERTY, whose getter is only known from the inline cache,
+ * so such calls never get this far. */
+static void
+inline_trivial_calls(_PyUOpInstruction *buffer, int buffer_size)
+{
+    for (int pc = 0; pc < buffer_size; pc++) {
+        _PyUOpInstruction *init = &buffer[pc];
+        if (init->opcode != _INIT_CALL_PY_EXACT_ARGS) {
+            continue;
+        }
+        _PyUOpInstruction *inst = skip_nops_and_set_ip(init);
+        if (inst->opcode != _SAVE_RETURN_OFFSET) {
+            continue;
+        }
+        inst = skip_nops_and_set_ip(inst);
+        if (inst->opcode != _PUSH_FRAME) {
+            continue;
+        }
+        inst = skip_nops_and_set_ip(inst);
+        if (inst->opcode == _RESUME_CHECK || inst->opcode == _TIER2_RESUME_CHECK) {
+            inst = skip_nops_and_set_ip(inst);
+        }
+        _PyUOpInstruction *load = inst;
+        _PyUOpInstruction *ret = skip_nops_and_set_ip(load);
+        if (ret->opcode != _RETURN_VALUE) {
+            continue;
+        }
+        switch (load->opcode) {
+            case _LOAD_FAST:
+            case _LOAD_FAST_BORROW:
+                init->opcode = _POP_CALL_LOAD_ARG;
+                init->operand0 = load->oparg;
+                break;
+            case _LOAD_CONST_INLINE:
+            case _LOAD_CONST_INLINE_BORROW:
+                init->opcode = _POP_CALL_LOAD_CONST_INLINE;
+                init->operand0 = load->operand0;
+                break;
+            case _LOAD_SMALL_INT:
+                assert(load->oparg < _PY_NSMALLPOSINTS);
+                init->opcode = _POP_CALL_LOAD_CONST_INLINE;
+                init->operand0 = (uintptr_t)&_PyLong_SMALL_INTS[_PY_NSMALLNEGINTS + load->oparg];
+                break;
+            default:
+                continue;
+        }
+        DPRINTF(2, "Inlined trivial call at %d\n", pc);
+        for (inst = init + 1; inst <= ret; inst++) {
+            inst->opcode = _NOP;
+        }
+        pc = (int)(ret - buffer);
+    }
+}
+
+/* A loop trace executes every uop on each iteration, including guards
+ * whose outcome cannot change while we remain in the same frame.
+ * Move those guards into a preheader between _START_EXECUTOR and the
+ * top of the loop, so that they are only checked on entry.
+ * The oparg of _JUMP_TO_TOP is the length of the preheader. */
+static void
+hoist_loop_invariant_guards(_PyUOpInstruction *buffer, int buffer_size)
+{
+    assert(buffer[0].opcode == _START_EXECUTOR);
+    _PyUOpInstruction *jump = &buffer[buffer_size-1];
+    if (jump->opcode != _JUMP_TO_TOP) {
+        return;
+    }
+    int hoisted = 0;
+    int depth = 0;
+    for (int pc = 1; pc < buffer_size-1; pc++) {
+        _PyUOpInstruction inst = buffer[pc];
+        switch (inst.opcode) {
+            case _PUSH_FRAME:
+                depth++;
+                break;
+            case _RETURN_VALUE:
+            case _RETURN_GENERATOR:
+            case _YIELD_VALUE:
+                depth--;
+                break;
+            /* The function and the height of the data stack are
+             * the same on every iteration of the outermost frame. */
+            case _CHECK_FUNCTION:
+            case _CHECK_STACK_SPACE_OPERAND:
+                if (depth != 0) {
+                    break;
+                }
+                /* Failing before the loop has started must resume
+                 * tier 1 at the start of the trace. */
+                inst.target = buffer[0].target;
+                memmove(&buffer[2], &buffer[1], (pc-1)*sizeof(_PyUOpInstruction));
+                buffer[1] = inst;
+                hoisted++;
+                break;
+        }
+    }
+    jump->oparg = hoisted;
+}
+
 //  0 - failure, no error raised, just fall back to Tier 1
 // -1 - failure, and raise error
 //  > 0 - length of optimized trace
@@ -627,6 +833,9 @@ _Py_uop_analyze_and_optimize(
     length = remove_unneeded_uops(buffer, length);
     assert(length > 0);
 
+    inline_trivial_calls(buffer, length);
+    hoist_loop_invariant_guards(buffer, length);
+
     OPT_STAT_INC(optimizer_successes);
     return length;
 }
@@ -366,6 +366,39 @@ dummy_func(void) {
         ctx->done = true;
     }
 
+    op(_GUARD_BINARY_OP_EXTEND, (descr/4, left, right -- left, right)) {
+        _PyBinaryOpSpecializationDescr *d = (_PyBinaryOpSpecializationDescr *)descr;
+        if (d->lhs_type != NULL) {
+            sym_set_type(left, d->lhs_type);
+        }
+        if (d->rhs_type != NULL) {
+            sym_set_type(right, d->rhs_type);
+        }
+    }
+
+    op(_BINARY_OP_EXTEND, (descr/4, left, right -- res)) {
+        _PyBinaryOpSpecializationDescr *d = (_PyBinaryOpSpecializationDescr *)descr;
+        if (d->res_type != NULL) {
+            res = sym_new_type(ctx, d->res_type);
+        }
+        else {
+            res = sym_new_not_null(ctx);
+        }
+    }
+
+    op(_BINARY_SLICE, (container, start, stop -- res)) {
+        // Slicing an exact builtin sequence gives the same type back.
+        PyTypeObject *type = sym_get_type(container);
+        if (type == &PyBytes_Type || type == &PyUnicode_Type ||
+            type == &PyList_Type || type == &PyTuple_Type)
+        {
+            res = sym_new_type(ctx, type);
+        }
+        else {
+            res = sym_new_not_null(ctx);
+        }
+    }
+
     op(_BINARY_OP_SUBSCR_STR_INT, (left, right -- res)) {
         res = sym_new_type(ctx, &PyUnicode_Type);
     }
@@ -468,6 +501,14 @@ dummy_func(void) {
         res = sym_new_type(ctx, &PyBool_Type);
     }
 
+    op(_COMPARE_OP_FLOAT_INT, (left, right -- res)) {
+        res = sym_new_type(ctx, &PyBool_Type);
+    }
+
+    op(_COMPARE_OP_INT_FLOAT, (left, right -- res)) {
+        res = sym_new_type(ctx, &PyBool_Type);
+    }
+
     op(_COMPARE_OP_STR, (left, right -- res)) {
         res = sym_new_type(ctx, &PyBool_Type);
     }
@@ -488,6 +529,34 @@ dummy_func(void) {
         res = sym_new_type(ctx, &PyBool_Type);
     }
 
+    op(_CONTAINS_OP_STR_TUPLE, (left, right -- res)) {
+        res = sym_new_type(ctx, &PyBool_Type);
+    }
+
+    op(_FORMAT_SIMPLE_STR, (value -- res)) {
+        res = value;
+    }
+
+    op(_FORMAT_SIMPLE_INT, (value -- res)) {
+        res = sym_new_type(ctx, &PyUnicode_Type);
+    }
+
+    op(_FORMAT_SIMPLE_FLOAT, (value -- res)) {
+        res = sym_new_type(ctx, &PyUnicode_Type);
+    }
+
+    op(_FORMAT_WITH_SPEC_STR, (value, fmt_spec -- res)) {
+        res = sym_new_type(ctx, &PyUnicode_Type);
+    }
+
+    op(_FORMAT_WITH_SPEC_INT, (value, fmt_spec -- res)) {
+        res = sym_new_type(ctx, &PyUnicode_Type);
+    }
+
+    op(_FORMAT_WITH_SPEC_FLOAT, (value, fmt_spec -- res)) {
+        res = sym_new_type(ctx, &PyUnicode_Type);
+    }
+
     op(_LOAD_CONST, (-- value)) {
         PyObject *val = PyTuple_GET_ITEM(co->co_consts, this_instr->oparg);
         int opcode = _Py_IsImmortal(val) ? _LOAD_CONST_INLINE_BORROW : _LOAD_CONST_INLINE;
@@ -846,6 +915,19 @@ dummy_func(void) {
        next = sym_new_type(ctx, &PyLong_Type);
     }
 
+    op(_ITER_NEXT_DICT_ITEMS_TIER_TWO, (iter -- iter, next)) {
+        next = sym_new_type(ctx, &PyTuple_Type);
+    }
+
+    op(_ITER_NEXT_ENUMERATE_TIER_TWO, (iter -- iter, next)) {
+        next = sym_new_type(ctx, &PyTuple_Type);
+    }
+
+    op(_ITER_NEXT_ENUMERATE_UNPACK, (iter -- iter, item, index)) {
+        item = sym_new_not_null(ctx);
+        index = sym_new_type(ctx, &PyLong_Type);
+    }
+
     op(_GUARD_IS_TRUE_POP, (flag -- )) {
         if (sym_is_const(ctx, flag)) {
             PyObject *value = sym_get_const(ctx, flag);
@@ -930,6 +1012,14 @@ dummy_func(void) {
         }
     }
 
+    op(_REVERSE, (values[oparg] -- values[oparg])) {
+        for (int lo = 0, hi = oparg - 1; lo < hi; lo++, hi--) {
+            JitOptSymbol *temp = values[lo];
+            values[lo] = values[hi];
+            values[hi] = temp;
+        }
+    }
+
     op(_GUARD_TOS_LIST, (tos -- tos)) {
         if (sym_matches_type(tos, &PyList_Type)) {
             REPLACE_OP(this_instr, _NOP, 0, 0);
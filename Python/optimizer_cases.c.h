@@ -550,12 +550,31 @@
         }
 
         case _GUARD_BINARY_OP_EXTEND: {
+            JitOptSymbol *right;
+            JitOptSymbol *left;
+            right = stack_pointer[-1];
+            left = stack_pointer[-2];
+            PyObject *descr = (PyObject *)this_instr->operand0;
+            _PyBinaryOpSpecializationDescr *d = (_PyBinaryOpSpecializationDescr *)descr;
+            if (d->lhs_type != NULL) {
+                sym_set_type(left, d->lhs_type);
+            }
+            if (d->rhs_type != NULL) {
+                sym_set_type(right, d->rhs_type);
+            }
             break;
         }
 
         case _BINARY_OP_EXTEND: {
             JitOptSymbol *res;
-            res = sym_new_not_null(ctx);
+            PyObject *descr = (PyObject *)this_instr->operand0;
+            _PyBinaryOpSpecializationDescr *d = (_PyBinaryOpSpecializationDescr *)descr;
+            if (d->res_type != NULL) {
+                res = sym_new_type(ctx, d->res_type);
+            }
+            else {
+                res = sym_new_not_null(ctx);
+            }
             stack_pointer[-2] = res;
             stack_pointer += -1;
             assert(WITHIN_STACK_BOUNDS());
@@ -563,8 +582,18 @@
         }
 
         case _BINARY_SLICE: {
+            JitOptSymbol *container;
             JitOptSymbol *res;
-            res = sym_new_not_null(ctx);
+            container = stack_pointer[-3];
+            PyTypeObject *type = sym_get_type(container);
+            if (type == &PyBytes_Type || type == &PyUnicode_Type ||
+                type == &PyList_Type || type == &PyTuple_Type)
+            {
+                res = sym_new_type(ctx, type);
+            }
+            else {
+                res = sym_new_not_null(ctx);
+            }
             stack_pointer[-3] = res;
             stack_pointer += -2;
             assert(WITHIN_STACK_BOUNDS());
@@ -1164,6 +1193,17 @@
             break;
         }
 
+        case _GUARD_TYPE_VERSION_POLY: {
+            break;
+        }
+
+        case _LOAD_ATTR_INSTANCE_VALUE_INDEX: {
+            JitOptSymbol *attr;
+            attr = sym_new_not_null(ctx);
+            stack_pointer[-1] = attr;
+            break;
+        }
+
         case _LOAD_ATTR_MODULE: {
             JitOptSymbol *owner;
             JitOptSymbol *attr;
@@ -1259,6 +1299,18 @@
             break;
         }
 
+        case _STORE_ATTR_PROPERTY: {
+            stack_pointer += -2;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case _STORE_ATTR_SETATTR_OVERRIDDEN: {
+            stack_pointer += -2;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
         case _COMPARE_OP: {
             JitOptSymbol *res;
             if (oparg & 16) {
@@ -1314,6 +1366,24 @@
             break;
         }
 
+        case _COMPARE_OP_FLOAT_INT: {
+            JitOptSymbol *res;
+            res = sym_new_type(ctx, &PyBool_Type);
+            stack_pointer[-2] = res;
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case _COMPARE_OP_INT_FLOAT: {
+            JitOptSymbol *res;
+            res = sym_new_type(ctx, &PyBool_Type);
+            stack_pointer[-2] = res;
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
         case _COMPARE_OP_STR: {
             JitOptSymbol *res;
             res = sym_new_type(ctx, &PyBool_Type);
@@ -1370,6 +1440,15 @@
             break;
         }
 
+        case _CONTAINS_OP_STR_TUPLE: {
+            JitOptSymbol *res;
+            res = sym_new_type(ctx, &PyBool_Type);
+            stack_pointer[-2] = res;
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
         case _CHECK_EG_MATCH: {
             JitOptSymbol *rest;
             JitOptSymbol *match;
@@ -1552,6 +1631,79 @@
             break;
         }
 
+        case _ITER_CHECK_DICT_ITEMS: {
+            break;
+        }
+
+        /* _ITER_NEXT_DICT_ITEMS is not a viable micro-op for tier 2 */
+
+        case _ITER_NEXT_DICT_ITEMS_TIER_TWO: {
+            JitOptSymbol *next;
+            next = sym_new_type(ctx, &PyTuple_Type);
+            stack_pointer[0] = next;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case _ITER_NEXT_DICT_ITEMS_UNPACK: {
+            JitOptSymbol *value;
+            JitOptSymbol *key;
+            value = sym_new_not_null(ctx);
+            key = sym_new_not_null(ctx);
+            stack_pointer[0] = value;
+            stack_pointer[1] = key;
+            stack_pointer += 2;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case _ITER_CHECK_ENUMERATE: {
+            break;
+        }
+
+        /* _ITER_NEXT_ENUMERATE is not a viable micro-op for tier 2 */
+
+        case _ITER_NEXT_ENUMERATE_TIER_TWO: {
+            JitOptSymbol *next;
+            next = sym_new_type(ctx, &PyTuple_Type);
+            stack_pointer[0] = next;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case _ITER_NEXT_ENUMERATE_UNPACK: {
+            JitOptSymbol *item;
+            JitOptSymbol *index;
+            item = sym_new_not_null(ctx);
+            index = sym_new_type(ctx, &PyLong_Type);
+            stack_pointer[0] = item;
+            stack_pointer[1] = index;
+            stack_pointer += 2;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case _ITER_CHECK_REVERSED_LIST: {
+            break;
+        }
+
+        /* _ITER_JUMP_REVERSED_LIST is not a viable micro-op for tier 2 */
+
+        case _GUARD_NOT_EXHAUSTED_REVERSED_LIST: {
+            break;
+        }
+
+        case _ITER_NEXT_REVERSED_LIST: {
+            JitOptSymbol *next;
+            next = sym_new_not_null(ctx);
+            stack_pointer[0] = next;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
         case _LOAD_SPECIAL: {
             JitOptSymbol *attr;
             JitOptSymbol *self_or_null;
@@ -1718,6 +1870,14 @@
             break;
         }
 
+        case _CHECK_DUNDER_CALL: {
+            break;
+        }
+
+        case _EXPAND_DUNDER_CALL: {
+            break;
+        }
+
         case _CHECK_IS_NOT_PY_CALLABLE: {
             break;
         }
@@ -2113,6 +2273,29 @@
             break;
         }
 
+        case _FORMAT_SIMPLE_STR: {
+            JitOptSymbol *value;
+            JitOptSymbol *res;
+            value = stack_pointer[-1];
+            res = value;
+            stack_pointer[-1] = res;
+            break;
+        }
+
+        case _FORMAT_SIMPLE_INT: {
+            JitOptSymbol *res;
+            res = sym_new_type(ctx, &PyUnicode_Type);
+            stack_pointer[-1] = res;
+            break;
+        }
+
+        case _FORMAT_SIMPLE_FLOAT: {
+            JitOptSymbol *res;
+            res = sym_new_type(ctx, &PyUnicode_Type);
+            stack_pointer[-1] = res;
+            break;
+        }
+
         case _FORMAT_WITH_SPEC: {
             JitOptSymbol *res;
             res = sym_new_not_null(ctx);
@@ -2122,6 +2305,33 @@
             break;
         }
 
+        case _FORMAT_WITH_SPEC_STR: {
+            JitOptSymbol *res;
+            res = sym_new_type(ctx, &PyUnicode_Type);
+            stack_pointer[-2] = res;
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case _FORMAT_WITH_SPEC_INT: {
+            JitOptSymbol *res;
+            res = sym_new_type(ctx, &PyUnicode_Type);
+            stack_pointer[-2] = res;
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case _FORMAT_WITH_SPEC_FLOAT: {
+            JitOptSymbol *res;
+            res = sym_new_type(ctx, &PyUnicode_Type);
+            stack_pointer[-2] = res;
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
         case _COPY: {
             JitOptSymbol *bottom;
             JitOptSymbol *top;
@@ -2348,6 +2558,35 @@
             break;
         }
 
+        case _REVERSE: {
+            JitOptSymbol **values;
+            values = &stack_pointer[-oparg];
+            for (int lo = 0, hi = oparg - 1; lo < hi; lo++, hi--) {
+                JitOptSymbol *temp = values[lo];
+                values[lo] = values[hi];
+                values[hi] = temp;
+            }
+            break;
+        }
+
+        case _POP_CALL_LOAD_CONST_INLINE: {
+            JitOptSymbol *value;
+            value = sym_new_not_null(ctx);
+            stack_pointer[-2 - oparg] = value;
+            stack_pointer += -1 - oparg;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case _POP_CALL_LOAD_ARG: {
+            JitOptSymbol *value;
+            value = sym_new_not_null(ctx);
+            stack_pointer[-2 - oparg] = value;
+            stack_pointer += -1 - oparg;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
         case _CHECK_FUNCTION: {
             break;
         }
@@ -4,6 +4,7 @@
 #include "pycore_audit.h"         // _PySys_ClearAuditHooks()
 #include "pycore_call.h"          // _PyObject_CallMethod()
 #include "pycore_ceval.h"         // _PyEval_FiniGIL()
+#include "pycore_code.h"          // ADAPTIVE_COOLDOWN_VALUE
 #include "pycore_codecs.h"        // _PyCodec_Lookup()
 #include "pycore_context.h"       // _PyContext_Init()
 #include "pycore_dict.h"          // _PyDict_Fini()
@@ -1158,6 +1159,29 @@ run_presite(PyThreadState *tstate)
 #endif
 
 
+#ifdef _Py_TIER2
+// PYTHON_JIT_JUMP_BACKWARD_WARMUP=N and PYTHON_JIT_SIDE_EXIT_WARMUP=N set
+// how many times a loop or a side exit must run before it is traced.
+static void
+init_warmup_from_env(_PyWarmupCounters *warmup)
+{
+    int value;
+    char *env = Py_GETENV("PYTHON_JIT_JUMP_BACKWARD_WARMUP");
+    if (env && _Py_str_to_int(env, &value) == 0 && value > 0) {
+        value = Py_MIN(value, JUMP_BACKWARD_INITIAL_VALUE + 1);
+        warmup->jump_backward = make_warmup_backoff_counter(value - 1);
+    }
+    env = Py_GETENV("PYTHON_JIT_SIDE_EXIT_WARMUP");
+    if (env && _Py_str_to_int(env, &value) == 0 && value > 0) {
+        // Side exits must stay colder than ADAPTIVE_COOLDOWN_VALUE (see
+        // pycore_backoff.h)
+        value = Py_MAX(value, ADAPTIVE_COOLDOWN_VALUE + 2);
+        value = Py_MIN(value, SIDE_EXIT_INITIAL_VALUE + 1);
+        warmup->side_exit = make_warmup_backoff_counter(value - 1);
+    }
+}
+#endif
+
 static PyStatus
 init_interp_main(PyThreadState *tstate)
 {
@@ -1318,6 +1342,7 @@ init_interp_main(PyThreadState *tstate)
             enabled = *env != '0';
         }
         if (enabled) {
+            init_warmup_from_env(&interp->warmup);
 #ifdef _Py_JIT
             // perf profiler works fine with tier 2 interpreter, so
             // only checking for a "real JIT".
@@ -1331,6 +1356,19 @@ init_interp_main(PyThreadState *tstate)
             {
                 interp->jit = true;
             }
+#ifdef _Py_JIT
+            env = Py_GETENV("PYTHON_JIT_MEMORY_LIMIT");
+            int limit;
+            if (env && _Py_str_to_int(env, &limit) == 0 && limit > 0) {
+                // PYTHON_JIT_MEMORY_LIMIT=N caps machine code at N megabytes
+                interp->jit_arena.limit = (size_t)limit * 1024 * 1024;
+            }
+            env = Py_GETENV("PYTHON_JIT_BACKGROUND");
+            if (env && *env != '\0') {
+                // PYTHON_JIT_BACKGROUND=0|1 moves code emission off-thread
+                interp->jit_background = *env != '0';
+            }
+#endif
         }
     }
 #endif
@@ -1690,6 +1728,9 @@ finalize_modules(PyThreadState *tstate)
 #ifdef _Py_TIER2
     _Py_Executors_InvalidateAll(interp, 0);
 #endif
+#ifdef _Py_JIT
+    _PyJIT_Fini(interp);
+#endif
 
     // Stop watching __builtin__ modifications
     PyDict_Unwatch(0, interp->builtins);
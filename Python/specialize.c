@@ -113,6 +113,8 @@ _Py_GetSpecializationStats(void) {
     }
     int err = 0;
     err += add_stat_dict(stats, CONTAINS_OP, "contains_op");
+    err += add_stat_dict(stats, FORMAT_SIMPLE, "format_simple");
+    err += add_stat_dict(stats, FORMAT_WITH_SPEC, "format_with_spec");
     err += add_stat_dict(stats, LOAD_SUPER_ATTR, "load_super_attr");
     err += add_stat_dict(stats, LOAD_ATTR, "load_attr");
     err += add_stat_dict(stats, LOAD_GLOBAL, "load_global");
@@ -457,7 +459,8 @@ _PyCode_Quicken(_Py_CODEUNIT *instructions, Py_ssize_t size, int enable_counters
     #if ENABLE_SPECIALIZATION_FT
     _Py_BackoffCounter jump_counter, adaptive_counter;
     if (enable_counters) {
-        jump_counter = initial_jump_backoff_counter();
+        jump_counter = initial_jump_backoff_counter(
+            &_PyInterpreterState_GET()->warmup);
         adaptive_counter = adaptive_counter_warmup();
     }
     else {
@@ -632,6 +635,7 @@ _PyCode_Quicken(_Py_CODEUNIT *instructions, Py_ssize_t size, int enable_counters
 #define SPEC_FAIL_CALL_INIT_NOT_SIMPLE 30
 #define SPEC_FAIL_CALL_METACLASS 31
 #define SPEC_FAIL_CALL_INIT_NOT_INLINE_VALUES 32
+#define SPEC_FAIL_CALL_DUNDER_CALL_NOT_PYTHON 33
 
 /* COMPARE_OP */
 #define SPEC_FAIL_COMPARE_OP_DIFFERENT_TYPES 12
@@ -983,6 +987,55 @@ analyze_descriptor_store(PyTypeObject *type, PyObject *name, PyObject **descr, u
     return classify_descriptor(descriptor, false);
 }
 
+/* A LOAD_ATTR site that was specialized for the instance values of one type
+ * and now sees another is given a two-entry cache instead of flip-flopping
+ * between the two. The previous type is recovered from the version left in
+ * the cache and checked again, so nothing stale is trusted. Only one index
+ * is cached, so both types must store the attribute in the same slot. Since
+ * shared keys are seeded from the sorted __static_attributes__, that holds
+ * for classes that assign the same set of attributes in __init__. */
+static int
+specialize_load_attr_instance_value_poly(
+    _Py_CODEUNIT *instr, PyObject *name,
+    unsigned int tp_version, Py_ssize_t index)
+{
+#ifdef Py_GIL_DISABLED
+    return 0;
+#else
+    _PyAttrCache *cache = (_PyAttrCache *)(instr + 1);
+    unsigned int old_version = read_u32(cache->version);
+    if (old_version == 0 || old_version == tp_version) {
+        return 0;
+    }
+    PyTypeObject *old_type = _PyType_LookupByVersion(old_version);
+    if (old_type == NULL ||
+        (old_type->tp_flags & Py_TPFLAGS_INLINE_VALUES) == 0)
+    {
+        return 0;
+    }
+    PyObject *descr = NULL;
+    unsigned int descr_version = 0;
+    DescriptorClassification kind = analyze_descriptor_load(
+        old_type, name, &descr, &descr_version);
+    Py_XDECREF(descr);
+    if (kind != ABSENT || descr_version != old_version) {
+        return 0;
+    }
+    PyDictKeysObject *keys = ((PyHeapTypeObject *)old_type)->ht_cached_keys;
+    if (_PyDictKeys_StringLookupSplit(keys, name) != index) {
+        return 0;
+    }
+    _PyAttrPolyCache *poly = (_PyAttrPolyCache *)(instr + 1);
+    /* The newest type goes first, so that if a third type turns up the
+     * site is respecialized for the two most recent ones. */
+    write_u32(poly->type_version, tp_version);
+    write_u32(poly->type_version2, old_version);
+    poly->index = (uint16_t)index;
+    specialize(instr, LOAD_ATTR_INSTANCE_VALUE_POLY);
+    return 1;
+#endif
+}
+
 static int
 specialize_dict_access_inline(
     PyObject *owner, _Py_CODEUNIT *instr, PyTypeObject *type,
@@ -1007,6 +1060,12 @@ specialize_dict_access_inline(
         SPECIALIZATION_FAIL(base_op, SPEC_FAIL_OUT_OF_RANGE);
         return 0;
     }
+    if (values_op == LOAD_ATTR_INSTANCE_VALUE &&
+        specialize_load_attr_instance_value_poly(instr, name, tp_version,
+                                                 index))
+    {
+        return 1;
+    }
     cache->index = (uint16_t)offset;
     write_u32(cache->version, tp_version);
     specialize(instr, values_op);
@@ -1373,6 +1432,37 @@ _Py_Specialize_LoadAttr(_PyStackRef owner_st, _Py_CODEUNIT *instr, PyObject *nam
     }
 }
 
+static int
+specialize_store_attr_setattr_overridden(PyTypeObject *type, _Py_CODEUNIT *instr)
+{
+    if (type->tp_setattro != _Py_slot_tp_setattro) {
+        SPECIALIZATION_FAIL(STORE_ATTR, SPEC_FAIL_OVERRIDDEN);
+        return 0;
+    }
+    unsigned int tp_version;
+    PyObject *setattr = _PyType_LookupRefAndVersion(
+        type, &_Py_ID(__setattr__), &tp_version);
+    if (setattr == NULL || tp_version == 0 ||
+        !Py_IS_TYPE(setattr, &PyFunction_Type))
+    {
+        SPECIALIZATION_FAIL(STORE_ATTR, SPEC_FAIL_OVERRIDDEN);
+        Py_XDECREF(setattr);
+        return 0;
+    }
+    assert(type->tp_flags & Py_TPFLAGS_HEAPTYPE);
+    if (!_PyType_CacheSetattrForSpecialization((PyHeapTypeObject *)type,
+                                               setattr, tp_version)) {
+        SPECIALIZATION_FAIL(STORE_ATTR, SPEC_FAIL_OUT_OF_VERSIONS);
+        Py_DECREF(setattr);
+        return 0;
+    }
+    Py_DECREF(setattr);
+    _PyAttrCache *cache = (_PyAttrCache *)(instr + 1);
+    write_u32(cache->version, tp_version);
+    specialize(instr, STORE_ATTR_SETATTR_OVERRIDDEN);
+    return 1;
+}
+
 Py_NO_INLINE void
 _Py_Specialize_StoreAttr(_PyStackRef owner_st, _Py_CODEUNIT *instr, PyObject *name)
 {
@@ -1396,6 +1486,12 @@ _Py_Specialize_StoreAttr(_PyStackRef owner_st, _Py_CODEUNIT *instr, PyObject *na
     }
     unsigned int tp_version = 0;
     DescriptorClassification kind = analyze_descriptor_store(type, name, &descr, &tp_version);
+    if (kind == GETSET_OVERRIDDEN) {
+        if (specialize_store_attr_setattr_overridden(type, instr)) {
+            goto success;
+        }
+        goto fail;
+    }
     if (tp_version == 0) {
         goto fail;
     }
@@ -1408,8 +1504,32 @@ _Py_Specialize_StoreAttr(_PyStackRef owner_st, _Py_CODEUNIT *instr, PyObject *na
             SPECIALIZATION_FAIL(STORE_ATTR, SPEC_FAIL_ATTR_METHOD);
             goto fail;
         case PROPERTY:
-            SPECIALIZATION_FAIL(STORE_ATTR, SPEC_FAIL_ATTR_PROPERTY);
-            goto fail;
+        {
+            assert(Py_TYPE(descr) == &PyProperty_Type);
+            _PyPropertyObject *prop = (_PyPropertyObject *)descr;
+            if (prop->prop_set == NULL) {
+                SPECIALIZATION_FAIL(STORE_ATTR, SPEC_FAIL_EXPECTED_ERROR);
+                goto fail;
+            }
+            if (!(type->tp_flags & Py_TPFLAGS_HEAPTYPE)) {
+                SPECIALIZATION_FAIL(STORE_ATTR, SPEC_FAIL_ATTR_PROPERTY);
+                goto fail;
+            }
+            /* STORE_ATTR_PROPERTY finds the property by comparing its name
+             * with the attribute, as the type caches only one of them. */
+            if (prop->prop_name != name) {
+                SPECIALIZATION_FAIL(STORE_ATTR, SPEC_FAIL_ATTR_PROPERTY);
+                goto fail;
+            }
+            if (!_PyType_CachePropertyForSpecialization(
+                    (PyHeapTypeObject *)type, descr, tp_version)) {
+                SPECIALIZATION_FAIL(STORE_ATTR, SPEC_FAIL_OUT_OF_VERSIONS);
+                goto fail;
+            }
+            write_u32(cache->version, tp_version);
+            specialize(instr, STORE_ATTR_PROPERTY);
+            goto success;
+        }
         case OBJECT_SLOT:
         {
             PyMemberDescrObject *member = (PyMemberDescrObject *)descr;
@@ -2015,6 +2135,44 @@ specialize_class_call(PyObject *callable, _Py_CODEUNIT *instr, int nargs)
     return 0;
 }
 
+/* Instances of Python classes whose __call__ is a plain Python function are
+ * called by pushing a frame for __call__ directly, with the instance as self,
+ * instead of going through slot_tp_call and a bound method.
+ * Returns 1 if specialized, 0 otherwise. */
+static int
+specialize_dunder_call(PyObject *callable, _Py_CODEUNIT *instr)
+{
+    PyTypeObject *tp = Py_TYPE(callable);
+    if (tp->tp_call != _Py_slot_tp_call) {
+        return 0;
+    }
+    assert(tp->tp_flags & Py_TPFLAGS_HEAPTYPE);
+    unsigned int tp_version = 0;
+    PyObject *call = _PyType_LookupRefAndVersion(tp, &_Py_ID(__call__), &tp_version);
+    if (call == NULL || !PyFunction_Check(call)) {
+        SPECIALIZATION_FAIL(CALL, SPEC_FAIL_CALL_DUNDER_CALL_NOT_PYTHON);
+        Py_XDECREF(call);
+        return 0;
+    }
+    int kind = function_kind((PyCodeObject *)PyFunction_GET_CODE(call));
+    if (kind == SPEC_FAIL_CODE_NOT_OPTIMIZED) {
+        SPECIALIZATION_FAIL(CALL, kind);
+        Py_DECREF(call);
+        return 0;
+    }
+    if (!_PyType_CacheCallForSpecialization((PyHeapTypeObject *)tp, call,
+                                            tp_version)) {
+        SPECIALIZATION_FAIL(CALL, SPEC_FAIL_OUT_OF_VERSIONS);
+        Py_DECREF(call);
+        return 0;
+    }
+    Py_DECREF(call);
+    _PyCallCache *cache = (_PyCallCache *)(instr + 1);
+    write_u32(cache->func_version, tp_version);
+    specialize(instr, CALL_DUNDER_CALL);
+    return 1;
+}
+
 static int
 specialize_method_descriptor(PyMethodDescrObject *descr, _Py_CODEUNIT *instr,
                              int nargs)
@@ -2203,7 +2361,9 @@ _Py_Specialize_Call(_PyStackRef callable_st, _Py_CODEUNIT *instr, int nargs)
         }
     }
     else {
-        specialize(instr, CALL_NON_PY_GENERAL);
+        if (!specialize_dunder_call(callable, instr)) {
+            specialize(instr, CALL_NON_PY_GENERAL);
+        }
         fail = 0;
     }
     if (fail) {
@@ -2529,28 +2689,44 @@ LONG_FLOAT_ACTION(compactlong_float_multiply, *)
 LONG_FLOAT_ACTION(compactlong_float_true_div, /)
 #undef LONG_FLOAT_ACTION
 
+#define LONG_LONG &PyLong_Type, &PyLong_Type, &PyLong_Type
+#define FLOAT_LONG &PyFloat_Type, &PyLong_Type, &PyFloat_Type
+#define LONG_FLOAT &PyLong_Type, &PyFloat_Type, &PyFloat_Type
+
 static _PyBinaryOpSpecializationDescr binaryop_extend_descrs[] = {
     /* long-long arithmetic */
-    {NB_OR, compactlongs_guard, compactlongs_or},
-    {NB_AND, compactlongs_guard, compactlongs_and},
-    {NB_XOR, compactlongs_guard, compactlongs_xor},
-    {NB_INPLACE_OR, compactlongs_guard, compactlongs_or},
-    {NB_INPLACE_AND, compactlongs_guard, compactlongs_and},
-    {NB_INPLACE_XOR, compactlongs_guard, compactlongs_xor},
+    {NB_OR, compactlongs_guard, compactlongs_or, LONG_LONG},
+    {NB_AND, compactlongs_guard, compactlongs_and, LONG_LONG},
+    {NB_XOR, compactlongs_guard, compactlongs_xor, LONG_LONG},
+    {NB_INPLACE_OR, compactlongs_guard, compactlongs_or, LONG_LONG},
+    {NB_INPLACE_AND, compactlongs_guard, compactlongs_and, LONG_LONG},
+    {NB_INPLACE_XOR, compactlongs_guard, compactlongs_xor, LONG_LONG},
 
     /* float-long arithemetic */
-    {NB_ADD, float_compactlong_guard, float_compactlong_add},
-    {NB_SUBTRACT, float_compactlong_guard, float_compactlong_subtract},
-    {NB_TRUE_DIVIDE, nonzero_float_compactlong_guard, float_compactlong_true_div},
-    {NB_MULTIPLY, float_compactlong_guard, float_compactlong_multiply},
-
-    /* float-float arithmetic */
-    {NB_ADD, compactlong_float_guard, compactlong_float_add},
-    {NB_SUBTRACT, compactlong_float_guard, compactlong_float_subtract},
-    {NB_TRUE_DIVIDE, nonzero_compactlong_float_guard, compactlong_float_true_div},
-    {NB_MULTIPLY, compactlong_float_guard, compactlong_float_multiply},
+    {NB_ADD, float_compactlong_guard, float_compactlong_add, FLOAT_LONG},
+    {NB_SUBTRACT, float_compactlong_guard, float_compactlong_subtract, FLOAT_LONG},
+    {NB_TRUE_DIVIDE, nonzero_float_compactlong_guard, float_compactlong_true_div, FLOAT_LONG},
+    {NB_MULTIPLY, float_compactlong_guard, float_compactlong_multiply, FLOAT_LONG},
+    {NB_INPLACE_ADD, float_compactlong_guard, float_compactlong_add, FLOAT_LONG},
+    {NB_INPLACE_SUBTRACT, float_compactlong_guard, float_compactlong_subtract, FLOAT_LONG},
+    {NB_INPLACE_TRUE_DIVIDE, nonzero_float_compactlong_guard, float_compactlong_true_div, FLOAT_LONG},
+    {NB_INPLACE_MULTIPLY, float_compactlong_guard, float_compactlong_multiply, FLOAT_LONG},
+
+    /* long-float arithmetic */
+    {NB_ADD, compactlong_float_guard, compactlong_float_add, LONG_FLOAT},
+    {NB_SUBTRACT, compactlong_float_guard, compactlong_float_subtract, LONG_FLOAT},
+    {NB_TRUE_DIVIDE, nonzero_compactlong_float_guard, compactlong_float_true_div, LONG_FLOAT},
+    {NB_MULTIPLY, compactlong_float_guard, compactlong_float_multiply, LONG_FLOAT},
+    {NB_INPLACE_ADD, compactlong_float_guard, compactlong_float_add, LONG_FLOAT},
+    {NB_INPLACE_SUBTRACT, compactlong_float_guard, compactlong_float_subtract, LONG_FLOAT},
+    {NB_INPLACE_TRUE_DIVIDE, nonzero_compactlong_float_guard, compactlong_float_true_div, LONG_FLOAT},
+    {NB_INPLACE_MULTIPLY, compactlong_float_guard, compactlong_float_multiply, LONG_FLOAT},
 };
 
+#undef LONG_LONG
+#undef FLOAT_LONG
+#undef LONG_FLOAT
+
 static int
 binary_op_extended_specialization(PyObject *lhs, PyObject *rhs, int oparg,
                                   _PyBinaryOpSpecializationDescr **descr)
@@ -2736,6 +2912,22 @@ _Py_Specialize_CompareOp(_PyStackRef lhs_st, _PyStackRef rhs_st, _Py_CODEUNIT *i
     assert(_PyOpcode_Caches[COMPARE_OP] == INLINE_CACHE_ENTRIES_COMPARE_OP);
     // All of these specializations compute boolean values, so they're all valid
     // regardless of the fifth-lowest oparg bit.
+    if (PyFloat_CheckExact(lhs) && PyLong_CheckExact(rhs)) {
+        if (_PyLong_IsCompact((PyLongObject *)rhs)) {
+            specialized_op = COMPARE_OP_FLOAT_INT;
+            goto success;
+        }
+        SPECIALIZATION_FAIL(COMPARE_OP, SPEC_FAIL_COMPARE_OP_BIG_INT);
+        goto failure;
+    }
+    if (PyLong_CheckExact(lhs) && PyFloat_CheckExact(rhs)) {
+        if (_PyLong_IsCompact((PyLongObject *)lhs)) {
+            specialized_op = COMPARE_OP_INT_FLOAT;
+            goto success;
+        }
+        SPECIALIZATION_FAIL(COMPARE_OP, SPEC_FAIL_COMPARE_OP_BIG_INT);
+        goto failure;
+    }
     if (Py_TYPE(lhs) != Py_TYPE(rhs)) {
         SPECIALIZATION_FAIL(COMPARE_OP, compare_op_fail_kind(lhs, rhs));
         goto failure;
@@ -2931,6 +3123,20 @@ _Py_Specialize_ForIter(_PyStackRef iter, _Py_CODEUNIT *instr, int oparg)
         specialize(instr, FOR_ITER_RANGE);
         return;
     }
+    else if (tp == &PyDictIterItem_Type) {
+        specialize(instr, FOR_ITER_DICT_ITEMS);
+        return;
+    }
+    else if (tp == &PyEnum_Type) {
+        specialize(instr, FOR_ITER_ENUMERATE);
+        return;
+    }
+#ifndef Py_GIL_DISABLED
+    else if (tp == &PyListRevIter_Type) {
+        specialize(instr, FOR_ITER_REVERSED_LIST);
+        return;
+    }
+#endif
     else if (tp == &PyGen_Type && oparg <= SHRT_MAX) {
         // Generators are very much not thread-safe, so don't worry about
         // the specialization not being thread-safe.
@@ -3093,9 +3299,22 @@ containsop_fail_kind(PyObject *value) {
 }
 #endif
 
+static int
+tuple_of_exact_str(PyObject *tuple)
+{
+    for (Py_ssize_t i = 0; i < PyTuple_GET_SIZE(tuple); i++) {
+        if (!PyUnicode_CheckExact(PyTuple_GET_ITEM(tuple, i))) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
 Py_NO_INLINE void
-_Py_Specialize_ContainsOp(_PyStackRef value_st, _Py_CODEUNIT *instr)
+_Py_Specialize_ContainsOp(_PyStackRef lhs_st, _PyStackRef value_st,
+                          _Py_CODEUNIT *instr)
 {
+    PyObject *lhs = PyStackRef_AsPyObjectBorrow(lhs_st);
     PyObject *value = PyStackRef_AsPyObjectBorrow(value_st);
 
     assert(ENABLE_SPECIALIZATION_FT);
@@ -3108,12 +3327,65 @@ _Py_Specialize_ContainsOp(_PyStackRef value_st, _Py_CODEUNIT *instr)
         specialize(instr, CONTAINS_OP_SET);
         return;
     }
+    if (PyTuple_CheckExact(value) && PyUnicode_CheckExact(lhs) &&
+        tuple_of_exact_str(value))
+    {
+        specialize(instr, CONTAINS_OP_STR_TUPLE);
+        return;
+    }
 
     SPECIALIZATION_FAIL(CONTAINS_OP, containsop_fail_kind(value));
     unspecialize(instr);
     return;
 }
 
+Py_NO_INLINE void
+_Py_Specialize_FormatSimple(_PyStackRef value_st, _Py_CODEUNIT *instr)
+{
+    PyObject *value = PyStackRef_AsPyObjectBorrow(value_st);
+
+    assert(ENABLE_SPECIALIZATION_FT);
+    assert(_PyOpcode_Caches[FORMAT_SIMPLE] == INLINE_CACHE_ENTRIES_FORMAT_SIMPLE);
+    if (PyUnicode_CheckExact(value)) {
+        specialize(instr, FORMAT_SIMPLE_STR);
+        return;
+    }
+    if (PyLong_CheckExact(value)) {
+        specialize(instr, FORMAT_SIMPLE_INT);
+        return;
+    }
+    if (PyFloat_CheckExact(value)) {
+        specialize(instr, FORMAT_SIMPLE_FLOAT);
+        return;
+    }
+    SPECIALIZATION_FAIL(FORMAT_SIMPLE, SPEC_FAIL_OTHER);
+    unspecialize(instr);
+}
+
+Py_NO_INLINE void
+_Py_Specialize_FormatWithSpec(_PyStackRef value_st, _Py_CODEUNIT *instr)
+{
+    PyObject *value = PyStackRef_AsPyObjectBorrow(value_st);
+
+    assert(ENABLE_SPECIALIZATION_FT);
+    assert(_PyOpcode_Caches[FORMAT_WITH_SPEC] ==
+           INLINE_CACHE_ENTRIES_FORMAT_WITH_SPEC);
+    if (PyUnicode_CheckExact(value)) {
+        specialize(instr, FORMAT_WITH_SPEC_STR);
+        return;
+    }
+    if (PyLong_CheckExact(value)) {
+        specialize(instr, FORMAT_WITH_SPEC_INT);
+        return;
+    }
+    if (PyFloat_CheckExact(value)) {
+        specialize(instr, FORMAT_WITH_SPEC_FLOAT);
+        return;
+    }
+    SPECIALIZATION_FAIL(FORMAT_WITH_SPEC, SPEC_FAIL_OTHER);
+    unspecialize(instr);
+}
+
 /* Code init cleanup.
  * CALL_ALLOC_AND_ENTER_INIT will set up
  * the frame to execute the EXIT_INIT_CHECK
@@ -26,7 +26,7 @@ Data members:
 #include "pycore_modsupport.h"    // _PyModule_CreateInitialized()
 #include "pycore_namespace.h"     // _PyNamespace_New()
 #include "pycore_object.h"        // _PyObject_DebugTypeStats()
-#include "pycore_optimizer.h"     // _PyDumpExecutors()
+#include "pycore_optimizer.h"     // _PyDumpExecutors(), _PyGetExecutorProfiles()
 #include "pycore_pathconfig.h"    // _PyPathConfig_ComputeSysPath0()
 #include "pycore_pyerrors.h"      // _PyErr_GetRaisedException()
 #include "pycore_pylifecycle.h"   // _PyErr_WriteUnraisableDefaultHook()
@@ -69,8 +69,9 @@ extern const char *PyWin_DLLVersionString;
 
 /*[clinic input]
 module sys
+module _jit
 [clinic start generated code]*/
-/*[clinic end generated code: output=da39a3ee5e6b4b0d input=3726b388feee8cea]*/
+/*[clinic end generated code: output=da39a3ee5e6b4b0d input=44003bfdf18ba298]*/
 
 #include "clinic/sysmodule.c.h"
 
@@ -3978,6 +3979,76 @@ _PySys_SetPreliminaryStderr(PyObject *sysdict)
 
 PyObject *_Py_CreateMonitoringObject(void);
 
+/*[clinic input]
+_jit.is_enabled -> bool
+
+Return True if the tier 2 optimizer is enabled for this interpreter.
+[clinic start generated code]*/
+
+static int
+_jit_is_enabled_impl(PyObject *module)
+/*[clinic end generated code: output=55865f8de993fe42 input=4156e485467f99af]*/
+{
+    return _PyInterpreterState_GET()->jit;
+}
+
+/*[clinic input]
+_jit.get_executors
+
+Return a list describing every live tier 2 executor.
+
+Each item is a dict with the code object and bytecode offset the executor
+is attached to, the names of the uops in its trace, how many times the
+trace has run, the number of deoptimizations and the guards that can cause
+them, the size of its machine code, and a list of its side exits. Each side
+exit records the qualname, filename and first line number of the code
+object its target is in, its target offset in that code object, how often
+it was taken, whether it has been linked to another executor, and the guards
+that lead to it.
+[clinic start generated code]*/
+
+static PyObject *
+_jit_get_executors_impl(PyObject *module)
+/*[clinic end generated code: output=5b9a14e4e9355a9c input=e76cd37c4a3f72e9]*/
+{
+    return _PyGetExecutorProfiles();
+}
+
+/*[clinic input]
+_jit.get_abandoned
+
+Return a dict counting the traces the tier 2 optimizer gave up on, by reason.
+
+"no_progress" counts traces that ended before their first instruction,
+"unsupported_opcode" those that started at an instruction the optimizer
+cannot translate, "unknown_callee" those that called a function that could
+not be identified, "trace_stack_overflow" and "trace_stack_underflow" those
+that followed too many calls or returned out of the frame they started in,
+and "optimizer" those the optimizer could not optimize.
+[clinic start generated code]*/
+
+static PyObject *
+_jit_get_abandoned_impl(PyObject *module)
+/*[clinic end generated code: output=3548d6a70fa65adb input=272cd3a58613d1f2]*/
+{
+    return _PyGetAbandonedTraces();
+}
+
+static PyMethodDef _jit_methods[] = {
+    _JIT_IS_ENABLED_METHODDEF
+    _JIT_GET_EXECUTORS_METHODDEF
+    _JIT_GET_ABANDONED_METHODDEF
+    {NULL, NULL}
+};
+
+static struct PyModuleDef _jit_module = {
+    PyModuleDef_HEAD_INIT,
+    .m_name = "sys._jit",
+    .m_doc = "Introspection of the tier 2 optimizer and JIT compiler.",
+    .m_size = -1,
+    .m_methods = _jit_methods,
+};
+
 /* Create sys module without all attributes.
    _PySys_UpdateConfig() should be called later to add remaining attributes. */
 PyStatus
@@ -4039,6 +4110,16 @@ _PySys_Create(PyThreadState *tstate, PyObject **sysmod_p)
         goto error;
     }
 
+    PyObject *jit = _PyModule_CreateInitialized(&_jit_module, PYTHON_API_VERSION);
+    if (jit == NULL) {
+        goto error;
+    }
+    err = PyDict_SetItemString(sysdict, "_jit", jit);
+    Py_DECREF(jit);
+    if (err < 0) {
+        goto error;
+    }
+
     assert(!_PyErr_Occurred(tstate));
 
     *sysmod_p = sysmod;
@@ -675,6 +675,7 @@ def has_error_without_pop(op: parser.CodeDef) -> bool:
     "assert",
     "backoff_counter_triggers",
     "initial_temperature_backoff_counter",
+    "rearm_backoff_counter",
     "JUMP_TO_LABEL",
     "restart_backoff_counter",
     "_Py_ReachedRecursionLimit",
@@ -51,6 +51,29 @@ def pretty(name: str) -> str:
     return name.replace("_", " ").lower()
 
 
+# Instructions that end a basic block or otherwise don't make sense as part of
+# a superinstruction, even though they have no inline cache and don't jump:
+_NOT_FUSABLE = frozenset({
+    "CACHE", "EXTENDED_ARG", "NOP", "RESUME", "RETURN_VALUE", "RETURN_GENERATOR",
+    "RAISE_VARARGS", "RERAISE", "YIELD_VALUE", "INTERPRETER_EXIT",
+    "ENTER_EXECUTOR", "EXIT_INIT_CHECK",
+})
+
+
+def _get_fusable_instructions(opcode) -> list[str]:
+    """Return the names of the unspecialized instructions that a
+    superinstruction could be built from: no inline cache, no jump, and not
+    a block terminator."""
+    return [
+        name
+        for name, op in opcode.opmap.items()
+        if op < opcode.MIN_INSTRUMENTED_OPCODE
+        and name not in _NOT_FUSABLE
+        and not opcode._inline_cache_entries.get(name)  # type: ignore
+        and op not in opcode.hasjump
+    ]
+
+
 def _load_metadata_from_source():
     def get_defines(filepath: Path, prefix: str = "SPEC_FAIL"):
         with open(SOURCE_DIR / filepath) as spec_src:
@@ -71,6 +94,7 @@ def get_defines(filepath: Path, prefix: str = "SPEC_FAIL"):
         "_specialized_instructions": [
             op for op in opcode._specialized_opmap.keys() if "__" not in op  # type: ignore
         ],
+        "_fusable_instructions": _get_fusable_instructions(opcode),
         "_stats_defines": get_defines(
             Path("Include") / "cpython" / "pystats.h", "EVAL_CALL"
         ),
@@ -384,6 +408,10 @@ def get_opcode_stats(self, prefix: str) -> OpcodeStats:
             self._data["_specialized_instructions"],
         )
 
+    def get_fusable_instructions(self) -> list[str]:
+        # Older JSON dumps don't have this:
+        return self._data.get("_fusable_instructions", [])
+
     def get_call_stats(self) -> dict[str, int]:
         defines = self._data["_stats_defines"]
         result = {}
@@ -829,6 +857,58 @@ def calc_pair_count_table(stats: Stats) -> Rows:
     )
 
 
+def superinstruction_section() -> Section:
+    def calc_superinstruction_table(stats: Stats) -> Rows:
+        fusable = set(stats.get_fusable_instructions())
+        opcode_stats = stats.get_opcode_stats("opcode")
+        pair_counts = opcode_stats.get_pair_counts()
+        total = opcode_stats.get_total_execution_count()
+
+        candidates = [
+            ((first, second), count)
+            for (first, second), count in pair_counts.items()
+            if first in fusable
+            and second in fusable
+            and f"{first}_{second}" not in fusable
+        ]
+        cumulative = 0
+        rows: Rows = []
+        for (first, second), count in itertools.islice(
+            sorted(candidates, key=itemgetter(1), reverse=True), 20
+        ):
+            cumulative += count
+            rows.append(
+                (
+                    f"{first} {second}",
+                    Count(count),
+                    Ratio(count, total),
+                    Ratio(cumulative, total),
+                )
+            )
+        return rows
+
+    return Section(
+        "Superinstruction candidates",
+        "Top 20 pairs of Tier 1 opcodes that could be fused into a superinstruction",
+        [
+            Table(
+                ("Pair", "Count:", "Self:", "Cumulative:"),
+                calc_superinstruction_table,
+            )
+        ],
+        comparative=False,
+        doc="""
+        Only pairs of unspecialized instructions without inline caches or jumps
+        are listed, and pairs that already have a superinstruction (named
+        FIRST_SECOND, like LOAD_FAST_LOAD_FAST) are skipped. Fusing a pair
+        also needs both opargs to fit in four bits, which is not recorded
+        here. New superinstructions are written by hand in
+        Python/bytecodes.c and formed in insert_superinstructions() in
+        Python/flowgraph.c.
+        """,
+    )
+
+
 def pre_succ_pairs_section() -> Section:
     def iter_pre_succ_pairs_tables(base_stats: Stats, head_stats: Stats | None = None):
         assert head_stats is None
@@ -1398,6 +1478,7 @@ def calc_rows(stats: Stats) -> Rows:
 LAYOUT = [
     execution_count_section(),
     pair_count_section("opcode"),
+    superinstruction_section(),
     pre_succ_pairs_section(),
     specialization_section(),
     specialization_effectiveness_section(),